@@ -0,0 +1,133 @@
+// Copyright (c) 2020 - present Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Measures the latency of rocfft_plan_create / rocfft_plan_destroy.  Each
+// trial creates and destroys the plan, so every trial builds the plan tree
+// from scratch.
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+#include "./rider.h"
+#include "rocfft.h"
+#include <boost/program_options.hpp>
+namespace po = boost::program_options;
+
+int main(int argc, char* argv[])
+{
+    // Transform type parameters:
+    rocfft_transform_type transformType;
+
+    // Number of plans to create:
+    int ntrial;
+
+    // Number of batches:
+    size_t nbatch = 1;
+
+    // Transform length:
+    std::vector<size_t> length;
+
+    // clang-format doesn't handle boost program options very well:
+    // clang-format off
+    po::options_description opdesc("rocfft plan rider command line options");
+    opdesc.add_options()("help,h", "produces this help message")
+        ("ntrial,N", po::value<int>(&ntrial)->default_value(100), "Number of plans to create")
+        ("notInPlace,o", "Not in-place FFT transform (default: in-place)")
+        ("double", "Double precision transform (default: single)")
+        ("transformType,t", po::value<rocfft_transform_type>(&transformType)
+         ->default_value(rocfft_transform_type_complex_forward),
+         "Type of transform:\n0) complex forward\n1) complex inverse\n2) real "
+         "forward\n3) real inverse")
+        ( "batchSize,b", po::value<size_t>(&nbatch)->default_value(1),
+          "If this value is greater than one, arrays will be used ")
+        ("length",  po::value<std::vector<size_t>>(&length)->multitoken(), "Lengths.");
+    // clang-format on
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, opdesc), vm);
+    po::notify(vm);
+
+    if(vm.count("help"))
+    {
+        std::cout << opdesc << std::endl;
+        return 0;
+    }
+
+    if(!vm.count("length"))
+    {
+        std::cout << "Please specify transform length!" << std::endl;
+        std::cout << opdesc << std::endl;
+        return 0;
+    }
+
+    if(ntrial < 1)
+    {
+        std::cout << "ntrial must be positive!" << std::endl;
+        return 0;
+    }
+
+    const rocfft_result_placement place
+        = vm.count("notInPlace") ? rocfft_placement_notinplace : rocfft_placement_inplace;
+    const rocfft_precision precision
+        = vm.count("double") ? rocfft_precision_double : rocfft_precision_single;
+
+    // rocFFT takes lengths in column-major order:
+    std::vector<size_t> length_cm(length.rbegin(), length.rend());
+
+    LIB_V_THROW(rocfft_setup(), "rocfft_setup failed");
+
+    std::vector<double> plan_time(ntrial);
+    for(int itrial = 0; itrial < ntrial; ++itrial)
+    {
+        const auto start = std::chrono::steady_clock::now();
+
+        rocfft_plan plan = NULL;
+        LIB_V_THROW(rocfft_plan_create(&plan,
+                                       place,
+                                       transformType,
+                                       precision,
+                                       length_cm.size(),
+                                       length_cm.data(),
+                                       nbatch,
+                                       NULL),
+                    "rocfft_plan_create failed");
+        LIB_V_THROW(rocfft_plan_destroy(plan), "rocfft_plan_destroy failed");
+
+        const auto stop = std::chrono::steady_clock::now();
+        plan_time[itrial]
+            = std::chrono::duration_cast<std::chrono::duration<double, std::micro>>(stop - start)
+                  .count();
+    }
+
+    std::sort(plan_time.begin(), plan_time.end());
+    double total = 0;
+    for(const auto& i : plan_time)
+        total += i;
+
+    std::cout << "Plan create+destroy time over " << ntrial << " trials:\n";
+    std::cout << "\tmin:    " << plan_time.front() << " us\n";
+    std::cout << "\tmedian: " << plan_time[ntrial / 2] << " us\n";
+    std::cout << "\tmean:   " << total / ntrial << " us" << std::endl;
+
+    LIB_V_THROW(rocfft_cleanup(), "rocfft_cleanup failed");
+}
@@ -52,6 +52,8 @@ static std::vector<size_t> stride_range = {1};
 static std::vector<size_t> stride_range_for_prime
     = {1, 2, 3, 64, 65}; //TODO: this will be merged back to stride_range
 
+static std::vector<size_t> stride_range_for_real = {1, 2, 3};
+
 static rocfft_result_placement placeness_range[]
     = {rocfft_placement_notinplace, rocfft_placement_inplace};
 
@@ -218,3 +220,21 @@ INSTANTIATE_TEST_CASE_P(prime_1D_c2r,
                                            ValuesIn(batch_range),
                                            ValuesIn(precision_range),
                                            ValuesIn(c2r_range)));
+
+static std::vector<std::vector<size_t>> vmix_range = {mix_range};
+INSTANTIATE_TEST_CASE_P(mix_1D_r2c_strided,
+                        accuracy_test,
+                        ::testing::Combine(ValuesIn(generate_lengths(vmix_range)),
+                                           ValuesIn(stride_range_for_real),
+                                           ValuesIn(stride_range_for_real),
+                                           ValuesIn(batch_range),
+                                           ValuesIn(precision_range),
+                                           ValuesIn(r2c_range)));
+INSTANTIATE_TEST_CASE_P(mix_1D_c2r_strided,
+                        accuracy_test,
+                        ::testing::Combine(ValuesIn(generate_lengths(vmix_range)),
+                                           ValuesIn(stride_range_for_real),
+                                           ValuesIn(stride_range_for_real),
+                                           ValuesIn(batch_range),
+                                           ValuesIn(precision_range),
+                                           ValuesIn(c2r_range)));
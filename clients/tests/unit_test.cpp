@@ -22,11 +22,19 @@
 #include "hip/hip_vector_types.h"
 #include "private.h"
 #include "rocfft.h"
+#include <algorithm>
+#include <cmath>
+#include <complex>
 #include <condition_variable>
+#include <cstdio>
+#include <cstring>
 #include <gtest/gtest.h>
 #include <iostream>
 #include <mutex>
+#include <string>
+#include <sys/wait.h>
 #include <thread>
+#include <unistd.h>
 #include <vector>
 
 TEST(rocfft_UnitTest, sample_code_iterative)
@@ -94,6 +102,1351 @@ TEST(rocfft_UnitTest, sample_code_iterative)
     }
 }
 
+// Run plans through the host execution backend with host buffers and
+// compare to a direct DFT.
+TEST(rocfft_UnitTest, host_backend_execution)
+{
+    // stockham, large 1D (power of 2 and mixed radix), Bluestein plans
+    // padded to a non power of 2 length, Rader plans for primes with a
+    // smooth N - 1, a large 1D plan with a prime factor of 7, radix-7 and
+    // radix-11 kernels and a Good-Thomas split into coprime lengths
+    for(size_t N : {16, 8192, 2500, 23, 4097, 17, 257, 7168, 2401, 2662, 12000})
+    {
+        std::vector<std::complex<double>> x(N), y(N);
+        for(size_t i = 0; i < N; i++)
+            x[i] = std::complex<double>(std::sin(0.1 * i), std::cos(0.3 * i));
+
+        std::vector<std::complex<double>> ref(N);
+        for(size_t k = 0; k < N; k++)
+            for(size_t j = 0; j < N; j++)
+                ref[k] += x[j] * std::polar(1.0, -2.0 * M_PI * ((j * k) % N) / N);
+
+        rocfft_plan plan = NULL;
+        ASSERT_TRUE(rocfft_status_success
+                    == rocfft_plan_create(&plan,
+                                          rocfft_placement_notinplace,
+                                          rocfft_transform_type_complex_forward,
+                                          rocfft_precision_double,
+                                          1,
+                                          &N,
+                                          1,
+                                          NULL));
+
+        size_t workBufferSize = 0;
+        rocfft_plan_get_work_buffer_size(plan, &workBufferSize);
+        std::vector<char> workBuffer(workBufferSize);
+
+        rocfft_execution_info info = NULL;
+        rocfft_execution_info_create(&info);
+        EXPECT_TRUE(rocfft_status_success
+                    == rocfft_execution_info_set_backend(info, rocfft_execution_backend_host));
+        rocfft_execution_info_set_work_buffer(info, workBuffer.data(), workBufferSize);
+
+        void* in_buffer[1]  = {x.data()};
+        void* out_buffer[1] = {y.data()};
+        rocfft_execute(plan, in_buffer, out_buffer, info);
+
+        for(size_t k = 0; k < N; k++)
+            EXPECT_NEAR(0, std::abs(y[k] - ref[k]), 1e-9 * N);
+
+        rocfft_execution_info_destroy(info);
+        rocfft_plan_destroy(plan);
+    }
+}
+
+// 2D and 3D plans (fused single kernel, row-column and RTRT schemes) on the
+// host backend, checked against a direct DFT at a few frequencies.
+TEST(rocfft_UnitTest, host_backend_multi_dim)
+{
+    const std::vector<std::vector<size_t>> lengths
+        = {{16, 16}, {128, 64}, {8, 4, 8}, {16, 16, 64}, {100, 30}};
+    const size_t batch = 2;
+
+    for(const auto& len : lengths)
+    {
+        size_t total = 1;
+        for(auto l : len)
+            total *= l;
+
+        std::vector<std::complex<double>> x(total * batch), y(total * batch);
+        for(size_t i = 0; i < x.size(); i++)
+            x[i] = std::complex<double>(std::sin(0.1 * i), std::cos(0.3 * i));
+
+        rocfft_plan plan = NULL;
+        ASSERT_TRUE(rocfft_status_success
+                    == rocfft_plan_create(&plan,
+                                          rocfft_placement_notinplace,
+                                          rocfft_transform_type_complex_forward,
+                                          rocfft_precision_double,
+                                          len.size(),
+                                          len.data(),
+                                          batch,
+                                          NULL));
+
+        size_t workBufferSize = 0;
+        rocfft_plan_get_work_buffer_size(plan, &workBufferSize);
+        std::vector<char> workBuffer(workBufferSize);
+
+        rocfft_execution_info info = NULL;
+        rocfft_execution_info_create(&info);
+        rocfft_execution_info_set_backend(info, rocfft_execution_backend_host);
+        rocfft_execution_info_set_work_buffer(info, workBuffer.data(), workBufferSize);
+
+        void* in_buffer[1]  = {x.data()};
+        void* out_buffer[1] = {y.data()};
+        rocfft_execute(plan, in_buffer, out_buffer, info);
+
+        for(size_t b = 0; b < batch; b++)
+        {
+            for(size_t k : {size_t(0), size_t(1), total / 3, total - 1})
+            {
+                std::complex<double> ref = 0;
+                for(size_t j = 0; j < total; j++)
+                {
+                    // sum over the dimensions of k_d * j_d / len_d
+                    double phase = 0;
+                    size_t kk = k, jj = j;
+                    for(auto l : len)
+                    {
+                        phase += double((kk % l) * (jj % l)) / l;
+                        kk /= l;
+                        jj /= l;
+                    }
+                    ref += x[b * total + j] * std::polar(1.0, -2.0 * M_PI * phase);
+                }
+                EXPECT_NEAR(0, std::abs(y[b * total + k] - ref), 1e-9 * total);
+            }
+        }
+
+        rocfft_execution_info_destroy(info);
+        rocfft_plan_destroy(plan);
+    }
+}
+
+// Even-length real transforms of strided data, here one channel of three
+// interleaved ones, on the host backend: forward against a direct DFT and
+// back.
+TEST(rocfft_UnitTest, host_backend_real_strided)
+{
+    const size_t channels = 3;
+
+    for(size_t N : {64, 1000})
+    {
+        const size_t herm = N / 2 + 1;
+
+        std::vector<double> x(N * channels), z(N * channels);
+        for(size_t i = 0; i < x.size(); i++)
+            x[i] = std::sin(0.1 * i) + std::cos(0.7 * i);
+        std::vector<std::complex<double>> y(herm * channels);
+
+        size_t realStride = channels, hermStride = 1;
+
+        rocfft_plan_description fwdDesc = NULL;
+        rocfft_plan_description_create(&fwdDesc);
+        rocfft_plan_description_set_data_layout(fwdDesc,
+                                                rocfft_array_type_real,
+                                                rocfft_array_type_hermitian_interleaved,
+                                                NULL,
+                                                NULL,
+                                                1,
+                                                &realStride,
+                                                1,
+                                                1,
+                                                &hermStride,
+                                                herm);
+
+        rocfft_plan_description invDesc = NULL;
+        rocfft_plan_description_create(&invDesc);
+        rocfft_plan_description_set_data_layout(invDesc,
+                                                rocfft_array_type_hermitian_interleaved,
+                                                rocfft_array_type_real,
+                                                NULL,
+                                                NULL,
+                                                1,
+                                                &hermStride,
+                                                herm,
+                                                1,
+                                                &realStride,
+                                                1);
+
+        rocfft_plan fwd = NULL, inv = NULL;
+        ASSERT_TRUE(rocfft_status_success
+                    == rocfft_plan_create(&fwd,
+                                          rocfft_placement_notinplace,
+                                          rocfft_transform_type_real_forward,
+                                          rocfft_precision_double,
+                                          1,
+                                          &N,
+                                          channels,
+                                          fwdDesc));
+        ASSERT_TRUE(rocfft_status_success
+                    == rocfft_plan_create(&inv,
+                                          rocfft_placement_notinplace,
+                                          rocfft_transform_type_real_inverse,
+                                          rocfft_precision_double,
+                                          1,
+                                          &N,
+                                          channels,
+                                          invDesc));
+
+        size_t fwdSize = 0, invSize = 0;
+        rocfft_plan_get_work_buffer_size(fwd, &fwdSize);
+        rocfft_plan_get_work_buffer_size(inv, &invSize);
+        std::vector<char> workBuffer(std::max(fwdSize, invSize));
+
+        rocfft_execution_info info = NULL;
+        rocfft_execution_info_create(&info);
+        rocfft_execution_info_set_backend(info, rocfft_execution_backend_host);
+        rocfft_execution_info_set_work_buffer(info, workBuffer.data(), workBuffer.size());
+
+        void* real_buffer[1] = {x.data()};
+        void* herm_buffer[1] = {y.data()};
+        rocfft_execute(fwd, real_buffer, herm_buffer, info);
+
+        for(size_t c = 0; c < channels; c++)
+        {
+            for(size_t k = 0; k < herm; k++)
+            {
+                std::complex<double> ref = 0;
+                for(size_t j = 0; j < N; j++)
+                    ref += x[j * channels + c] * std::polar(1.0, -2.0 * M_PI * ((j * k) % N) / N);
+                EXPECT_NEAR(0, std::abs(y[c * herm + k] - ref), 1e-9 * N);
+            }
+        }
+
+        real_buffer[0] = z.data();
+        rocfft_execute(inv, herm_buffer, real_buffer, info);
+
+        for(size_t i = 0; i < x.size(); i++)
+            EXPECT_NEAR(x[i], z[i] / N, 1e-9);
+
+        rocfft_execution_info_destroy(info);
+        rocfft_plan_destroy(fwd);
+        rocfft_plan_destroy(inv);
+        rocfft_plan_description_destroy(fwdDesc);
+        rocfft_plan_description_destroy(invDesc);
+    }
+}
+
+// Odd-length real transforms of batches are computed in pairs of batch
+// members; an odd batch leaves one member paired with zeros.
+TEST(rocfft_UnitTest, host_backend_real_odd_batch)
+{
+    const size_t batch = 3;
+
+    for(size_t N : {15, 99})
+    {
+        const size_t herm = N / 2 + 1;
+
+        std::vector<double> x(N * batch), z(N * batch);
+        for(size_t i = 0; i < x.size(); i++)
+            x[i] = std::sin(0.1 * i) + std::cos(0.7 * i);
+        std::vector<std::complex<double>> y(herm * batch);
+
+        rocfft_plan fwd = NULL, inv = NULL;
+        ASSERT_TRUE(rocfft_status_success
+                    == rocfft_plan_create(&fwd,
+                                          rocfft_placement_notinplace,
+                                          rocfft_transform_type_real_forward,
+                                          rocfft_precision_double,
+                                          1,
+                                          &N,
+                                          batch,
+                                          NULL));
+        ASSERT_TRUE(rocfft_status_success
+                    == rocfft_plan_create(&inv,
+                                          rocfft_placement_notinplace,
+                                          rocfft_transform_type_real_inverse,
+                                          rocfft_precision_double,
+                                          1,
+                                          &N,
+                                          batch,
+                                          NULL));
+
+        size_t fwdSize = 0, invSize = 0;
+        rocfft_plan_get_work_buffer_size(fwd, &fwdSize);
+        rocfft_plan_get_work_buffer_size(inv, &invSize);
+        std::vector<char> workBuffer(std::max(fwdSize, invSize));
+
+        rocfft_execution_info info = NULL;
+        rocfft_execution_info_create(&info);
+        rocfft_execution_info_set_backend(info, rocfft_execution_backend_host);
+        rocfft_execution_info_set_work_buffer(info, workBuffer.data(), workBuffer.size());
+
+        void* real_buffer[1] = {x.data()};
+        void* herm_buffer[1] = {y.data()};
+        rocfft_execute(fwd, real_buffer, herm_buffer, info);
+
+        for(size_t b = 0; b < batch; b++)
+        {
+            for(size_t k = 0; k < herm; k++)
+            {
+                std::complex<double> ref = 0;
+                for(size_t j = 0; j < N; j++)
+                    ref += x[b * N + j] * std::polar(1.0, -2.0 * M_PI * ((j * k) % N) / N);
+                EXPECT_NEAR(0, std::abs(y[b * herm + k] - ref), 1e-9 * N);
+            }
+        }
+
+        real_buffer[0] = z.data();
+        rocfft_execute(inv, herm_buffer, real_buffer, info);
+
+        for(size_t i = 0; i < x.size(); i++)
+            EXPECT_NEAR(x[i], z[i] / N, 1e-9);
+
+        rocfft_execution_info_destroy(info);
+        rocfft_plan_destroy(fwd);
+        rocfft_plan_destroy(inv);
+    }
+}
+
+// Batches split into several launches give the same transform; the pair
+// kernels move their complex side by whole pairs of members, and Bluestein
+// and Rader kernels by single members.
+TEST(rocfft_UnitTest, host_backend_split_launches)
+{
+    const size_t N     = 15;
+    const size_t batch = 7;
+    const size_t herm  = N / 2 + 1;
+
+    std::vector<double> x(N * batch), z(N * batch);
+    for(size_t i = 0; i < x.size(); i++)
+        x[i] = std::sin(0.1 * i) + std::cos(0.7 * i);
+
+    for(size_t maxBatch : {2, 3})
+    {
+        std::vector<std::complex<double>> y(herm * batch);
+
+        rocfft_plan fwd = NULL, inv = NULL;
+        ASSERT_TRUE(rocfft_status_success
+                    == rocfft_plan_create(&fwd,
+                                          rocfft_placement_notinplace,
+                                          rocfft_transform_type_real_forward,
+                                          rocfft_precision_double,
+                                          1,
+                                          &N,
+                                          batch,
+                                          NULL));
+        ASSERT_TRUE(rocfft_status_success
+                    == rocfft_plan_create(&inv,
+                                          rocfft_placement_notinplace,
+                                          rocfft_transform_type_real_inverse,
+                                          rocfft_precision_double,
+                                          1,
+                                          &N,
+                                          batch,
+                                          NULL));
+        EXPECT_TRUE(rocfft_status_success == rocfft_plan_set_max_launch_batch(fwd, maxBatch));
+        EXPECT_TRUE(rocfft_status_success == rocfft_plan_set_max_launch_batch(inv, maxBatch));
+
+        size_t fwdSize = 0, invSize = 0;
+        rocfft_plan_get_work_buffer_size(fwd, &fwdSize);
+        rocfft_plan_get_work_buffer_size(inv, &invSize);
+        std::vector<char> workBuffer(std::max(fwdSize, invSize));
+
+        rocfft_execution_info info = NULL;
+        rocfft_execution_info_create(&info);
+        rocfft_execution_info_set_backend(info, rocfft_execution_backend_host);
+        rocfft_execution_info_set_work_buffer(info, workBuffer.data(), workBuffer.size());
+
+        void* real_buffer[1] = {x.data()};
+        void* herm_buffer[1] = {y.data()};
+        rocfft_execute(fwd, real_buffer, herm_buffer, info);
+
+        for(size_t b = 0; b < batch; b++)
+        {
+            for(size_t k = 0; k < herm; k++)
+            {
+                std::complex<double> ref = 0;
+                for(size_t j = 0; j < N; j++)
+                    ref += x[b * N + j] * std::polar(1.0, -2.0 * M_PI * ((j * k) % N) / N);
+                EXPECT_NEAR(0, std::abs(y[b * herm + k] - ref), 1e-9 * N);
+            }
+        }
+
+        real_buffer[0] = z.data();
+        rocfft_execute(inv, herm_buffer, real_buffer, info);
+
+        for(size_t i = 0; i < x.size(); i++)
+            EXPECT_NEAR(x[i], z[i] / N, 1e-9);
+
+        rocfft_execution_info_destroy(info);
+        rocfft_plan_destroy(fwd);
+        rocfft_plan_destroy(inv);
+    }
+
+    // the Bluestein multiplies of a prime too rough for Rader, and the Rader
+    // kernels, are split like any other kernel
+    for(size_t P : {47, 17})
+    {
+        std::vector<std::complex<double>> u(P * batch), v(P * batch);
+        for(size_t i = 0; i < u.size(); i++)
+            u[i] = std::complex<double>(std::sin(0.1 * i), std::cos(0.3 * i));
+
+        rocfft_plan plan = NULL;
+        ASSERT_TRUE(rocfft_status_success
+                    == rocfft_plan_create(&plan,
+                                          rocfft_placement_notinplace,
+                                          rocfft_transform_type_complex_forward,
+                                          rocfft_precision_double,
+                                          1,
+                                          &P,
+                                          batch,
+                                          NULL));
+        EXPECT_TRUE(rocfft_status_success == rocfft_plan_set_max_launch_batch(plan, 3));
+
+        size_t workBufferSize = 0;
+        rocfft_plan_get_work_buffer_size(plan, &workBufferSize);
+        std::vector<char> workBuffer(workBufferSize);
+
+        rocfft_execution_info info = NULL;
+        rocfft_execution_info_create(&info);
+        rocfft_execution_info_set_backend(info, rocfft_execution_backend_host);
+        rocfft_execution_info_set_work_buffer(info, workBuffer.data(), workBufferSize);
+
+        void* in_buffer[1]  = {u.data()};
+        void* out_buffer[1] = {v.data()};
+        rocfft_execute(plan, in_buffer, out_buffer, info);
+
+        for(size_t b = 0; b < batch; b++)
+        {
+            for(size_t k = 0; k < P; k++)
+            {
+                std::complex<double> ref = 0;
+                for(size_t j = 0; j < P; j++)
+                    ref += u[b * P + j] * std::polar(1.0, -2.0 * M_PI * ((j * k) % P) / P);
+                EXPECT_NEAR(0, std::abs(v[b * P + k] - ref), 1e-9 * P);
+            }
+        }
+
+        rocfft_execution_info_destroy(info);
+        rocfft_plan_destroy(plan);
+    }
+}
+
+// The strided real rows of a 2D real transform are packed into one
+// temporary buffer, and the transposes use another one after the rows are
+// done; both share the same memory.
+TEST(rocfft_UnitTest, work_buffer_liveness)
+{
+    std::vector<size_t> length     = {64, 32};
+    std::vector<size_t> realStride = {2, 128};
+    std::vector<size_t> hermStride = {1, 33};
+
+    rocfft_plan_description desc = NULL;
+    rocfft_plan_description_create(&desc);
+    rocfft_plan_description_set_data_layout(desc,
+                                            rocfft_array_type_real,
+                                            rocfft_array_type_hermitian_interleaved,
+                                            NULL,
+                                            NULL,
+                                            2,
+                                            realStride.data(),
+                                            0,
+                                            2,
+                                            hermStride.data(),
+                                            0);
+
+    rocfft_plan plan = NULL;
+    ASSERT_TRUE(rocfft_status_success
+                == rocfft_plan_create(&plan,
+                                      rocfft_placement_notinplace,
+                                      rocfft_transform_type_real_forward,
+                                      rocfft_precision_double,
+                                      2,
+                                      length.data(),
+                                      1,
+                                      desc));
+
+    // the transposed hermitian data is the largest buffer
+    size_t workSize = 0;
+    rocfft_plan_get_work_buffer_size(plan, &workSize);
+    EXPECT_EQ(33 * 32 * sizeof(std::complex<double>), workSize);
+
+    rocfft_plan_destroy(plan);
+    rocfft_plan_description_destroy(desc);
+}
+
+// In-place complex transforms of contiguous data transpose in place, so
+// they need no work buffer.
+TEST(rocfft_UnitTest, host_backend_inplace_transpose)
+{
+    const std::vector<std::vector<size_t>> lengths = {{4096}, {512, 256}, {64, 64, 256}};
+    const size_t                           batch   = 2;
+
+    for(const auto& len : lengths)
+    {
+        size_t total = 1;
+        for(auto l : len)
+            total *= l;
+
+        std::vector<std::complex<double>> x(total * batch);
+        for(size_t i = 0; i < x.size(); i++)
+            x[i] = std::complex<double>(std::sin(0.1 * i), std::cos(0.3 * i));
+        auto y = x;
+
+        rocfft_plan plan = NULL;
+        ASSERT_TRUE(rocfft_status_success
+                    == rocfft_plan_create(&plan,
+                                          rocfft_placement_inplace,
+                                          rocfft_transform_type_complex_forward,
+                                          rocfft_precision_double,
+                                          len.size(),
+                                          len.data(),
+                                          batch,
+                                          NULL));
+
+        size_t workBufferSize = 0;
+        rocfft_plan_get_work_buffer_size(plan, &workBufferSize);
+        EXPECT_EQ(0, workBufferSize);
+
+        rocfft_execution_info info = NULL;
+        rocfft_execution_info_create(&info);
+        rocfft_execution_info_set_backend(info, rocfft_execution_backend_host);
+
+        void* buffer[1] = {y.data()};
+        rocfft_execute(plan, buffer, NULL, info);
+
+        for(size_t b = 0; b < batch; b++)
+        {
+            for(size_t k : {size_t(1), total / 3, total - 1})
+            {
+                std::complex<double> ref = 0;
+                for(size_t j = 0; j < total; j++)
+                {
+                    double phase = 0;
+                    size_t kk = k, jj = j;
+                    for(auto l : len)
+                    {
+                        phase += double((kk % l) * (jj % l)) / l;
+                        kk /= l;
+                        jj /= l;
+                    }
+                    ref += x[b * total + j] * std::polar(1.0, -2.0 * M_PI * phase);
+                }
+                EXPECT_NEAR(0, std::abs(y[b * total + k] - ref), 1e-9 * total);
+            }
+        }
+
+        rocfft_execution_info_destroy(info);
+        rocfft_plan_destroy(plan);
+    }
+}
+
+// A length 1 dimension makes the second pass of a 2D plan the identity;
+// the plan drops its kernels along with the work buffer they need.
+TEST(rocfft_UnitTest, host_backend_unit_length_rewrite)
+{
+    const std::vector<size_t> length = {4096, 1};
+    const size_t              N      = length[0];
+
+    std::vector<std::complex<double>> x(N), y(N);
+    for(size_t i = 0; i < N; i++)
+        x[i] = std::complex<double>(std::sin(0.1 * i), std::cos(0.3 * i));
+
+    rocfft_plan plan = NULL;
+    ASSERT_TRUE(rocfft_status_success
+                == rocfft_plan_create(&plan,
+                                      rocfft_placement_notinplace,
+                                      rocfft_transform_type_complex_forward,
+                                      rocfft_precision_double,
+                                      2,
+                                      length.data(),
+                                      1,
+                                      NULL));
+
+    size_t workBufferSize = 0;
+    rocfft_plan_get_work_buffer_size(plan, &workBufferSize);
+    EXPECT_LE(workBufferSize, N * sizeof(std::complex<double>));
+    std::vector<char> workBuffer(workBufferSize);
+
+    rocfft_execution_info info = NULL;
+    rocfft_execution_info_create(&info);
+    rocfft_execution_info_set_backend(info, rocfft_execution_backend_host);
+    rocfft_execution_info_set_work_buffer(info, workBuffer.data(), workBufferSize);
+
+    void* in_buffer[1]  = {x.data()};
+    void* out_buffer[1] = {y.data()};
+    rocfft_execute(plan, in_buffer, out_buffer, info);
+
+    for(size_t k : {size_t(0), size_t(1), N / 3, N - 1})
+    {
+        std::complex<double> ref = 0;
+        for(size_t j = 0; j < N; j++)
+            ref += x[j] * std::polar(1.0, -2.0 * M_PI * double(j * k % N) / N);
+        EXPECT_NEAR(0, std::abs(y[k] - ref), 1e-9 * N);
+    }
+
+    rocfft_execution_info_destroy(info);
+    rocfft_plan_destroy(plan);
+}
+
+// The scale of the plan description is applied by the last kernel of the
+// plan, whichever it is: a Stockham kernel, a transpose, an in-place
+// transpose, the Bluestein result multiplication or a real post-process.
+TEST(rocfft_UnitTest, host_backend_scale)
+{
+    struct ScaleCase
+    {
+        rocfft_transform_type   type;
+        rocfft_result_placement placement;
+        std::vector<size_t>     length;
+        size_t                  batch;
+    };
+    const std::vector<ScaleCase> cases
+        = {{rocfft_transform_type_complex_forward, rocfft_placement_notinplace, {64}, 3},
+           {rocfft_transform_type_complex_inverse, rocfft_placement_notinplace, {1 << 16}, 1},
+           {rocfft_transform_type_complex_forward, rocfft_placement_inplace, {512, 256}, 1},
+           {rocfft_transform_type_complex_forward, rocfft_placement_notinplace, {47}, 2},
+           {rocfft_transform_type_real_forward, rocfft_placement_notinplace, {1000}, 1},
+           {rocfft_transform_type_real_inverse, rocfft_placement_notinplace, {99}, 3}};
+
+    for(const auto& c : cases)
+    {
+        size_t N = 1;
+        for(auto l : c.length)
+            N *= l;
+        const size_t herm    = c.length[0] / 2 + 1;
+        const bool   forward = c.type == rocfft_transform_type_real_forward;
+        const bool   inverse = c.type == rocfft_transform_type_real_inverse;
+        const bool   inplace = c.placement == rocfft_placement_inplace;
+
+        // sizes of the input and the output of a batch member in doubles
+        const size_t inLen  = forward ? N : (inverse ? 2 * herm : 2 * N);
+        const size_t outLen = forward ? 2 * herm : (inverse ? N : 2 * N);
+
+        // output of the transform of a fixed input with the given scale
+        auto run = [&](const double scale) {
+            rocfft_plan_description desc = NULL;
+            rocfft_plan_description_create(&desc);
+            rocfft_plan_description_set_scale_double(desc, scale);
+            if(forward || inverse)
+                rocfft_plan_description_set_data_layout(
+                    desc,
+                    forward ? rocfft_array_type_real : rocfft_array_type_hermitian_interleaved,
+                    forward ? rocfft_array_type_hermitian_interleaved : rocfft_array_type_real,
+                    NULL,
+                    NULL,
+                    0,
+                    NULL,
+                    0,
+                    0,
+                    NULL,
+                    0);
+
+            rocfft_plan plan = NULL;
+            EXPECT_TRUE(rocfft_status_success
+                        == rocfft_plan_create(&plan,
+                                              c.placement,
+                                              c.type,
+                                              rocfft_precision_double,
+                                              c.length.size(),
+                                              c.length.data(),
+                                              c.batch,
+                                              desc));
+
+            size_t workBufferSize = 0;
+            rocfft_plan_get_work_buffer_size(plan, &workBufferSize);
+            std::vector<char> workBuffer(workBufferSize);
+
+            rocfft_execution_info info = NULL;
+            rocfft_execution_info_create(&info);
+            rocfft_execution_info_set_backend(info, rocfft_execution_backend_host);
+            rocfft_execution_info_set_work_buffer(info, workBuffer.data(), workBufferSize);
+
+            std::vector<double> x(inLen * c.batch), y(outLen * c.batch);
+            for(size_t i = 0; i < x.size(); i++)
+                x[i] = std::sin(0.1 * i) + std::cos(0.7 * i);
+
+            void* in_buffer[1]  = {x.data()};
+            void* out_buffer[1] = {y.data()};
+            rocfft_execute(plan, in_buffer, inplace ? NULL : out_buffer, info);
+
+            rocfft_execution_info_destroy(info);
+            rocfft_plan_destroy(plan);
+            rocfft_plan_description_destroy(desc);
+            return inplace ? x : y;
+        };
+
+        const double scale = 1.0 / N;
+        const auto   ref   = run(1.0);
+        const auto   y     = run(scale);
+        for(size_t i = 0; i < ref.size(); i++)
+            EXPECT_NEAR(scale * ref[i], y[i], 1e-12 * (1 + std::abs(y[i])));
+    }
+}
+
+// Data placed at the offsets of the plan description transforms as it does
+// at the start of the buffers, for each planar component separately.
+TEST(rocfft_UnitTest, host_backend_offsets)
+{
+    struct OffsetCase
+    {
+        rocfft_transform_type   type;
+        rocfft_result_placement placement;
+        rocfft_array_type       inType;
+        rocfft_array_type       outType;
+        std::vector<size_t>     length;
+        size_t                  batch;
+        size_t                  inOffset[2];
+        size_t                  outOffset[2];
+    };
+    const std::vector<OffsetCase> cases = {{rocfft_transform_type_complex_forward,
+                                            rocfft_placement_notinplace,
+                                            rocfft_array_type_complex_interleaved,
+                                            rocfft_array_type_complex_interleaved,
+                                            {64},
+                                            2,
+                                            {5, 0},
+                                            {3, 0}},
+                                           {rocfft_transform_type_complex_inverse,
+                                            rocfft_placement_notinplace,
+                                            rocfft_array_type_complex_planar,
+                                            rocfft_array_type_complex_planar,
+                                            {8, 16},
+                                            1,
+                                            {3, 11},
+                                            {2, 9}},
+                                           {rocfft_transform_type_complex_forward,
+                                            rocfft_placement_inplace,
+                                            rocfft_array_type_complex_interleaved,
+                                            rocfft_array_type_complex_interleaved,
+                                            {32},
+                                            3,
+                                            {6, 0},
+                                            {6, 0}},
+                                           {rocfft_transform_type_real_forward,
+                                            rocfft_placement_notinplace,
+                                            rocfft_array_type_real,
+                                            rocfft_array_type_hermitian_interleaved,
+                                            {100},
+                                            2,
+                                            {7, 0},
+                                            {4, 0}},
+                                           {rocfft_transform_type_real_inverse,
+                                            rocfft_placement_notinplace,
+                                            rocfft_array_type_hermitian_planar,
+                                            rocfft_array_type_real,
+                                            {30},
+                                            1,
+                                            {1, 5},
+                                            {9, 0}},
+                                           {rocfft_transform_type_real_forward,
+                                            rocfft_placement_inplace,
+                                            rocfft_array_type_real,
+                                            rocfft_array_type_hermitian_interleaved,
+                                            {64},
+                                            2,
+                                            {6, 0},
+                                            {3, 0}}};
+
+    for(const auto& c : cases)
+    {
+        size_t N = 1;
+        for(auto l : c.length)
+            N *= l;
+        const bool inplace = c.placement == rocfft_placement_inplace;
+
+        // doubles per element, components and doubles per batch member of
+        // each component for the array types
+        auto elemDoubles = [](const rocfft_array_type t) -> size_t {
+            return (t == rocfft_array_type_complex_interleaved
+                    || t == rocfft_array_type_hermitian_interleaved)
+                       ? 2
+                       : 1;
+        };
+        auto comps = [](const rocfft_array_type t) -> size_t {
+            return (t == rocfft_array_type_complex_planar
+                    || t == rocfft_array_type_hermitian_planar)
+                       ? 2
+                       : 1;
+        };
+        auto memberDoubles = [&](const rocfft_array_type t) -> size_t {
+            const bool herm = t == rocfft_array_type_hermitian_interleaved
+                              || t == rocfft_array_type_hermitian_planar;
+            return elemDoubles(t) * (herm ? N / c.length[0] * (c.length[0] / 2 + 1) : N);
+        };
+
+        // output of the transform of a fixed input, with the data of both
+        // sides at the given offsets, and the offsets stripped again
+        auto run = [&](const size_t* inOffset, const size_t* outOffset) {
+            rocfft_plan_description desc = NULL;
+            rocfft_plan_description_create(&desc);
+            rocfft_plan_description_set_data_layout(
+                desc, c.inType, c.outType, inOffset, outOffset, 0, NULL, 0, 0, NULL, 0);
+
+            rocfft_plan plan = NULL;
+            EXPECT_TRUE(rocfft_status_success
+                        == rocfft_plan_create(&plan,
+                                              c.placement,
+                                              c.type,
+                                              rocfft_precision_double,
+                                              c.length.size(),
+                                              c.length.data(),
+                                              c.batch,
+                                              desc));
+
+            size_t workBufferSize = 0;
+            rocfft_plan_get_work_buffer_size(plan, &workBufferSize);
+            std::vector<char> workBuffer(workBufferSize);
+
+            rocfft_execution_info info = NULL;
+            rocfft_execution_info_create(&info);
+            rocfft_execution_info_set_backend(info, rocfft_execution_backend_host);
+            rocfft_execution_info_set_work_buffer(info, workBuffer.data(), workBufferSize);
+
+            std::vector<std::vector<double>> x(comps(c.inType)), y(comps(c.outType));
+            void*                            in_buffer[2]  = {NULL, NULL};
+            void*                            out_buffer[2] = {NULL, NULL};
+            for(size_t k = 0; k < x.size(); k++)
+            {
+                // an in-place real transform pads its rows to hold the
+                // hermitian output
+                const size_t skip   = inOffset[k] * elemDoubles(c.inType);
+                const size_t member = inplace ? std::max(memberDoubles(c.inType),
+                                                         memberDoubles(c.outType))
+                                              : memberDoubles(c.inType);
+                x[k].assign(skip + member * c.batch, 0.0);
+                for(size_t i = skip; i < x[k].size(); i++)
+                    x[k][i] = std::sin(0.1 * (i - skip) + k) + std::cos(0.7 * (i - skip));
+                in_buffer[k] = x[k].data();
+            }
+            for(size_t k = 0; k < y.size(); k++)
+            {
+                y[k].assign(outOffset[k] * elemDoubles(c.outType)
+                                + memberDoubles(c.outType) * c.batch,
+                            0.0);
+                out_buffer[k] = y[k].data();
+            }
+            rocfft_execute(plan, in_buffer, inplace ? NULL : out_buffer, info);
+
+            rocfft_execution_info_destroy(info);
+            rocfft_plan_destroy(plan);
+            rocfft_plan_description_destroy(desc);
+
+            std::vector<std::vector<double>> res = inplace ? x : y;
+            for(size_t k = 0; k < res.size(); k++)
+            {
+                const size_t skip = (inplace ? inOffset[k] : outOffset[k])
+                                    * elemDoubles(inplace ? c.inType : c.outType);
+                res[k].erase(res[k].begin(), res[k].begin() + skip);
+            }
+            return res;
+        };
+
+        const size_t zero[2] = {0, 0};
+        const auto   ref     = run(zero, zero);
+        const auto   y       = run(c.inOffset, c.outOffset);
+        ASSERT_EQ(ref.size(), y.size());
+        for(size_t k = 0; k < ref.size(); k++)
+        {
+            ASSERT_EQ(ref[k].size(), y[k].size());
+            for(size_t i = 0; i < ref[k].size(); i++)
+                EXPECT_NEAR(ref[k][i], y[k][i], 1e-12 * (1 + std::abs(ref[k][i])));
+        }
+    }
+
+    // in-place offsets have to address the same data on both sides
+    const size_t length       = 64;
+    const size_t inOffset[2]  = {3, 0};
+    const size_t outOffset[2] = {3, 0};
+
+    rocfft_plan_description desc = NULL;
+    rocfft_plan_description_create(&desc);
+    rocfft_plan_description_set_data_layout(desc,
+                                            rocfft_array_type_real,
+                                            rocfft_array_type_hermitian_interleaved,
+                                            inOffset,
+                                            outOffset,
+                                            0,
+                                            NULL,
+                                            0,
+                                            0,
+                                            NULL,
+                                            0);
+
+    rocfft_plan plan = NULL;
+    EXPECT_EQ(rocfft_status_invalid_offset,
+              rocfft_plan_create(&plan,
+                                 rocfft_placement_inplace,
+                                 rocfft_transform_type_real_forward,
+                                 rocfft_precision_double,
+                                 1,
+                                 &length,
+                                 1,
+                                 desc));
+    rocfft_plan_destroy(plan);
+    rocfft_plan_description_destroy(desc);
+}
+
+// One rank of a distributed transform of x, in its own process; returns
+// whether its part of the output matches ref
+static bool DistributedRank(const std::string&                       name,
+                            size_t                                   rank,
+                            size_t                                   ranks,
+                            rocfft_decomposition                     decomposition,
+                            const size_t*                            grid,
+                            const size_t*                            len,
+                            const std::vector<std::complex<double>>& x,
+                            const std::vector<std::complex<double>>& ref)
+{
+    // small mailboxes, so exchanges are done in several pieces
+    rocfft_transport transport = NULL;
+    if(rocfft_transport_create_shared_memory(&transport, name.c_str(), rank, ranks, 256)
+       != rocfft_status_success)
+        return false;
+
+    rocfft_distributed_plan plan = NULL;
+    if(rocfft_distributed_plan_create(&plan,
+                                      rocfft_transform_type_complex_forward,
+                                      rocfft_precision_double,
+                                      len,
+                                      decomposition,
+                                      grid,
+                                      transport)
+       != rocfft_status_success)
+        return false;
+
+    size_t inStart[3], inCount[3], inStrides[3], outStart[3], outCount[3], outStrides[3];
+    rocfft_distributed_plan_get_layout(
+        plan, inStart, inCount, inStrides, outStart, outCount, outStrides);
+
+    std::vector<std::complex<double>> in(inCount[0] * inCount[1] * inCount[2]), out(in.size());
+    for(size_t k = 0; k < inCount[2]; k++)
+        for(size_t j = 0; j < inCount[1]; j++)
+            for(size_t i = 0; i < inCount[0]; i++)
+                in[i * inStrides[0] + j * inStrides[1] + k * inStrides[2]]
+                    = x[(i + inStart[0]) + len[0] * ((j + inStart[1]) + len[1] * (k + inStart[2]))];
+
+    size_t workBufferSize = 0;
+    rocfft_distributed_plan_get_work_buffer_size(plan, &workBufferSize);
+    std::vector<char> workBuffer(workBufferSize);
+
+    rocfft_execution_info info = NULL;
+    rocfft_execution_info_create(&info);
+    rocfft_execution_info_set_backend(info, rocfft_execution_backend_host);
+    rocfft_execution_info_set_work_buffer(info, workBuffer.data(), workBufferSize);
+
+    bool ok = rocfft_distributed_execute(plan, in.data(), out.data(), info)
+              == rocfft_status_success;
+    for(size_t k = 0; k < outCount[2]; k++)
+        for(size_t j = 0; j < outCount[1]; j++)
+            for(size_t i = 0; i < outCount[0]; i++)
+            {
+                const auto& r = ref[(i + outStart[0])
+                                    + len[0] * ((j + outStart[1]) + len[1] * (k + outStart[2]))];
+                const auto& y = out[i * outStrides[0] + j * outStrides[1] + k * outStrides[2]];
+                ok = ok && std::abs(y - r) < 1e-9 * (1 + std::abs(r));
+            }
+
+    rocfft_execution_info_destroy(info);
+    rocfft_distributed_plan_destroy(plan);
+    rocfft_transport_destroy(transport);
+    return ok;
+}
+
+// Slab and pencil distributed transforms, with a process per rank talking
+// through the shared memory transport, against a 3D plan.  The library is
+// not fork-safe, so each rank runs this test again in a new image of the
+// test binary, told its case and rank by ROCFFT_TEST_DISTRIBUTED_RANK.
+TEST(rocfft_UnitTest, host_backend_distributed)
+{
+    const size_t len[3] = {8, 12, 12};
+    const size_t total  = len[0] * len[1] * len[2];
+
+    std::vector<std::complex<double>> x(total), ref(total);
+    for(size_t i = 0; i < total; i++)
+        x[i] = std::complex<double>(std::sin(0.1 * i), std::cos(0.3 * i));
+
+    rocfft_plan plan = NULL;
+    ASSERT_TRUE(rocfft_status_success
+                == rocfft_plan_create(&plan,
+                                      rocfft_placement_notinplace,
+                                      rocfft_transform_type_complex_forward,
+                                      rocfft_precision_double,
+                                      3,
+                                      len,
+                                      1,
+                                      NULL));
+    size_t workBufferSize = 0;
+    rocfft_plan_get_work_buffer_size(plan, &workBufferSize);
+    std::vector<char>     workBuffer(workBufferSize);
+    rocfft_execution_info info = NULL;
+    rocfft_execution_info_create(&info);
+    rocfft_execution_info_set_backend(info, rocfft_execution_backend_host);
+    rocfft_execution_info_set_work_buffer(info, workBuffer.data(), workBufferSize);
+    void* in_buffer[1]  = {x.data()};
+    void* out_buffer[1] = {ref.data()};
+    rocfft_execute(plan, in_buffer, out_buffer, info);
+    rocfft_execution_info_destroy(info);
+    rocfft_plan_destroy(plan);
+
+    struct DistCase
+    {
+        rocfft_decomposition decomposition;
+        size_t               ranks;
+        size_t               grid[2];
+    };
+    const std::vector<DistCase> cases = {{rocfft_decomposition_slab, 3, {0, 0}},
+                                         {rocfft_decomposition_slab, 4, {0, 0}},
+                                         {rocfft_decomposition_pencil, 6, {2, 3}},
+                                         {rocfft_decomposition_pencil, 4, {4, 1}}};
+
+    // one rank of a case: "<case> <rank> <segment name>"
+    if(const char* rankEnv = getenv("ROCFFT_TEST_DISTRIBUTED_RANK"))
+    {
+        size_t c = 0, rank = 0;
+        char   name[256];
+        if(sscanf(rankEnv, "%zu %zu %255s", &c, &rank, name) != 3 || c >= cases.size())
+            _exit(2);
+        const auto& dc = cases[c];
+        _exit(DistributedRank(name, rank, dc.ranks, dc.decomposition, dc.grid, len, x, ref) ? 0
+                                                                                           : 1);
+    }
+
+    extern char**            environ;
+    const std::string        filter = "--gtest_filter=rocfft_UnitTest.host_backend_distributed";
+    std::vector<std::string> baseEnv;
+    for(char** e = environ; *e != NULL; e++)
+    {
+        if(strncmp(*e, "ROCFFT_TEST_DISTRIBUTED_RANK=", 29) != 0)
+            baseEnv.push_back(*e);
+    }
+
+    for(size_t c = 0; c < cases.size(); c++)
+    {
+        const auto&       dc   = cases[c];
+        const std::string name = "/rocfft_unit_test_" + std::to_string(getpid()) + "_"
+                                 + std::to_string(c);
+
+        std::vector<pid_t> children;
+        for(size_t rank = 0; rank < dc.ranks; rank++)
+        {
+            // only exec between fork and exit, so everything is built here
+            std::vector<std::string> env = baseEnv;
+            env.push_back("ROCFFT_TEST_DISTRIBUTED_RANK=" + std::to_string(c) + " "
+                          + std::to_string(rank) + " " + name);
+            std::vector<char*> envp;
+            for(auto& e : env)
+                envp.push_back(&e[0]);
+            envp.push_back(NULL);
+            char  exe[]   = "/proc/self/exe";
+            char* argv[3] = {exe, const_cast<char*>(filter.c_str()), NULL};
+
+            pid_t pid = fork();
+            ASSERT_GE(pid, 0);
+            if(pid == 0)
+            {
+                execve(exe, argv, envp.data());
+                _exit(127);
+            }
+            children.push_back(pid);
+        }
+        for(auto pid : children)
+        {
+            int status = 0;
+            waitpid(pid, &status, 0);
+            EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0) << "case " << c;
+        }
+    }
+
+    // a callback transport only runs at execution, so a single rank can
+    // check the lengths against the decomposition
+    rocfft_transport transport = NULL;
+    ASSERT_EQ(rocfft_status_success,
+              rocfft_transport_create(
+                  &transport,
+                  0,
+                  4,
+                  [](void*, const size_t*, size_t, const void*, void*, size_t) {
+                      return rocfft_status_failure;
+                  },
+                  NULL));
+    const size_t            odd[3]     = {8, 12, 10};
+    const size_t            grid[2]    = {2, 2};
+    const size_t            badGrid[2] = {1, 2};
+    rocfft_distributed_plan dplan      = NULL;
+    EXPECT_EQ(rocfft_status_invalid_dimensions,
+              rocfft_distributed_plan_create(&dplan,
+                                             rocfft_transform_type_complex_forward,
+                                             rocfft_precision_double,
+                                             odd,
+                                             rocfft_decomposition_slab,
+                                             NULL,
+                                             transport));
+    EXPECT_EQ(rocfft_status_invalid_arg_value,
+              rocfft_distributed_plan_create(&dplan,
+                                             rocfft_transform_type_complex_forward,
+                                             rocfft_precision_double,
+                                             len,
+                                             rocfft_decomposition_pencil,
+                                             badGrid,
+                                             transport));
+    ASSERT_EQ(rocfft_status_success,
+              rocfft_distributed_plan_create(&dplan,
+                                             rocfft_transform_type_complex_forward,
+                                             rocfft_precision_double,
+                                             len,
+                                             rocfft_decomposition_pencil,
+                                             grid,
+                                             transport));
+    rocfft_distributed_plan_destroy(dplan);
+    rocfft_transport_destroy(transport);
+}
+
+// Bluestein plans of one length share their chirp tables, which outlive
+// any one of the plans; the work buffer only holds the padded data.
+TEST(rocfft_UnitTest, bluestein_shared_chirp)
+{
+    const size_t N     = 47; // prime, but N - 1 is not smooth enough for Rader
+    const size_t M     = 96; // smallest 2,3,5-smooth length >= 2N - 1
+    const size_t batch = 3;
+
+    rocfft_plan first = NULL, fwd = NULL, inv = NULL;
+    ASSERT_TRUE(rocfft_status_success
+                == rocfft_plan_create(&first,
+                                      rocfft_placement_notinplace,
+                                      rocfft_transform_type_complex_forward,
+                                      rocfft_precision_double,
+                                      1,
+                                      &N,
+                                      1,
+                                      NULL));
+    ASSERT_TRUE(rocfft_status_success
+                == rocfft_plan_create(&fwd,
+                                      rocfft_placement_notinplace,
+                                      rocfft_transform_type_complex_forward,
+                                      rocfft_precision_double,
+                                      1,
+                                      &N,
+                                      batch,
+                                      NULL));
+    ASSERT_TRUE(rocfft_status_success
+                == rocfft_plan_create(&inv,
+                                      rocfft_placement_inplace,
+                                      rocfft_transform_type_complex_inverse,
+                                      rocfft_precision_double,
+                                      1,
+                                      &N,
+                                      batch,
+                                      NULL));
+
+    size_t workBufferSize = 0;
+    rocfft_plan_get_work_buffer_size(first, &workBufferSize);
+    EXPECT_EQ(M * sizeof(std::complex<double>), workBufferSize);
+    rocfft_plan_destroy(first);
+
+    std::vector<std::complex<double>> x(N * batch), y(N * batch);
+    for(size_t i = 0; i < x.size(); i++)
+        x[i] = std::complex<double>(std::sin(0.1 * i), std::cos(0.3 * i));
+
+    rocfft_plan_get_work_buffer_size(fwd, &workBufferSize);
+    std::vector<char> workBuffer(workBufferSize);
+
+    rocfft_execution_info info = NULL;
+    rocfft_execution_info_create(&info);
+    rocfft_execution_info_set_backend(info, rocfft_execution_backend_host);
+    rocfft_execution_info_set_work_buffer(info, workBuffer.data(), workBufferSize);
+
+    void* in_buffer[1]  = {x.data()};
+    void* out_buffer[1] = {y.data()};
+    rocfft_execute(fwd, in_buffer, out_buffer, info);
+    rocfft_execute(inv, out_buffer, NULL, info);
+
+    for(size_t i = 0; i < x.size(); i++)
+        EXPECT_NEAR(0, std::abs(y[i] / double(N) - x[i]), 1e-12);
+
+    rocfft_execution_info_destroy(info);
+    rocfft_plan_destroy(fwd);
+    rocfft_plan_destroy(inv);
+}
+
+// Plans created in measure mode give the same transform as the cost model.
+TEST(rocfft_UnitTest, plan_mode_measure)
+{
+    const size_t N     = 6000;
+    const size_t batch = 2;
+
+    std::vector<std::complex<double>> x(N * batch);
+    for(size_t i = 0; i < x.size(); i++)
+        x[i] = std::complex<double>(std::sin(0.1 * i), std::cos(0.3 * i));
+
+    std::vector<std::complex<double>> y[2];
+    for(auto mode : {rocfft_plan_mode_estimate, rocfft_plan_mode_measure})
+    {
+        rocfft_plan_description desc = NULL;
+        rocfft_plan_description_create(&desc);
+        EXPECT_TRUE(rocfft_status_success
+                    == rocfft_plan_description_set_plan_mode(desc, mode, 1.0));
+        EXPECT_TRUE(rocfft_status_success
+                    == rocfft_plan_description_set_execution_backend(
+                        desc, rocfft_execution_backend_host));
+
+        rocfft_plan plan = NULL;
+        ASSERT_TRUE(rocfft_status_success
+                    == rocfft_plan_create(&plan,
+                                          rocfft_placement_notinplace,
+                                          rocfft_transform_type_complex_forward,
+                                          rocfft_precision_double,
+                                          1,
+                                          &N,
+                                          batch,
+                                          desc));
+
+        size_t workBufferSize = 0;
+        rocfft_plan_get_work_buffer_size(plan, &workBufferSize);
+        std::vector<char> workBuffer(workBufferSize);
+
+        rocfft_execution_info info = NULL;
+        rocfft_execution_info_create(&info);
+        rocfft_execution_info_set_backend(info, rocfft_execution_backend_host);
+        rocfft_execution_info_set_work_buffer(info, workBuffer.data(), workBufferSize);
+
+        std::vector<std::complex<double>>& out = y[mode == rocfft_plan_mode_estimate ? 0 : 1];
+        out.resize(N * batch);
+        void* in_buffer[1]  = {x.data()};
+        void* out_buffer[1] = {out.data()};
+        rocfft_execute(plan, in_buffer, out_buffer, info);
+
+        rocfft_execution_info_destroy(info);
+        rocfft_plan_destroy(plan);
+        rocfft_plan_description_destroy(desc);
+    }
+
+    for(size_t i = 0; i < N * batch; i++)
+        EXPECT_NEAR(0, std::abs(y[0][i] - y[1][i]), 1e-9 * N);
+}
+
+// Wisdom recorded by a measured plan exports and imports back.
+TEST(rocfft_UnitTest, wisdom_export_import)
+{
+    const size_t N = 8192;
+
+    rocfft_plan_description desc = NULL;
+    rocfft_plan_description_create(&desc);
+    rocfft_plan_description_set_plan_mode(desc, rocfft_plan_mode_measure, 1.0);
+    rocfft_plan_description_set_execution_backend(desc, rocfft_execution_backend_host);
+
+    rocfft_plan plan = NULL;
+    ASSERT_TRUE(rocfft_status_success
+                == rocfft_plan_create(&plan,
+                                      rocfft_placement_notinplace,
+                                      rocfft_transform_type_complex_forward,
+                                      rocfft_precision_single,
+                                      1,
+                                      &N,
+                                      1,
+                                      desc));
+    rocfft_plan_destroy(plan);
+    rocfft_plan_description_destroy(desc);
+
+    size_t size = 0;
+    EXPECT_TRUE(rocfft_status_success == rocfft_wisdom_export_to_buffer(NULL, &size));
+    ASSERT_GT(size, 1);
+
+    std::vector<char> wisdom(size);
+    size_t            small = size - 1;
+    EXPECT_TRUE(rocfft_status_success != rocfft_wisdom_export_to_buffer(wisdom.data(), &small));
+    EXPECT_TRUE(rocfft_status_success == rocfft_wisdom_export_to_buffer(wisdom.data(), &size));
+    EXPECT_TRUE(std::string(wisdom.data()).find("plan 1 8192") != std::string::npos);
+
+    EXPECT_TRUE(rocfft_status_success == rocfft_wisdom_import_from_buffer(wisdom.data(), size));
+
+    const char garbage[] = "rocfft_wisdom 2\nplan 1 8192 oops\n";
+    EXPECT_TRUE(rocfft_status_success
+                != rocfft_wisdom_import_from_buffer(garbage, sizeof(garbage)));
+
+    // a decision count beyond the text and an enumeration out of range are
+    // rejected as well
+    const std::string text(wisdom.data());
+    const std::string count = "decisions ";
+    std::string       huge  = text;
+    const size_t      pos   = huge.find(count) + count.size();
+    huge.replace(pos, huge.find('\n', pos) - pos, "18446744073709551615");
+    EXPECT_TRUE(rocfft_status_success
+                != rocfft_wisdom_import_from_buffer(huge.c_str(), huge.size() + 1));
+
+    const std::string planLine = "plan 1 8192 1 1 1 1 ";
+    std::string       badEnum  = text;
+    ASSERT_TRUE(badEnum.find(planLine) != std::string::npos);
+    badEnum.replace(badEnum.find(planLine), planLine.size(), "plan 1 8192 1 1 1 9 ");
+    EXPECT_TRUE(rocfft_status_success
+                != rocfft_wisdom_import_from_buffer(badEnum.c_str(), badEnum.size() + 1));
+}
+
+TEST(rocfft_UnitTest, host_backend_threads)
+{
+    // batched 2D transform, spread over several threads or run on one
+    const size_t lengths[2] = {64, 64};
+    const size_t batch      = 16;
+    const size_t size       = lengths[0] * lengths[1] * batch;
+
+    std::vector<std::complex<double>> x(size);
+    for(size_t i = 0; i < size; i++)
+        x[i] = std::complex<double>(std::sin(0.1 * i), std::cos(0.3 * i));
+
+    rocfft_plan plan = NULL;
+    ASSERT_TRUE(rocfft_status_success
+                == rocfft_plan_create(&plan,
+                                      rocfft_placement_notinplace,
+                                      rocfft_transform_type_complex_forward,
+                                      rocfft_precision_double,
+                                      2,
+                                      lengths,
+                                      batch,
+                                      NULL));
+
+    size_t workBufferSize = 0;
+    rocfft_plan_get_work_buffer_size(plan, &workBufferSize);
+    std::vector<char> workBuffer(workBufferSize);
+
+    std::vector<std::complex<double>> y[2];
+    for(size_t threads : {1, 8})
+    {
+        std::vector<std::complex<double>>& out = y[threads == 1 ? 0 : 1];
+        out.resize(size);
+
+        rocfft_execution_info info = NULL;
+        rocfft_execution_info_create(&info);
+        rocfft_execution_info_set_backend(info, rocfft_execution_backend_host);
+        EXPECT_TRUE(rocfft_status_success
+                    == rocfft_execution_info_set_thread_count(info, threads));
+        rocfft_execution_info_set_work_buffer(info, workBuffer.data(), workBufferSize);
+
+        void* in_buffer[1]  = {x.data()};
+        void* out_buffer[1] = {out.data()};
+        rocfft_execute(plan, in_buffer, out_buffer, info);
+
+        rocfft_execution_info_destroy(info);
+    }
+
+    // every row is computed the same way whichever thread runs it
+    for(size_t i = 0; i < size; i++)
+        EXPECT_EQ(y[0][i], y[1][i]);
+
+    // alternate small and large jobs, so that workers left out of a small
+    // job wake up while the next one starts
+    std::vector<std::complex<double>> z(size);
+    for(size_t run = 0; run < 64; run++)
+    {
+        rocfft_execution_info info = NULL;
+        rocfft_execution_info_create(&info);
+        rocfft_execution_info_set_backend(info, rocfft_execution_backend_host);
+        rocfft_execution_info_set_thread_count(info, (run % 2) ? 2 : 8);
+        rocfft_execution_info_set_work_buffer(info, workBuffer.data(), workBufferSize);
+
+        void* in_buffer[1]  = {x.data()};
+        void* out_buffer[1] = {z.data()};
+        rocfft_execute(plan, in_buffer, out_buffer, info);
+
+        rocfft_execution_info_destroy(info);
+    }
+    for(size_t i = 0; i < size; i++)
+        EXPECT_EQ(y[0][i], z[i]);
+
+    rocfft_plan_destroy(plan);
+}
+
 TEST(rocfft_UnitTest, plan_description)
 {
     rocfft_plan_description desc = nullptr;
@@ -56,6 +56,19 @@ typedef struct rocfft_plan_description_t* rocfft_plan_description;
  *  */
 typedef struct rocfft_execution_info_t* rocfft_execution_info;
 
+/*! @brief Pointer type to transport structure
+ *  @details This type is used to declare a transport handle, which moves data
+ * between the ranks of a distributed plan. It can be initialized with
+ * rocfft_transport_create or rocfft_transport_create_shared_memory
+ *  */
+typedef struct rocfft_transport_t* rocfft_transport;
+
+/*! @brief Pointer type to distributed plan structure
+ *  @details This type is used to declare a distributed plan handle that can be
+ * initialized with rocfft_distributed_plan_create
+ *  */
+typedef struct rocfft_distributed_plan_t* rocfft_distributed_plan;
+
 /*! @brief rocfft status/error codes */
 typedef enum rocfft_status_e
 {
@@ -111,6 +124,48 @@ typedef enum rocfft_execution_mode_e
     rocfft_exec_mode_blocking,
 } rocfft_execution_mode;
 
+/*! @brief Execution backend */
+typedef enum rocfft_execution_backend_e
+{
+    rocfft_execution_backend_device,
+    rocfft_execution_backend_host,
+} rocfft_execution_backend;
+
+/*! @brief Plan creation mode */
+typedef enum rocfft_plan_mode_e
+{
+    rocfft_plan_mode_estimate,
+    rocfft_plan_mode_measure,
+} rocfft_plan_mode;
+
+/*! @brief Decomposition of a distributed transform */
+typedef enum rocfft_decomposition_e
+{
+    rocfft_decomposition_slab,
+    rocfft_decomposition_pencil,
+} rocfft_decomposition;
+
+/*! @brief Exchange function of a user transport
+ *  @details Called by the transport with the context given to
+ * rocfft_transport_create.  The ranks listed in group (ascending, including
+ * the calling rank) exchange bytes_per_rank bytes with each other: block i
+ * of send_buffer goes to group[i], and block i of recv_buffer is filled
+ * from group[i].  Every rank of a group makes the same sequence of calls.
+ *
+ * rocfft_distributed_execute calls it from a helper thread, while the next
+ * chunk is transformed; calls are never concurrent with each other, but
+ * they do not come from the thread that called rocfft_distributed_execute.
+ * An MPI exchange therefore needs MPI initialized with at least
+ * MPI_THREAD_SERIALIZED, and no other thread may make MPI calls during the
+ * execution.
+ *  */
+typedef rocfft_status (*rocfft_transport_exchange_func)(void*         context,
+                                                        const size_t* group,
+                                                        size_t        group_size,
+                                                        const void*   send_buffer,
+                                                        void*         recv_buffer,
+                                                        size_t        bytes_per_rank);
+
 /*! @brief Library setup function, called once in program before start of
  * library use */
 ROCFFT_EXPORT rocfft_status rocfft_setup();
@@ -175,6 +230,10 @@ ROCFFT_EXPORT rocfft_status rocfft_plan_create(rocfft_plan*                  pla
  *  serves as a way for the user to control execution, as well as for the
  * library to pass any execution
  *  related information back to the user.
+ *  On the device backend, rocfft_status_invalid_dimensions is returned if a
+ * kernel of the plan needs a larger grid than the device provides even for a
+ * single batch member, and rocfft_status_failure if the device tables of a
+ * plan created for the host backend cannot be allocated.
  *
  *  @param[in] plan plan handle
  *  @param[in,out] in_buffer array (of size 1 for interleaved data, of size 2
@@ -197,21 +256,29 @@ ROCFFT_EXPORT rocfft_status rocfft_execute(const rocfft_plan     plan,
  *  */
 ROCFFT_EXPORT rocfft_status rocfft_plan_destroy(rocfft_plan plan);
 
-#if 0
 /*! @brief Set scaling factor in single precision
- *  @details This is one of plan description functions to specify optional additional plan properties using the description handle. This API specifies scaling factor.
+ *  @details This is one of plan description functions to specify optional
+ * additional plan properties using the description handle. This API specifies
+ * scaling factor.  The output of the transform is multiplied by the factor
+ * as it is stored, the default is 1.
  *  @param[in] description description handle
  *  @param[in] scale scaling factor
  *  */
-ROCFFT_EXPORT rocfft_status rocfft_plan_description_set_scale_float( rocfft_plan_description description, const float scale );
+ROCFFT_EXPORT rocfft_status
+    rocfft_plan_description_set_scale_float(rocfft_plan_description description,
+                                            const float             scale);
 
 /*! @brief Set scaling factor in double precision
- *  @details This is one of plan description functions to specify optional additional plan properties using the description handle. This API specifies scaling factor.
+ *  @details This is one of plan description functions to specify optional
+ * additional plan properties using the description handle. This API specifies
+ * scaling factor.  The output of the transform is multiplied by the factor
+ * as it is stored, the default is 1.
  *  @param[in] description description handle
  *  @param[in] scale scaling factor
  *  */
-ROCFFT_EXPORT rocfft_status rocfft_plan_description_set_scale_double( rocfft_plan_description description, const double scale );
-#endif
+ROCFFT_EXPORT rocfft_status
+    rocfft_plan_description_set_scale_double(rocfft_plan_description description,
+                                             const double            scale);
 
 /*!
  *  @brief Set data layout
@@ -230,6 +297,12 @@ ROCFFT_EXPORT rocfft_status rocfft_plan_description_set_scale_double( rocfft_pla
  *  library will choose appropriate defaults if offsets/strides are
  *  set to null ptr and/or distances set to 0.
  * 
+ *  An in-place transform reads and writes the same buffer, so its input
+ *  and output offsets must address the same position in it: they must be
+ *  equal for complex transforms, and the real offset must be twice the
+ *  hermitian offset for real transforms.  Plan creation returns
+ *  rocfft_status_invalid_offset otherwise.
+ * 
  *  @param[in, out] description description handle
  *  @param[in] in_array_type array type of input buffer
  *  @param[in] out_array_type array type of output buffer
@@ -258,6 +331,74 @@ ROCFFT_EXPORT rocfft_status
                                             const size_t*           out_strides,
                                             const size_t            out_distance);
 
+/*! @brief Set plan creation mode in plan description
+ *  @details This is one of plan description functions to specify optional
+ * additional plan properties using the description handle. This API specifies
+ * how the library decomposes the transform.
+ *  With rocfft_plan_mode_estimate (the default) the decompositions are chosen
+ * with a cost model. With rocfft_plan_mode_measure the candidate
+ * decompositions are timed on the backend of the description when the plan is
+ * created, and the fastest one is kept and remembered as wisdom for later
+ * plans of the same problem.
+ *  @param[in, out] description description handle
+ *  @param[in] mode plan creation mode
+ *  @param[in] time_limit seconds that measuring may take; 0 for no limit
+ *  */
+ROCFFT_EXPORT rocfft_status
+    rocfft_plan_description_set_plan_mode(rocfft_plan_description description,
+                                          rocfft_plan_mode        mode,
+                                          double                  time_limit);
+
+/*! @brief Set the execution backend a plan is built for in plan description
+ *  @details This is one of plan description functions to specify optional
+ * additional plan properties using the description handle. This API specifies
+ * the backend whose cost model, or whose timings in
+ * rocfft_plan_mode_measure, choose the decompositions of the transform. The
+ * default is the default execution backend. The plan can still be executed
+ * on either backend; the backend of the execution info decides where it runs.
+ * Plans built for the host backend allocate no device memory until they are
+ * first executed on the device.
+ *  @param[in, out] description description handle
+ *  @param[in] backend execution backend
+ *  */
+ROCFFT_EXPORT rocfft_status
+    rocfft_plan_description_set_execution_backend(rocfft_plan_description  description,
+                                                  rocfft_execution_backend backend);
+
+/*! @brief Export wisdom to a file
+ *  @details Wisdom holds the decompositions chosen for the plans created in
+ * rocfft_plan_mode_measure. This API writes it as text to the file at path,
+ * so that it can be imported by another process.
+ *  @param[in] path file name
+ *  */
+ROCFFT_EXPORT rocfft_status rocfft_wisdom_export_to_file(const char* path);
+
+/*! @brief Export wisdom to a buffer
+ *  @details This API writes the wisdom text, null terminated, to buffer. If
+ * buffer is null, only the size needed is returned in buffer_size.
+ *  @param[out] buffer buffer of wisdom text
+ *  @param[in, out] buffer_size size of buffer in bytes, set to the size
+ * needed
+ *  */
+ROCFFT_EXPORT rocfft_status rocfft_wisdom_export_to_buffer(char* buffer, size_t* buffer_size);
+
+/*! @brief Import wisdom from a file
+ *  @details This API reads wisdom written by rocfft_wisdom_export_to_file.
+ * Plans created afterwards for the problems it covers use the imported
+ * decompositions, whatever their plan mode, without measuring. Nothing is
+ * imported if the file cannot be parsed.
+ *  @param[in] path file name
+ *  */
+ROCFFT_EXPORT rocfft_status rocfft_wisdom_import_from_file(const char* path);
+
+/*! @brief Import wisdom from a buffer
+ *  @details This API reads wisdom written by rocfft_wisdom_export_to_buffer.
+ *  @param[in] buffer buffer of wisdom text
+ *  @param[in] buffer_size size of buffer in bytes
+ *  */
+ROCFFT_EXPORT rocfft_status rocfft_wisdom_import_from_buffer(const char* buffer,
+                                                             size_t      buffer_size);
+
 /*! @brief Get library version string
  *
  * @param[in, out] buf buffer of version string
@@ -364,6 +505,164 @@ ROCFFT_EXPORT rocfft_status rocfft_execution_info_set_mode( rocfft_execution_inf
 ROCFFT_EXPORT rocfft_status rocfft_execution_info_set_stream(rocfft_execution_info info,
                                                              void*                 stream);
 
+/*! @brief Set execution backend in execution info
+ *  @details This is one of the execution info functions to specify optional
+ * additional information to control execution.
+ *  This API specifies whether the plan is executed by device kernels or on
+ * the host. It has to be called before the call to rocfft_execute.
+ *  With the host backend, the input, output and work buffers passed to the
+ * library are host memory and the stream is ignored.
+ *  The default backend may also be chosen with the environment variable
+ * ROCFFT_EXECUTION_BACKEND, set to "device" or "host".
+ *  @param[in] info execution info handle
+ *  @param[in] backend execution backend
+ *  */
+ROCFFT_EXPORT rocfft_status rocfft_execution_info_set_backend(rocfft_execution_info    info,
+                                                              rocfft_execution_backend backend);
+
+/*! @brief Set the number of host threads in execution info
+ *  @details This is one of the execution info functions to specify optional
+ * additional information to control execution.
+ *  This API specifies how many threads the host backend spreads the work of
+ * each kernel over; it has no effect with the device backend.
+ *  A thread count of 0 (the default) uses the value of the environment
+ * variable ROCFFT_HOST_THREADS if set, or else the number of hardware threads.
+ *  @param[in] info execution info handle
+ *  @param[in] thread_count number of threads
+ *  */
+ROCFFT_EXPORT rocfft_status
+    rocfft_execution_info_set_thread_count(rocfft_execution_info info, size_t thread_count);
+
+/*! @brief Create a transport from a user exchange function
+ *  @details This API wraps an existing communication layer (MPI for example)
+ * so distributed plans can use it.  See rocfft_transport_exchange_func for
+ * the thread exchange is called from.
+ *  @param[out] transport transport handle
+ *  @param[in] rank rank of the calling process, in [0, number_of_ranks)
+ *  @param[in] number_of_ranks number of ranks taking part in the transform
+ *  @param[in] exchange function exchanging equal-sized blocks within a group
+ *  @param[in] context pointer passed back to every call of exchange
+ *  */
+ROCFFT_EXPORT rocfft_status rocfft_transport_create(rocfft_transport*              transport,
+                                                    size_t                         rank,
+                                                    size_t                         number_of_ranks,
+                                                    rocfft_transport_exchange_func exchange,
+                                                    void*                          context);
+
+/*! @brief Create a shared memory transport
+ *  @details This API creates a transport between processes of one host,
+ * through a POSIX shared memory segment.  Each of the number_of_ranks
+ * processes calls it with the same name and its own rank; the call returns
+ * once all of them have attached.  The segment holds number_of_ranks^2
+ * mailboxes of buffer_size bytes, larger exchanges are done in pieces.
+ *  @param[out] transport transport handle
+ *  @param[in] name name of the segment, unique to the job and starting with '/'
+ *  @param[in] rank rank of the calling process, in [0, number_of_ranks)
+ *  @param[in] number_of_ranks number of processes
+ *  @param[in] buffer_size size in bytes of each mailbox; 0 picks a default
+ *  */
+ROCFFT_EXPORT rocfft_status
+    rocfft_transport_create_shared_memory(rocfft_transport* transport,
+                                          const char*       name,
+                                          size_t            rank,
+                                          size_t            number_of_ranks,
+                                          size_t            buffer_size);
+
+/*! @brief Destroy a transport
+ *  @details This API frees the transport of the calling rank only, without
+ * waiting for the other ranks.  A shared memory segment is released once
+ * every rank has destroyed its transport or exited.
+ *  @param[in] transport transport handle
+ *  */
+ROCFFT_EXPORT rocfft_status rocfft_transport_destroy(rocfft_transport transport);
+
+/*! @brief Create a distributed 3D FFT plan
+ *
+ *  @details This API creates a plan for a complex 3D transform whose data is
+ * split over the ranks of a transport.  Every rank calls it with the same
+ * parameters.  As for rocfft_plan_create, lengths[0] is the size of the
+ * innermost dimension.
+ *
+ *  With slab decomposition, each rank holds lengths[2]/P planes of the input
+ * and lengths[1]/P rows along dimension 1 of the output, P being the number
+ * of ranks; grid is ignored.  With pencil decomposition the ranks form a
+ * grid[0] x grid[1] grid: the input is split over dimension 1 by grid[0] and
+ * dimension 2 by grid[1], the output over dimension 0 by grid[0] and
+ * dimension 1 by grid[1].  The lengths have to divide evenly.
+ *
+ *  The local transforms are computed with rocfft plans, and the data is
+ * transposed between ranks in pieces so that the exchange of one piece
+ * overlaps the transform of the next.
+ *
+ *  @param[out] plan distributed plan handle
+ *  @param[in] transform_type rocfft_transform_type_complex_forward or
+ * rocfft_transform_type_complex_inverse
+ *  @param[in] precision precision
+ *  @param[in] lengths 3 transform lengths
+ *  @param[in] decomposition slab or pencil decomposition
+ *  @param[in] grid 2 sized process grid for pencil decomposition
+ *  @param[in] transport transport connecting the ranks
+ *  */
+ROCFFT_EXPORT rocfft_status rocfft_distributed_plan_create(rocfft_distributed_plan* plan,
+                                                           rocfft_transform_type    transform_type,
+                                                           rocfft_precision         precision,
+                                                           const size_t*            lengths,
+                                                           rocfft_decomposition     decomposition,
+                                                           const size_t*            grid,
+                                                           rocfft_transport         transport);
+
+/*! @brief Get the data layout of a distributed plan on this rank
+ *  @details This API gets the part of the global input and output arrays the
+ * calling rank holds: the start index and number of elements in each of the
+ * 3 dimensions, and the strides in elements of the local buffers.
+ *  @param[in] plan distributed plan handle
+ *  @param[out] in_start 3 sized array of input start indices
+ *  @param[out] in_count 3 sized array of input element counts
+ *  @param[out] in_strides 3 sized array of input strides
+ *  @param[out] out_start 3 sized array of output start indices
+ *  @param[out] out_count 3 sized array of output element counts
+ *  @param[out] out_strides 3 sized array of output strides
+ *  */
+ROCFFT_EXPORT rocfft_status
+    rocfft_distributed_plan_get_layout(const rocfft_distributed_plan plan,
+                                       size_t*                       in_start,
+                                       size_t*                       in_count,
+                                       size_t*                       in_strides,
+                                       size_t*                       out_start,
+                                       size_t*                       out_count,
+                                       size_t*                       out_strides);
+
+/*! @brief Get work buffer size of a distributed plan
+ *  @details This API gets the size of the work buffer to set in the execution
+ * info passed to rocfft_distributed_execute.
+ *  @param[in] plan distributed plan handle
+ *  @param[out] size_in_bytes size of needed work buffer in bytes
+ *  */
+ROCFFT_EXPORT rocfft_status rocfft_distributed_plan_get_work_buffer_size(
+    const rocfft_distributed_plan plan, size_t* size_in_bytes);
+
+/*! @brief Execute a distributed plan
+ *  @details All ranks call this API.  The transform is not in-place: the
+ * input buffer holds this rank's part of the input and is overwritten, the
+ * output buffer receives this rank's part of the output.  Both buffers hold
+ * in_count[0]*in_count[1]*in_count[2] complex elements, in the memory of the
+ * execution info backend.
+ *  @param[in] plan distributed plan handle
+ *  @param[in,out] in_buffer input buffer
+ *  @param[out] out_buffer output buffer
+ *  @param[in] info execution info handle created by
+ * rocfft_execution_info_create
+ *  */
+ROCFFT_EXPORT rocfft_status rocfft_distributed_execute(const rocfft_distributed_plan plan,
+                                                       void*                         in_buffer,
+                                                       void*                         out_buffer,
+                                                       rocfft_execution_info         info);
+
+/*! @brief Destroy a distributed plan
+ *  @param[in] plan distributed plan handle
+ *  */
+ROCFFT_EXPORT rocfft_status rocfft_distributed_plan_destroy(rocfft_distributed_plan plan);
+
 #if 0
 /*! @brief Get events from execution info
  *  @details This is one of the execution info functions to retrieve information from execution.
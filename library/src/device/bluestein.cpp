@@ -47,36 +47,31 @@ rocfft_status chirp_launch(
     return rocfft_status_success;
 }
 
-void rocfft_internal_chirp(const void* data_p, void* back_p)
+void rocfft_internal_chirp(size_t           N,
+                           size_t           M,
+                           int              dir,
+                           rocfft_precision precision,
+                           void*            chirp,
+                           void*            twiddles_large,
+                           hipStream_t      rocfft_stream)
 {
-    DeviceCallIn* data = (DeviceCallIn*)data_p;
-
-    size_t N = data->node->length[0];
-    size_t M = data->node->lengthBlue;
-
     int twl = 0;
 
-    if(data->node->large1D > (size_t)256 * 256 * 256 * 256)
+    if(2 * N > (size_t)256 * 256 * 256 * 256)
         printf("large1D twiddle size too large error");
-    else if(data->node->large1D > (size_t)256 * 256 * 256)
+    else if(2 * N > (size_t)256 * 256 * 256)
         twl = 4;
-    else if(data->node->large1D > (size_t)256 * 256)
+    else if(2 * N > (size_t)256 * 256)
         twl = 3;
-    else if(data->node->large1D > (size_t)256)
+    else if(2 * N > (size_t)256)
         twl = 2;
     else
         twl = 1;
 
-    int dir = data->node->direction;
-
-    hipStream_t rocfft_stream = data->rocfft_stream;
-
-    if(data->node->precision == rocfft_precision_single)
-        chirp_launch<float2>(
-            N, M, (float2*)data->bufOut[0], data->node->twiddles_large, twl, dir, rocfft_stream);
+    if(precision == rocfft_precision_single)
+        chirp_launch<float2>(N, M, (float2*)chirp, twiddles_large, twl, dir, rocfft_stream);
     else
-        chirp_launch<double2>(
-            N, M, (double2*)data->bufOut[0], data->node->twiddles_large, twl, dir, rocfft_stream);
+        chirp_launch<double2>(N, M, (double2*)chirp, twiddles_large, twl, dir, rocfft_stream);
 }
 
 void rocfft_internal_mul(const void* data_p, void* back_p)
@@ -98,16 +93,6 @@ void rocfft_internal_mul(const void* data_p, void* back_p)
         scheme = 2; // res mul
     }
 
-    size_t cBytes;
-    if(data->node->precision == rocfft_precision_single)
-    {
-        cBytes = sizeof(float) * 2;
-    }
-    else
-    {
-        cBytes = sizeof(double) * 2;
-    }
-
     void* bufIn0  = data->bufIn[0];
     void* bufOut0 = data->bufOut[0];
     void* bufIn1  = data->bufIn[1];
@@ -119,26 +104,11 @@ void rocfft_internal_mul(const void* data_p, void* back_p)
     // are good enough for current strategy(check TreeNode::ReviseLeafsArrayType).
     // That is why we add asserts below.
 
-    size_t numof = 0;
-    if(scheme == 0)
-    {
-        bufIn0  = ((char*)bufIn0 + M * cBytes);
-        bufOut0 = ((char*)bufOut0 + 2 * M * cBytes);
-
-        numof = M;
-    }
-    else if(scheme == 1)
-    {
-        bufOut0 = ((char*)bufOut0 + M * cBytes);
-
-        numof = M;
-    }
-    else if(scheme == 2)
-    {
-        numof = N;
-    }
+    // the chirp and its FFT come from the plan, the work buffer only holds
+    // the padded data
+    size_t numof = (scheme == 2) ? N : M;
 
-    size_t count = data->node->batch;
+    size_t count = data->batch;
     for(size_t i = 1; i < data->node->length.size(); i++)
         count *= data->node->length[i];
     count *= numof;
@@ -166,6 +136,7 @@ void rocfft_internal_mul(const void* data_p, void* back_p)
                                count,
                                N,
                                M,
+                               (const float2*)data->node->chirp,
                                (const float2*)bufIn0,
                                (float2*)bufOut0,
                                data->node->length.size(),
@@ -173,7 +144,8 @@ void rocfft_internal_mul(const void* data_p, void* back_p)
                                data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,
                                data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,
                                dir,
-                               scheme);
+                               scheme,
+                               (float)data->node->scale);
         }
         else
         {
@@ -186,6 +158,7 @@ void rocfft_internal_mul(const void* data_p, void* back_p)
                                count,
                                N,
                                M,
+                               (const double2*)data->node->chirp,
                                (const double2*)bufIn0,
                                (double2*)bufOut0,
                                data->node->length.size(),
@@ -193,7 +166,8 @@ void rocfft_internal_mul(const void* data_p, void* back_p)
                                data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,
                                data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,
                                dir,
-                               scheme);
+                               scheme,
+                               (double)data->node->scale);
         }
     }
     else if((data->node->inArrayType == rocfft_array_type_complex_planar
@@ -215,6 +189,7 @@ void rocfft_internal_mul(const void* data_p, void* back_p)
                                count,
                                N,
                                M,
+                               (const float2*)data->node->chirp,
                                (const real_type_t<float2>*)bufIn0,
                                (const real_type_t<float2>*)bufIn1,
                                (float2*)bufOut0,
@@ -223,7 +198,8 @@ void rocfft_internal_mul(const void* data_p, void* back_p)
                                data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,
                                data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,
                                dir,
-                               scheme);
+                               scheme,
+                               (float)data->node->scale);
         }
         else
         {
@@ -236,6 +212,7 @@ void rocfft_internal_mul(const void* data_p, void* back_p)
                                count,
                                N,
                                M,
+                               (const double2*)data->node->chirp,
                                (const real_type_t<double2>*)bufIn0,
                                (const real_type_t<double2>*)bufIn1,
                                (double2*)bufOut0,
@@ -244,7 +221,8 @@ void rocfft_internal_mul(const void* data_p, void* back_p)
                                data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,
                                data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,
                                dir,
-                               scheme);
+                               scheme,
+                               (double)data->node->scale);
         }
     }
     else if((data->node->inArrayType == rocfft_array_type_complex_interleaved
@@ -266,6 +244,7 @@ void rocfft_internal_mul(const void* data_p, void* back_p)
                                count,
                                N,
                                M,
+                               (const float2*)data->node->chirp,
                                (const float2*)bufIn0,
                                (real_type_t<float2>*)bufOut0,
                                (real_type_t<float2>*)bufOut1,
@@ -274,7 +253,8 @@ void rocfft_internal_mul(const void* data_p, void* back_p)
                                data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,
                                data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,
                                dir,
-                               scheme);
+                               scheme,
+                               (float)data->node->scale);
         }
         else
         {
@@ -287,6 +267,7 @@ void rocfft_internal_mul(const void* data_p, void* back_p)
                                count,
                                N,
                                M,
+                               (const double2*)data->node->chirp,
                                (const double2*)bufIn0,
                                (real_type_t<double2>*)bufOut0,
                                (real_type_t<double2>*)bufOut1,
@@ -295,7 +276,8 @@ void rocfft_internal_mul(const void* data_p, void* back_p)
                                data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,
                                data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,
                                dir,
-                               scheme);
+                               scheme,
+                               (double)data->node->scale);
         }
     }
     else if((data->node->inArrayType == rocfft_array_type_complex_planar
@@ -318,6 +300,7 @@ void rocfft_internal_mul(const void* data_p, void* back_p)
                                count,
                                N,
                                M,
+                               (const float2*)data->node->chirp,
                                (const real_type_t<float2>*)bufIn0,
                                (const real_type_t<float2>*)bufIn1,
                                (real_type_t<float2>*)bufOut0,
@@ -327,7 +310,8 @@ void rocfft_internal_mul(const void* data_p, void* back_p)
                                data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,
                                data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,
                                dir,
-                               scheme);
+                               scheme,
+                               (float)data->node->scale);
         }
         else
         {
@@ -340,6 +324,7 @@ void rocfft_internal_mul(const void* data_p, void* back_p)
                                count,
                                N,
                                M,
+                               (const double2*)data->node->chirp,
                                (const real_type_t<double2>*)bufIn0,
                                (const real_type_t<double2>*)bufIn1,
                                (real_type_t<double2>*)bufOut0,
@@ -349,7 +334,8 @@ void rocfft_internal_mul(const void* data_p, void* back_p)
                                data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,
                                data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,
                                dir,
-                               scheme);
+                               scheme,
+                               (double)data->node->scale);
         }
     }
     else
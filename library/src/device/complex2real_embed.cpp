@@ -25,13 +25,14 @@
 #include <iostream>
 
 template <typename Tcomplex>
-__global__ static void complex2real_kernel(const size_t           input_size,
-                                           const size_t           idist1D,
-                                           const size_t           odist1D,
-                                           const Tcomplex*        input0,
-                                           const size_t           idist,
-                                           real_type_t<Tcomplex>* output0,
-                                           const size_t           odist)
+__global__ static void complex2real_kernel(const size_t                input_size,
+                                           const size_t                idist1D,
+                                           const size_t                odist1D,
+                                           const Tcomplex*             input0,
+                                           const size_t                idist,
+                                           real_type_t<Tcomplex>*      output0,
+                                           const size_t                odist,
+                                           const real_type_t<Tcomplex> scale)
 {
     const size_t tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
 
@@ -42,7 +43,7 @@ __global__ static void complex2real_kernel(const size_t           input_size,
         const auto input  = input0 + blockIdx.y * idist1D + blockIdx.z * idist;
         auto       output = output0 + blockIdx.y * odist1D + blockIdx.z * odist;
 
-        output[tid] = input[tid].x;
+        output[tid] = scale * input[tid].x;
     }
 }
 
@@ -78,7 +79,7 @@ void complex2real(const void* data_p, void* back_p)
     void* input_buffer  = data->bufIn[0];
     void* output_buffer = data->bufOut[0];
 
-    size_t batch          = data->node->batch;
+    size_t batch          = data->batch;
     size_t high_dimension = 1;
     if(data->node->length.size() > 1)
     {
@@ -128,7 +129,8 @@ void complex2real(const void* data_p, void* back_p)
                            (float2*)input_buffer,
                            input_distance,
                            (float*)output_buffer,
-                           output_distance);
+                           output_distance,
+                           (float)data->node->scale);
     else
         hipLaunchKernelGGL(complex2real_kernel<double2>,
                            grid,
@@ -141,22 +143,24 @@ void complex2real(const void* data_p, void* back_p)
                            (double2*)input_buffer,
                            input_distance,
                            (double*)output_buffer,
-                           output_distance);
+                           output_distance,
+                           (double)data->node->scale);
 
     return;
 }
 
 template <typename T>
-__global__ static void hermitian2complex_kernel(const size_t hermitian_size,
-                                                const size_t dim_0,
-                                                const size_t dim_1,
-                                                const size_t dim_2,
-                                                const size_t input_stride,
-                                                const size_t output_stride,
-                                                T*           input,
-                                                const size_t input_distance,
-                                                T*           output,
-                                                const size_t output_distance)
+__global__ static void hermitian2complex_kernel(const size_t         hermitian_size,
+                                                const size_t         dim_0,
+                                                const size_t         dim_1,
+                                                const size_t         dim_2,
+                                                const size_t         input_stride,
+                                                const size_t         output_stride,
+                                                T*                   input,
+                                                const size_t         input_distance,
+                                                T*                   output,
+                                                const size_t         output_distance,
+                                                const real_type_t<T> scale)
 {
     const size_t tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
 
@@ -187,13 +191,13 @@ __global__ static void hermitian2complex_kernel(const size_t hermitian_size,
 
     if((is0 == 0) || (is0 * 2 == dim_0)) // simply write the element to output
     {
-        outputs[0] = input[0];
+        outputs[0] = scale * input[0];
         return;
     }
 
     if(is0 < hermitian_size)
     {
-        T res      = input[0];
+        T res      = scale * input[0];
         outputs[0] = res;
         res.y      = -res.y;
         outputc[0] = res;
@@ -201,17 +205,18 @@ __global__ static void hermitian2complex_kernel(const size_t hermitian_size,
 }
 
 template <typename T>
-__global__ static void hermitian2complex_kernel(const size_t    hermitian_size,
-                                                const size_t    dim_0,
-                                                const size_t    dim_1,
-                                                const size_t    dim_2,
-                                                const size_t    input_stride,
-                                                const size_t    output_stride,
-                                                real_type_t<T>* inputRe,
-                                                real_type_t<T>* inputIm,
-                                                const size_t    input_distance,
-                                                T*              output,
-                                                const size_t    output_distance)
+__global__ static void hermitian2complex_kernel(const size_t         hermitian_size,
+                                                const size_t         dim_0,
+                                                const size_t         dim_1,
+                                                const size_t         dim_2,
+                                                const size_t         input_stride,
+                                                const size_t         output_stride,
+                                                real_type_t<T>*      inputRe,
+                                                real_type_t<T>*      inputIm,
+                                                const size_t         input_distance,
+                                                T*                   output,
+                                                const size_t         output_distance,
+                                                const real_type_t<T> scale)
 {
     const size_t tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
 
@@ -243,17 +248,17 @@ __global__ static void hermitian2complex_kernel(const size_t    hermitian_size,
 
     if((is0 == 0) || (is0 * 2 == dim_0)) // simply write the element to output
     {
-        outputs[0].x = inputRe[0];
-        outputs[0].y = inputIm[0];
+        outputs[0].x = scale * inputRe[0];
+        outputs[0].y = scale * inputIm[0];
         return;
     }
 
     if(is0 < hermitian_size)
     {
-        outputs[0].x = inputRe[0];
-        outputs[0].y = inputIm[0];
-        outputc[0].x = inputRe[0];
-        outputc[0].y = -inputIm[0];
+        outputs[0].x = scale * inputRe[0];
+        outputs[0].y = scale * inputIm[0];
+        outputc[0].x = scale * inputRe[0];
+        outputc[0].y = -scale * inputIm[0];
     }
 }
 
@@ -292,7 +297,7 @@ void hermitian2complex(const void* data_p, void* back_p)
     void* input_buffer  = data->bufIn[0];
     void* output_buffer = data->bufOut[0];
 
-    size_t batch          = data->node->batch;
+    size_t batch          = data->batch;
     size_t high_dimension = 1;
     if(data->node->length.size() > 1)
     {
@@ -359,7 +364,8 @@ void hermitian2complex(const void* data_p, void* back_p)
                                (float2*)input_buffer,
                                input_distance,
                                (float2*)output_buffer,
-                               output_distance);
+                               output_distance,
+                               (float)data->node->scale);
         else
             hipLaunchKernelGGL(hermitian2complex_kernel<double2>,
                                grid,
@@ -375,7 +381,8 @@ void hermitian2complex(const void* data_p, void* back_p)
                                (double2*)input_buffer,
                                input_distance,
                                (double2*)output_buffer,
-                               output_distance);
+                               output_distance,
+                               (double)data->node->scale);
     }
     else if(data->node->inArrayType == rocfft_array_type_hermitian_planar)
     {
@@ -395,7 +402,8 @@ void hermitian2complex(const void* data_p, void* back_p)
                                (float*)data->bufIn[1],
                                input_distance,
                                (float2*)output_buffer,
-                               output_distance);
+                               output_distance,
+                               (float)data->node->scale);
         else
             hipLaunchKernelGGL(hermitian2complex_kernel<double2>,
                                grid,
@@ -412,7 +420,8 @@ void hermitian2complex(const void* data_p, void* back_p)
                                (double*)data->bufIn[1],
                                input_distance,
                                (double2*)output_buffer,
-                               output_distance);
+                               output_distance,
+                               (double)data->node->scale);
     }
 
     // float2* tmpo; tmpo = (float2*)malloc(sizeof(float2)*output_distance*batch);
@@ -427,3 +436,274 @@ void hermitian2complex(const void* data_p, void* back_p)
     //     }
     // }
 }
+
+// Element k of the full transform of a real batch member, read from its
+// hermitian half.  Elements stored for both k and -k are replaced by their
+// hermitian part, as taking the real part of the embedded transform would do.
+template <typename Tcomplex>
+__device__ static Tcomplex pair_hermitian_element(const Tcomplex* input,
+                                                  const size_t    hermitian_size,
+                                                  const size_t    dim_0,
+                                                  const size_t    k0,
+                                                  const size_t    offset,
+                                                  const size_t    mirror_offset,
+                                                  const size_t    stride0)
+{
+    Tcomplex res;
+    if(k0 == 0 || 2 * k0 == dim_0)
+    {
+        const Tcomplex s  = input[offset + k0 * stride0];
+        const Tcomplex sm = input[mirror_offset + k0 * stride0];
+        res.x             = 0.5 * (s.x + sm.x);
+        res.y             = 0.5 * (s.y - sm.y);
+    }
+    else if(k0 < hermitian_size)
+    {
+        res = input[offset + k0 * stride0];
+    }
+    else
+    {
+        res   = input[mirror_offset + (dim_0 - k0) * stride0];
+        res.y = -res.y;
+    }
+    return res;
+}
+
+// Assemble the full transform Z = A + iB of the pair of batch members
+// 2p and 2p + 1 from their hermitian halves A and B.
+template <typename Tcomplex>
+__global__ static void pair_hermitian2complex_kernel(const size_t                hermitian_size,
+                                                     const size_t                dim_0,
+                                                     const size_t                dim_1,
+                                                     const size_t                dim_2,
+                                                     const size_t                batch,
+                                                     const size_t                istride0,
+                                                     const size_t                istride1,
+                                                     const size_t                istride2,
+                                                     const Tcomplex*             input,
+                                                     const size_t                idist,
+                                                     const size_t                ostride0,
+                                                     const size_t                ostride1,
+                                                     const size_t                ostride2,
+                                                     Tcomplex*                   output,
+                                                     const size_t                odist,
+                                                     const real_type_t<Tcomplex> scale)
+{
+    const size_t tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(tid < dim_0)
+    {
+        const size_t k1 = hipBlockIdx_y % dim_1;
+        const size_t k2 = hipBlockIdx_y / dim_1;
+        const size_t p  = hipBlockIdx_z;
+
+        const size_t m1 = (k1 == 0) ? 0 : dim_1 - k1;
+        const size_t m2 = (k2 == 0) ? 0 : dim_2 - k2;
+
+        const size_t offset        = k2 * istride2 + k1 * istride1;
+        const size_t mirror_offset = m2 * istride2 + m1 * istride1;
+
+        const Tcomplex a = pair_hermitian_element(input,
+                                                  hermitian_size,
+                                                  dim_0,
+                                                  tid,
+                                                  2 * p * idist + offset,
+                                                  2 * p * idist + mirror_offset,
+                                                  istride0);
+
+        Tcomplex z = a;
+        if(2 * p + 1 < batch)
+        {
+            const Tcomplex b = pair_hermitian_element(input,
+                                                      hermitian_size,
+                                                      dim_0,
+                                                      tid,
+                                                      (2 * p + 1) * idist + offset,
+                                                      (2 * p + 1) * idist + mirror_offset,
+                                                      istride0);
+            z.x -= b.y;
+            z.y += b.x;
+        }
+
+        output[p * odist + k2 * ostride2 + k1 * ostride1 + tid * ostride0] = scale * z;
+    }
+}
+
+// Unpack the real and imaginary parts of the p-th complex input into batch
+// members 2p and 2p + 1 of the real output.
+template <typename Tcomplex>
+__global__ static void pair_complex2real_kernel(const size_t                dim_0,
+                                                const size_t                dim_1,
+                                                const size_t                batch,
+                                                const size_t                istride0,
+                                                const size_t                istride1,
+                                                const size_t                istride2,
+                                                const Tcomplex*             input,
+                                                const size_t                idist,
+                                                const size_t                ostride0,
+                                                const size_t                ostride1,
+                                                const size_t                ostride2,
+                                                real_type_t<Tcomplex>*      output,
+                                                const size_t                odist,
+                                                const real_type_t<Tcomplex> scale)
+{
+    const size_t tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(tid < dim_0)
+    {
+        const size_t i1 = hipBlockIdx_y % dim_1;
+        const size_t i2 = hipBlockIdx_y / dim_1;
+        const size_t p  = hipBlockIdx_z;
+
+        const Tcomplex z = input[p * idist + i2 * istride2 + i1 * istride1 + tid * istride0];
+
+        const size_t oOffset            = i2 * ostride2 + i1 * ostride1 + tid * ostride0;
+        output[2 * p * odist + oOffset] = scale * z.x;
+        if(2 * p + 1 < batch)
+            output[(2 * p + 1) * odist + oOffset] = scale * z.y;
+    }
+}
+
+// Strides of the two outer dimensions of a node of up to three dimensions.
+static void pair_outer_strides(const std::vector<size_t>& stride, size_t& stride1, size_t& stride2)
+{
+    stride1 = (stride.size() > 1) ? stride[1] : 0;
+    stride2 = (stride.size() > 2) ? stride[2] : 0;
+}
+
+/// \brief auxiliary function
+///   assemble the complex transforms of pairs of real batch members from the
+///   hermitian inputs of both members
+void pair_hermitian2complex(const void* data_p, void* back_p)
+{
+    DeviceCallIn* data = (DeviceCallIn*)data_p;
+
+    const size_t dim_0          = data->node->length[0];
+    const size_t dim_1          = (data->node->length.size() > 1) ? data->node->length[1] : 1;
+    const size_t dim_2          = (data->node->length.size() > 2) ? data->node->length[2] : 1;
+    const size_t hermitian_size = dim_0 / 2 + 1;
+
+    size_t istride1, istride2, ostride1, ostride2;
+    pair_outer_strides(data->node->inStride, istride1, istride2);
+    pair_outer_strides(data->node->outStride, ostride1, ostride2);
+
+    const size_t batch = data->batch;
+    const size_t pairs = (batch + 1) / 2;
+
+    dim3 grid((dim_0 - 1) / 512 + 1, dim_1 * dim_2, pairs);
+    dim3 threads(512, 1, 1);
+
+    hipStream_t rocfft_stream = data->rocfft_stream;
+
+    assert(data->node->inArrayType == rocfft_array_type_hermitian_interleaved);
+
+    if(data->node->precision == rocfft_precision_single)
+        hipLaunchKernelGGL(pair_hermitian2complex_kernel<float2>,
+                           grid,
+                           threads,
+                           0,
+                           rocfft_stream,
+                           hermitian_size,
+                           dim_0,
+                           dim_1,
+                           dim_2,
+                           batch,
+                           data->node->inStride[0],
+                           istride1,
+                           istride2,
+                           (float2*)data->bufIn[0],
+                           data->node->iDist,
+                           data->node->outStride[0],
+                           ostride1,
+                           ostride2,
+                           (float2*)data->bufOut[0],
+                           data->node->oDist,
+                           (float)data->node->scale);
+    else
+        hipLaunchKernelGGL(pair_hermitian2complex_kernel<double2>,
+                           grid,
+                           threads,
+                           0,
+                           rocfft_stream,
+                           hermitian_size,
+                           dim_0,
+                           dim_1,
+                           dim_2,
+                           batch,
+                           data->node->inStride[0],
+                           istride1,
+                           istride2,
+                           (double2*)data->bufIn[0],
+                           data->node->iDist,
+                           data->node->outStride[0],
+                           ostride1,
+                           ostride2,
+                           (double2*)data->bufOut[0],
+                           data->node->oDist,
+                           (double)data->node->scale);
+}
+
+/// \brief auxiliary function
+///   unpack the complex inverse transforms of pairs of real batch members
+///   into the real outputs of both members
+void pair_complex2real(const void* data_p, void* back_p)
+{
+    DeviceCallIn* data = (DeviceCallIn*)data_p;
+
+    const size_t dim_0 = data->node->length[0];
+    const size_t dim_1 = (data->node->length.size() > 1) ? data->node->length[1] : 1;
+    const size_t dim_2 = (data->node->length.size() > 2) ? data->node->length[2] : 1;
+
+    size_t istride1, istride2, ostride1, ostride2;
+    pair_outer_strides(data->node->inStride, istride1, istride2);
+    pair_outer_strides(data->node->outStride, ostride1, ostride2);
+
+    const size_t batch = data->batch;
+    const size_t pairs = (batch + 1) / 2;
+
+    dim3 grid((dim_0 - 1) / 512 + 1, dim_1 * dim_2, pairs);
+    dim3 threads(512, 1, 1);
+
+    hipStream_t rocfft_stream = data->rocfft_stream;
+
+    if(data->node->precision == rocfft_precision_single)
+        hipLaunchKernelGGL(pair_complex2real_kernel<float2>,
+                           grid,
+                           threads,
+                           0,
+                           rocfft_stream,
+                           dim_0,
+                           dim_1,
+                           batch,
+                           data->node->inStride[0],
+                           istride1,
+                           istride2,
+                           (float2*)data->bufIn[0],
+                           data->node->iDist,
+                           data->node->outStride[0],
+                           ostride1,
+                           ostride2,
+                           (float*)data->bufOut[0],
+                           data->node->oDist,
+                           (float)data->node->scale);
+    else
+        hipLaunchKernelGGL(pair_complex2real_kernel<double2>,
+                           grid,
+                           threads,
+                           0,
+                           rocfft_stream,
+                           dim_0,
+                           dim_1,
+                           batch,
+                           data->node->inStride[0],
+                           istride1,
+                           istride2,
+                           (double2*)data->bufIn[0],
+                           data->node->iDist,
+                           data->node->outStride[0],
+                           ostride1,
+                           ostride2,
+                           (double*)data->bufOut[0],
+                           data->node->oDist,
+                           (double)data->node->scale);
+}
@@ -7,12 +7,14 @@ set( kernels_pow2
 rocfft_kernel_1024.h
 rocfft_kernel_128.h
 rocfft_kernel_128_sbcc.h
+rocfft_kernel_128_sbcc_md.h
 rocfft_kernel_128_sbrc.h
 rocfft_kernel_16.h
 rocfft_kernel_1.h
 rocfft_kernel_2048.h
 rocfft_kernel_256.h
 rocfft_kernel_256_sbcc.h
+rocfft_kernel_256_sbcc_md.h
 rocfft_kernel_256_sbrc.h
 rocfft_kernel_2.h
 rocfft_kernel_32.h
@@ -21,6 +23,7 @@ rocfft_kernel_4.h
 rocfft_kernel_512.h
 rocfft_kernel_64.h
 rocfft_kernel_64_sbcc.h
+rocfft_kernel_64_sbcc_md.h
 rocfft_kernel_64_sbrc.h
 rocfft_kernel_8.h
 )
@@ -47,150 +50,365 @@ rocfft_kernel_625.h
 
 set( kernels_all
 rocfft_kernel_1000.h
+rocfft_kernel_1008.h
 rocfft_kernel_100.h
 rocfft_kernel_1024.h
+rocfft_kernel_1029.h
+rocfft_kernel_104.h
+rocfft_kernel_1050.h
+rocfft_kernel_105.h
 rocfft_kernel_1080.h
 rocfft_kernel_108.h
 rocfft_kernel_10.h
+rocfft_kernel_1120.h
 rocfft_kernel_1125.h
+rocfft_kernel_112.h
+rocfft_kernel_1134.h
 rocfft_kernel_1152.h
+rocfft_kernel_1176.h
+rocfft_kernel_11.h
 rocfft_kernel_1200.h
 rocfft_kernel_120.h
 rocfft_kernel_1215.h
+rocfft_kernel_121.h
+rocfft_kernel_1225.h
 rocfft_kernel_1250.h
 rocfft_kernel_125.h
+rocfft_kernel_1260.h
+rocfft_kernel_126.h
 rocfft_kernel_1280.h
 rocfft_kernel_128.h
 rocfft_kernel_128_sbcc.h
+rocfft_kernel_128_sbcc_md.h
 rocfft_kernel_128_sbrc.h
 rocfft_kernel_1296.h
 rocfft_kernel_12.h
+rocfft_kernel_1323.h
+rocfft_kernel_1331.h
+rocfft_kernel_1344.h
 rocfft_kernel_1350.h
+rocfft_kernel_1352.h
 rocfft_kernel_135.h
+rocfft_kernel_1372.h
+rocfft_kernel_13.h
+rocfft_kernel_1400.h
+rocfft_kernel_1408.h
+rocfft_kernel_140.h
 rocfft_kernel_1440.h
 rocfft_kernel_144.h
 rocfft_kernel_1458.h
+rocfft_kernel_1470.h
+rocfft_kernel_147.h
+rocfft_kernel_14.h
 rocfft_kernel_1500.h
 rocfft_kernel_150.h
+rocfft_kernel_1512.h
 rocfft_kernel_1536.h
+rocfft_kernel_1568.h
+rocfft_kernel_1575.h
 rocfft_kernel_15.h
 rocfft_kernel_1600.h
 rocfft_kernel_160.h
 rocfft_kernel_1620.h
 rocfft_kernel_162.h
+rocfft_kernel_1664.h
+rocfft_kernel_1680.h
+rocfft_kernel_168.h
+rocfft_kernel_169.h
 rocfft_kernel_16.h
+rocfft_kernel_1701.h
+rocfft_kernel_1715.h
 rocfft_kernel_1728.h
+rocfft_kernel_1750.h
+rocfft_kernel_175.h
+rocfft_kernel_1764.h
+rocfft_kernel_176.h
+rocfft_kernel_1792.h
 rocfft_kernel_1800.h
 rocfft_kernel_180.h
 rocfft_kernel_1875.h
+rocfft_kernel_1890.h
+rocfft_kernel_189.h
 rocfft_kernel_18.h
 rocfft_kernel_1920.h
 rocfft_kernel_192.h
+rocfft_kernel_1936.h
 rocfft_kernel_1944.h
+rocfft_kernel_1960.h
+rocfft_kernel_196.h
 rocfft_kernel_1.h
 rocfft_kernel_2000.h
 rocfft_kernel_200.h
+rocfft_kernel_2016.h
 rocfft_kernel_2025.h
 rocfft_kernel_2048.h
+rocfft_kernel_2058.h
+rocfft_kernel_208.h
 rocfft_kernel_20.h
+rocfft_kernel_2100.h
+rocfft_kernel_210.h
 rocfft_kernel_2160.h
 rocfft_kernel_216.h
 rocfft_kernel_2187.h
+rocfft_kernel_2197.h
+rocfft_kernel_21.h
+rocfft_kernel_2205.h
+rocfft_kernel_2240.h
+rocfft_kernel_224.h
 rocfft_kernel_2250.h
 rocfft_kernel_225.h
+rocfft_kernel_2268.h
+rocfft_kernel_22.h
 rocfft_kernel_2304.h
+rocfft_kernel_2352.h
 rocfft_kernel_2400.h
+rocfft_kernel_2401.h
 rocfft_kernel_240.h
+rocfft_kernel_242.h
 rocfft_kernel_2430.h
 rocfft_kernel_243.h
+rocfft_kernel_2450.h
+rocfft_kernel_245.h
 rocfft_kernel_24.h
 rocfft_kernel_2500.h
 rocfft_kernel_250.h
+rocfft_kernel_2520.h
+rocfft_kernel_252.h
 rocfft_kernel_2560.h
 rocfft_kernel_256.h
 rocfft_kernel_256_sbcc.h
+rocfft_kernel_256_sbcc_md.h
 rocfft_kernel_256_sbrc.h
 rocfft_kernel_2592.h
 rocfft_kernel_25.h
+rocfft_kernel_2625.h
+rocfft_kernel_2646.h
+rocfft_kernel_2662.h
+rocfft_kernel_2688.h
+rocfft_kernel_26.h
 rocfft_kernel_2700.h
+rocfft_kernel_2704.h
 rocfft_kernel_270.h
+rocfft_kernel_2744.h
 rocfft_kernel_27.h
+rocfft_kernel_2800.h
+rocfft_kernel_280.h
+rocfft_kernel_2816.h
+rocfft_kernel_2835.h
 rocfft_kernel_2880.h
 rocfft_kernel_288.h
+rocfft_kernel_28.h
 rocfft_kernel_2916.h
+rocfft_kernel_2940.h
+rocfft_kernel_294.h
 rocfft_kernel_2.h
 rocfft_kernel_3000.h
 rocfft_kernel_300.h
+rocfft_kernel_3024.h
 rocfft_kernel_3072.h
+rocfft_kernel_3087.h
 rocfft_kernel_30.h
 rocfft_kernel_3125.h
+rocfft_kernel_3136.h
+rocfft_kernel_3150.h
+rocfft_kernel_315.h
 rocfft_kernel_3200.h
 rocfft_kernel_320.h
 rocfft_kernel_3240.h
 rocfft_kernel_324.h
 rocfft_kernel_32.h
+rocfft_kernel_3328.h
+rocfft_kernel_3360.h
+rocfft_kernel_336.h
 rocfft_kernel_3375.h
+rocfft_kernel_338.h
+rocfft_kernel_3402.h
+rocfft_kernel_3430.h
+rocfft_kernel_343.h
 rocfft_kernel_3456.h
+rocfft_kernel_3500.h
+rocfft_kernel_350.h
+rocfft_kernel_3528.h
+rocfft_kernel_352.h
+rocfft_kernel_3584.h
+rocfft_kernel_35.h
 rocfft_kernel_3600.h
 rocfft_kernel_360.h
 rocfft_kernel_3645.h
+rocfft_kernel_3675.h
 rocfft_kernel_36.h
 rocfft_kernel_3750.h
 rocfft_kernel_375.h
+rocfft_kernel_3780.h
+rocfft_kernel_378.h
 rocfft_kernel_3840.h
 rocfft_kernel_384.h
+rocfft_kernel_3872.h
 rocfft_kernel_3888.h
+rocfft_kernel_3920.h
+rocfft_kernel_392.h
+rocfft_kernel_3969.h
 rocfft_kernel_3.h
 rocfft_kernel_4000.h
 rocfft_kernel_400.h
+rocfft_kernel_4032.h
 rocfft_kernel_4050.h
 rocfft_kernel_405.h
 rocfft_kernel_4096.h
 rocfft_kernel_40.h
+rocfft_kernel_416.h
+rocfft_kernel_420.h
+rocfft_kernel_42.h
 rocfft_kernel_432.h
+rocfft_kernel_441.h
+rocfft_kernel_448.h
+rocfft_kernel_44.h
 rocfft_kernel_450.h
 rocfft_kernel_45.h
 rocfft_kernel_480.h
+rocfft_kernel_484.h
 rocfft_kernel_486.h
 rocfft_kernel_48.h
+rocfft_kernel_490.h
+rocfft_kernel_49.h
 rocfft_kernel_4.h
 rocfft_kernel_500.h
+rocfft_kernel_504.h
 rocfft_kernel_50.h
 rocfft_kernel_512.h
+rocfft_kernel_525.h
+rocfft_kernel_52.h
 rocfft_kernel_540.h
 rocfft_kernel_54.h
+rocfft_kernel_560.h
+rocfft_kernel_567.h
+rocfft_kernel_56.h
 rocfft_kernel_576.h
+rocfft_kernel_588.h
 rocfft_kernel_5.h
 rocfft_kernel_600.h
 rocfft_kernel_60.h
 rocfft_kernel_625.h
+rocfft_kernel_630.h
+rocfft_kernel_63.h
 rocfft_kernel_640.h
 rocfft_kernel_648.h
 rocfft_kernel_64.h
 rocfft_kernel_64_sbcc.h
+rocfft_kernel_64_sbcc_md.h
 rocfft_kernel_64_sbrc.h
+rocfft_kernel_672.h
 rocfft_kernel_675.h
+rocfft_kernel_676.h
+rocfft_kernel_686.h
 rocfft_kernel_6.h
+rocfft_kernel_700.h
+rocfft_kernel_704.h
+rocfft_kernel_70.h
 rocfft_kernel_720.h
 rocfft_kernel_729.h
 rocfft_kernel_72.h
+rocfft_kernel_735.h
 rocfft_kernel_750.h
+rocfft_kernel_756.h
 rocfft_kernel_75.h
 rocfft_kernel_768.h
+rocfft_kernel_784.h
+rocfft_kernel_7.h
 rocfft_kernel_800.h
 rocfft_kernel_80.h
 rocfft_kernel_810.h
 rocfft_kernel_81.h
+rocfft_kernel_832.h
+rocfft_kernel_840.h
+rocfft_kernel_84.h
 rocfft_kernel_864.h
+rocfft_kernel_875.h
+rocfft_kernel_882.h
+rocfft_kernel_88.h
+rocfft_kernel_896.h
 rocfft_kernel_8.h
 rocfft_kernel_900.h
 rocfft_kernel_90.h
+rocfft_kernel_945.h
 rocfft_kernel_960.h
+rocfft_kernel_968.h
 rocfft_kernel_96.h
 rocfft_kernel_972.h
+rocfft_kernel_980.h
+rocfft_kernel_98.h
 rocfft_kernel_9.h
 )
 
+# Fused CS_KERNEL_2D_SINGLE and CS_KERNEL_3D_SINGLE kernels, all of power-of-two lengths
+set( kernels_single
+rocfft_kernel_128x4_single.h
+rocfft_kernel_128x8_single.h
+rocfft_kernel_16x16_single.h
+rocfft_kernel_16x16x4_single.h
+rocfft_kernel_16x32_single.h
+rocfft_kernel_16x4_single.h
+rocfft_kernel_16x4x16_single.h
+rocfft_kernel_16x4x4_single.h
+rocfft_kernel_16x4x8_single.h
+rocfft_kernel_16x64_single.h
+rocfft_kernel_16x8_single.h
+rocfft_kernel_16x8x4_single.h
+rocfft_kernel_16x8x8_single.h
+rocfft_kernel_256x4_single.h
+rocfft_kernel_32x16_single.h
+rocfft_kernel_32x32_single.h
+rocfft_kernel_32x4_single.h
+rocfft_kernel_32x4x4_single.h
+rocfft_kernel_32x4x8_single.h
+rocfft_kernel_32x8_single.h
+rocfft_kernel_32x8x4_single.h
+rocfft_kernel_4x128_single.h
+rocfft_kernel_4x16_single.h
+rocfft_kernel_4x16x16_single.h
+rocfft_kernel_4x16x4_single.h
+rocfft_kernel_4x16x8_single.h
+rocfft_kernel_4x256_single.h
+rocfft_kernel_4x32_single.h
+rocfft_kernel_4x32x4_single.h
+rocfft_kernel_4x32x8_single.h
+rocfft_kernel_4x4_single.h
+rocfft_kernel_4x4x16_single.h
+rocfft_kernel_4x4x32_single.h
+rocfft_kernel_4x4x4_single.h
+rocfft_kernel_4x4x64_single.h
+rocfft_kernel_4x4x8_single.h
+rocfft_kernel_4x64_single.h
+rocfft_kernel_4x64x4_single.h
+rocfft_kernel_4x8_single.h
+rocfft_kernel_4x8x16_single.h
+rocfft_kernel_4x8x32_single.h
+rocfft_kernel_4x8x4_single.h
+rocfft_kernel_4x8x8_single.h
+rocfft_kernel_64x16_single.h
+rocfft_kernel_64x4_single.h
+rocfft_kernel_64x4x4_single.h
+rocfft_kernel_64x8_single.h
+rocfft_kernel_8x128_single.h
+rocfft_kernel_8x16_single.h
+rocfft_kernel_8x16x4_single.h
+rocfft_kernel_8x16x8_single.h
+rocfft_kernel_8x32_single.h
+rocfft_kernel_8x32x4_single.h
+rocfft_kernel_8x4_single.h
+rocfft_kernel_8x4x16_single.h
+rocfft_kernel_8x4x32_single.h
+rocfft_kernel_8x4x4_single.h
+rocfft_kernel_8x4x8_single.h
+rocfft_kernel_8x64_single.h
+rocfft_kernel_8x8_single.h
+rocfft_kernel_8x8x16_single.h
+rocfft_kernel_8x8x4_single.h
+rocfft_kernel_8x8x8_single.h
+)
+list(APPEND kernels_pow2 ${kernels_single})
+list(APPEND kernels_all ${kernels_single})
+
 set( kernels_launch
 kernel_launch_generator.h
 function_pool.cpp.h
@@ -199,6 +417,10 @@ kernel_launch_single_large.cpp.h
 kernel_launch_single_large.cpp
 kernel_launch_double_large.cpp.h
 kernel_launch_double_large.cpp
+kernel_launch_single_md.cpp.h
+kernel_launch_single_md.cpp
+kernel_launch_double_md.cpp.h
+kernel_launch_double_md.cpp
 )
 
 set( small_kernels_group_num 8 )
@@ -211,5 +433,16 @@ foreach(small_kernel_group_id RANGE 0 ${max_group_num} )
 
     list(APPEND kernels_launch ${small_kernel_single_file} ${small_kernel_single_h_file})
     list(APPEND kernels_launch ${small_kernel_double_file} ${small_kernel_double_h_file})
+
+    string(CONCAT host_kernel_file "host_kernel_launch_" ${small_kernel_group_id} ".cpp")
+    list(APPEND kernels_host ${host_kernel_file})
 endforeach(small_kernel_group_id)
 
+# Host (CPU) Stockham kernels for the host execution backend
+list(APPEND kernels_host
+rocfft_host_butterfly.h
+host_kernel_launch_generator.h
+host_function_pool.cpp
+)
+list(APPEND kernels_launch ${kernels_host})
+
@@ -6,6 +6,7 @@
 #if !defined(_generator_butterfly_H)
 #define _generator_butterfly_H
 #include "generator.stockham.h"
+#include <regex>
 
 namespace StockhamGenerator
 {
@@ -18,19 +19,39 @@ namespace StockhamGenerator
         size_t count; // Number of basic butterflies, valid values: 1,2,4
         bool   fwd; // FFT direction
         bool   cReg; // registers are complex numbers, .x (real), .y(imag)
+        bool   host; // host (CPU) code, registers are split real/imag scalars of type T
 
         size_t BitReverse(size_t n, size_t N) const
         {
             return (N < 2) ? n : (BitReverse(n >> 1, N >> 1) | ((n & 1) != 0 ? (N >> 1) : 0));
         }
 
+        // The radix-11 and radix-13 butterflies are written for complex
+        // registers holding fptype scalars.  For split real/imag registers,
+        // reads of (*Rk).x and (*Rk).y go to (*Rk) and (*Ik), and the results
+        // go to TRk and TIk, which are copied back with the other radices.
+        std::string AdaptRegisters(const std::string& src, const std::string& regType) const
+        {
+            std::string str = std::regex_replace(src, std::regex("fptype"), regType);
+            if(cReg)
+                return str;
+
+            str = std::regex_replace(
+                str, std::regex("\\(\\*R([0-9]+)\\)\\.x(\\s*=[^=])"), "TR$1$2");
+            str = std::regex_replace(
+                str, std::regex("\\(\\*R([0-9]+)\\)\\.y(\\s*=[^=])"), "TI$1$2");
+            str = std::regex_replace(str, std::regex("\\(\\*R([0-9]+)\\)\\.x"), "(*R$1)");
+            str = std::regex_replace(str, std::regex("\\(\\*R([0-9]+)\\)\\.y"), "(*I$1)");
+            return str;
+        }
+
         void GenerateButterflyStr(std::string& bflyStr) const
         {
-            std::string regType = cReg ? RegBaseType<PR>(2) : RegBaseType<PR>(count);
+            std::string regType = host ? "T" : (cReg ? RegBaseType<PR>(2) : RegBaseType<PR>(count));
 
             // Function attribute
             bflyStr += "template <typename T>\n";
-            bflyStr += "__device__ void \n";
+            bflyStr += host ? "static inline void \n" : "__device__ void \n";
 
             // Function name
             bflyStr += ButterflyName(radix, count, fwd);
@@ -1662,16 +1683,10 @@ namespace StockhamGenerator
 						(*R10).x = z1 - w14* b11_0; \n\
 						(*R10).y = z7 - w1* b11_0; \n";
 
-                if(fwd)
-                {
-                    bflyStr += "fptype dir = -1;\n\n";
-                }
-                else
-                {
-                    bflyStr += "fptype dir = 1;\n\n";
-                }
+                std::string str = fwd ? "fptype dir = -1;\n\n" : "fptype dir = 1;\n\n";
+                str += radix11str;
 
-                bflyStr += radix11str;
+                bflyStr += AdaptRegisters(str, cReg ? RegBaseType<PR>(1) : regType);
             }
             break;
             case 13:
@@ -1882,16 +1897,10 @@ namespace StockhamGenerator
 						(*R12).x =  e6 -  f2 * dir * b13_9 ;\n\
 						(*R12).y = e12 + f12 * dir * b13_9 ;\n";
 
-                if(fwd)
-                {
-                    bflyStr += "fptype dir = -1;\n\n";
-                }
-                else
-                {
-                    bflyStr += "fptype dir = 1;\n\n";
-                }
+                std::string str = fwd ? "fptype dir = -1;\n\n" : "fptype dir = 1;\n\n";
+                str += radix13str;
 
-                bflyStr += radix13str;
+                bflyStr += AdaptRegisters(str, cReg ? RegBaseType<PR>(1) : regType);
             }
             break;
 
@@ -1965,12 +1974,15 @@ namespace StockhamGenerator
         }
 
     public:
-        Butterfly(size_t radixVal, size_t countVal, bool fwdVal, bool cRegVal)
+        Butterfly(size_t radixVal, size_t countVal, bool fwdVal, bool cRegVal, bool hostVal = false)
             : radix(radixVal)
             , count(countVal)
             , fwd(fwdVal)
             , cReg(cRegVal)
+            , host(hostVal)
         {
+            // host butterflies work on split real/imag registers
+            assert(!host || !cReg);
         }
 
         void GenerateButterfly(std::string& bflyStr) const
@@ -11,6 +11,7 @@
 #include <string>
 #include <vector>
 
+#include "generator.butterfly.hpp"
 #include "generator.kernel.hpp"
 #include "generator.param.h"
 #include "generator.pass.hpp"
@@ -18,6 +19,15 @@
 
 using namespace StockhamGenerator;
 
+// Name of a fused kernel shape, e.g. "16x16" or "4x8x32"
+static std::string single_shape_name(const std::vector<size_t>& shape)
+{
+    std::string name;
+    for(size_t d = 0; d < shape.size(); d++)
+        name += (d ? "x" : "") + std::to_string(shape[d]);
+    return name;
+}
+
 /* =====================================================================
             Initial parameter used to generate kernels
 =================================================================== */
@@ -142,7 +152,8 @@ extern "C" void WriteButterflyToFile(std::string& str, int LEN)
    Write CPU functions (launching kernel) header to file
 =================================================================== */
 extern "C" void WriteCPUHeaders(std::vector<size_t>                            support_list,
-                                std::vector<std::tuple<size_t, ComputeScheme>> large1D_list)
+                                std::vector<std::tuple<size_t, ComputeScheme>> large1D_list,
+                                std::vector<std::vector<size_t>>               single_list)
 {
 
     std::string str;
@@ -192,6 +203,11 @@ extern "C" void WriteCPUHeaders(std::vector<size_t>                            s
             str += "void rocfft_internal_dfn_sp_op_ci_ci_sbrc_";
             str += str_len + "(const void *data_p, void *back_p);\n";
         }
+        else if(scheme == CS_KERNEL_2D_STOCKHAM_BLOCK_CC)
+        {
+            str += "void rocfft_internal_dfn_sp_op_ci_ci_sbcc_md_";
+            str += str_len + "(const void *data_p, void *back_p);\n";
+        }
 
         if(scheme == CS_KERNEL_STOCKHAM_BLOCK_CC)
         {
@@ -203,6 +219,22 @@ extern "C" void WriteCPUHeaders(std::vector<size_t>                            s
             str += "void rocfft_internal_dfn_dp_op_ci_ci_sbrc_";
             str += str_len + "(const void *data_p, void *back_p);\n";
         }
+        else if(scheme == CS_KERNEL_2D_STOCKHAM_BLOCK_CC)
+        {
+            str += "void rocfft_internal_dfn_dp_op_ci_ci_sbcc_md_";
+            str += str_len + "(const void *data_p, void *back_p);\n";
+        }
+    }
+
+    str += "\n";
+    // write fused 2D and 3D kernels
+    for(const auto& shape : single_list)
+    {
+        std::string name = single_shape_name(shape);
+        str += "void rocfft_internal_dfn_sp_ci_ci_single_";
+        str += name + "(const void *data_p, void *back_p);\n";
+        str += "void rocfft_internal_dfn_dp_ci_ci_single_";
+        str += name + "(const void *data_p, void *back_p);\n";
     }
 
     str += "\n";
@@ -362,6 +394,17 @@ extern "C" void
                    + ", fft_back_op_len" + str_len + name_suffix + ", " + complex_case_precision
                    + ")\n";
         }
+        else if(scheme == CS_KERNEL_2D_STOCKHAM_BLOCK_CC)
+        {
+            // same interface as the large 1D column kernels, without
+            // reading the large twiddles
+            name_suffix = "_sbcc_md";
+            str += "#include \"rocfft_kernel_" + str_len + name_suffix + ".h\" \n";
+            str += "POWX_LARGE_SBCC_GENERATOR( rocfft_internal_dfn_" + short_name_precision
+                   + "_op_ci_ci_sbcc_md_" + str_len + ", fft_fwd_op_len" + str_len + name_suffix
+                   + ", fft_back_op_len" + str_len + name_suffix + ", " + complex_case_precision
+                   + ")\n";
+        }
     }
 
     std::ofstream file;
@@ -391,7 +434,8 @@ extern "C" void
    Add CPU funtions to function pools (a hash map)
 =================================================================== */
 extern "C" void AddCPUFunctionToPool(std::vector<size_t>                            support_list,
-                                     std::vector<std::tuple<size_t, ComputeScheme>> large1D_list)
+                                     std::vector<std::tuple<size_t, ComputeScheme>> large1D_list,
+                                     std::vector<std::vector<size_t>>               single_list)
 {
     std::string str;
 
@@ -450,6 +494,14 @@ extern "C" void AddCPUFunctionToPool(std::vector<size_t>
                    + str_len + ";\n";
             ;
         }
+        else if(scheme == CS_KERNEL_2D_STOCKHAM_BLOCK_CC)
+        {
+            // the 2D and 3D row-column schemes share the column kernels
+            for(auto key : {"CS_KERNEL_2D_STOCKHAM_BLOCK_CC", "CS_KERNEL_3D_STOCKHAM_BLOCK_CC"})
+                str += "\tfunction_map_single[std::make_pair(" + str_len + ", "
+                       + std::string(key) + ")] = &rocfft_internal_dfn_sp_op_ci_ci_sbcc_md_"
+                       + str_len + ";\n";
+        }
     }
 
     // write large 1D kernels double
@@ -476,6 +528,28 @@ extern "C" void AddCPUFunctionToPool(std::vector<size_t>
                    + str_len + ";\n";
             ;
         }
+        else if(scheme == CS_KERNEL_2D_STOCKHAM_BLOCK_CC)
+        {
+            // the 2D and 3D row-column schemes share the column kernels
+            for(auto key : {"CS_KERNEL_2D_STOCKHAM_BLOCK_CC", "CS_KERNEL_3D_STOCKHAM_BLOCK_CC"})
+                str += "\tfunction_map_double[std::make_pair(" + str_len + ", "
+                       + std::string(key) + ")] = &rocfft_internal_dfn_dp_op_ci_ci_sbcc_md_"
+                       + str_len + ";\n";
+        }
+    }
+
+    str += "\n";
+    // write fused 2D and 3D kernels, keyed by their shape
+    for(const auto& shape : single_list)
+    {
+        std::string name = single_shape_name(shape);
+        std::string key;
+        for(auto len : shape)
+            key += (key.empty() ? "" : ", ") + std::to_string(len);
+        str += "\tshape_map_single[{" + key + "}] = &rocfft_internal_dfn_sp_ci_ci_single_" + name
+               + ";\n";
+        str += "\tshape_map_double[{" + key + "}] = &rocfft_internal_dfn_dp_ci_ci_single_" + name
+               + ";\n";
     }
 
     str += "}\n";
@@ -563,6 +637,23 @@ extern "C" void generate_kernel(size_t len, ComputeScheme scheme)
 
         WriteKernelToFile(programCode, std::to_string(len) + params.name_suffix);
     }
+    else if(scheme == CS_KERNEL_2D_STOCKHAM_BLOCK_CC)
+    {
+        // column kernels of the 2D/3D row-column schemes: the same block
+        // compute as above, without the large 1D twiddles
+        bool                blockCompute = true;
+        std::vector<size_t> fft_N        = {1, 1};
+        fft_N[0]                         = len;
+        params.fft_3StepTwiddle          = false;
+        params.name_suffix               = "_sbcc_md";
+        initParams(params, fft_N, blockCompute, BCT_C2C);
+
+        Kernel<rocfft_precision_single> kernel(
+            params); // generate data type template kernels regardless of precision
+        kernel.GenerateKernel(programCode);
+
+        WriteKernelToFile(programCode, std::to_string(len) + params.name_suffix);
+    }
     else if(scheme == CS_KERNEL_STOCKHAM_BLOCK_RC)
     {
         bool                blockCompute = true; // enable blockCompute in large 1D
@@ -580,3 +671,509 @@ extern "C" void generate_kernel(size_t len, ComputeScheme scheme)
         WriteKernelToFile(programCode, std::to_string(len) + params.name_suffix);
     }
 }
+
+/* =====================================================================
+   Fused 2D and 3D kernels (CS_KERNEL_2D_SINGLE, CS_KERNEL_3D_SINGLE):
+   one workgroup keeps a whole transform in LDS and runs the encapsulated
+   passes of the small kernels along each dimension in turn
+=================================================================== */
+
+extern "C" void get_single_support_list(const std::vector<size_t>&        support_list,
+                                        std::vector<std::vector<size_t>>& single_list)
+{
+    // only lengths with small kernels have device functions to fuse
+    std::vector<size_t> lengths;
+    for(size_t len = 4; len <= 256; len *= 2)
+    {
+        if(std::find(support_list.begin(), support_list.end(), len) != support_list.end())
+            lengths.push_back(len);
+    }
+
+    single_list.clear();
+    for(auto N0 : lengths)
+    {
+        for(auto N1 : lengths)
+        {
+            std::vector<size_t> shape = {N0, N1};
+            if(SingleKernelShape(shape, 2))
+                single_list.push_back(shape);
+        }
+    }
+    for(auto N0 : lengths)
+    {
+        for(auto N1 : lengths)
+        {
+            for(auto N2 : lengths)
+            {
+                std::vector<size_t> shape = {N0, N1, N2};
+                if(SingleKernelShape(shape, 3))
+                    single_list.push_back(shape);
+            }
+        }
+    }
+}
+
+// Offset of line t along dimension d of shape, where the other dimensions
+// are at the given strides
+static std::string single_line_offset(const std::vector<size_t>&      shape,
+                                      const size_t                    d,
+                                      const std::vector<std::string>& strides)
+{
+    size_t left = 1; // product of the other lengths not covered yet
+    for(size_t k = 0; k < shape.size(); k++)
+    {
+        if(k != d)
+            left *= shape[k];
+    }
+
+    std::string offset;
+    size_t      div = 1; // product of the other lengths already covered
+    for(size_t k = 0; k < shape.size(); k++)
+    {
+        if(k == d)
+            continue;
+        left /= shape[k];
+
+        std::string idx = "t";
+        if(div > 1)
+            idx = "(" + idx + "/" + std::to_string(div) + ")";
+        if(left > 1)
+            idx = "(" + idx + "%" + std::to_string(shape[k]) + ")";
+
+        offset += (offset.empty() ? "" : " + ") + idx;
+        if(strides[k] != "1")
+            offset += "*" + strides[k];
+        div *= shape[k];
+    }
+    return offset;
+}
+
+extern "C" void generate_single_kernel(const std::vector<size_t>& shape)
+{
+    const size_t      dim  = shape.size();
+    const std::string name = single_shape_name(shape);
+
+    size_t elems = 1;
+    for(auto len : shape)
+        elems *= len;
+
+    // threads per transform of each length are those of its small kernel,
+    // and the workgroup covers the dimension that needs the most
+    std::vector<size_t> tpt(dim);
+    size_t              wgs = 0;
+    for(size_t d = 0; d < dim; d++)
+    {
+        FFTKernelGenKeyParams params;
+        initParams(params, std::vector<size_t>(1, shape[d]), false, BCT_C2C);
+        tpt[d] = params.fft_workGroupSize / params.fft_numTrans;
+        wgs    = std::max(wgs, elems / shape[d] * tpt[d]);
+    }
+    assert(wgs <= MAX_WORK_GROUP_SIZE);
+
+    std::vector<std::string> strideIn, strideOut, strideTile;
+    size_t                   tileStride = 1;
+    for(size_t d = 0; d < dim; d++)
+    {
+        strideIn.push_back("stride_in[" + std::to_string(d) + "]");
+        strideOut.push_back("stride_out[" + std::to_string(d) + "]");
+        strideTile.push_back(std::to_string(tileStride));
+        tileStride *= shape[d];
+    }
+
+    std::string str;
+    str += "\n";
+    str += "// Uses the device functions of the rocfft_kernel_<length>.h of each\n";
+    str += "// length, which the launcher includes first\n";
+    str += "\n";
+
+    for(size_t dir = 0; dir < 2; dir++)
+    {
+        const std::string dirName = dir ? "back" : "fwd";
+
+        for(bool inPlanar : {false, true})
+        {
+            for(bool outPlanar : {false, true})
+            {
+                str += "//Kernel configuration: number of threads per thread block: "
+                       + std::to_string(wgs) + " transform: " + name + "\n";
+                str += "template <typename T>\n";
+                str += "__global__ void \n";
+                str += "fft_" + dirName + "_len" + name + "_single( const T * __restrict__ "
+                       "twiddles, const size_t dim, const size_t *lengths, const size_t "
+                       "*stride_in, const size_t *stride_out, const real_type_t<T> scale, ";
+                str += inPlanar ? "real_type_t<T> *gbInRe, real_type_t<T> *gbInIm, "
+                                : "T *gbIn, ";
+                str += outPlanar ? "real_type_t<T> *gbOutRe, real_type_t<T> *gbOutIm)\n"
+                                 : "T *gbOut)\n";
+                str += "{\n";
+                str += "\tunsigned int me = (unsigned int)hipThreadIdx_x;\n";
+                str += "\tunsigned int batch = (unsigned int)hipBlockIdx_x;\n";
+                str += "\n";
+                str += "\t__shared__  T tile[" + std::to_string(elems) + "];\n";
+                str += "\t__shared__  real_type_t<T> lds[" + std::to_string(elems) + "];\n";
+                str += "\n";
+                str += "\t// one transform per workgroup, over the higher dimensions and the "
+                       "batch\n";
+                str += "\tsize_t iOffset = 0;\n";
+                str += "\tsize_t oOffset = 0;\n";
+                str += "\tsize_t counter_mod = batch;\n";
+                str += "\tfor(int i = " + std::to_string(dim) + "; i < dim; i++){\n";
+                str += "\t\tiOffset += (counter_mod % lengths[i])*stride_in[i];\n";
+                str += "\t\toOffset += (counter_mod % lengths[i])*stride_out[i];\n";
+                str += "\t\tcounter_mod /= lengths[i];\n";
+                str += "\t}\n";
+                str += "\tiOffset += counter_mod*stride_in[dim];\n";
+                str += "\toOffset += counter_mod*stride_out[dim];\n";
+                str += "\n";
+                str += "\tunsigned int t;\n";
+                str += "\tunsigned int rw;\n";
+
+                // the first dimension reads the input into the tile, the
+                // middle one of 3D transforms works on the tile in place
+                // and the last one writes the output
+                size_t twOffset = 0;
+                for(size_t d = 0; d < dim; d++)
+                {
+                    const bool   first = (d == 0);
+                    const bool   last  = (d == dim - 1);
+                    const size_t lines = elems / shape[d];
+                    const auto   len   = std::to_string(shape[d]);
+                    const auto   tpts  = std::to_string(tpt[d]);
+
+                    std::string in;
+                    if(first)
+                    {
+                        const std::string off
+                            = "iOffset + " + single_line_offset(shape, d, strideIn);
+                        in = inPlanar ? "gbInRe + " + off + ", gbInIm + " + off
+                                      : "gbIn + " + off;
+                    }
+                    else
+                        in = "tile + " + single_line_offset(shape, d, strideTile);
+
+                    std::string out;
+                    if(last)
+                    {
+                        const std::string off
+                            = "oOffset + " + single_line_offset(shape, d, strideOut);
+                        out = outPlanar ? "gbOutRe + " + off + ", gbOutIm + " + off
+                                        : "gbOut + " + off;
+                    }
+                    else
+                        out = "tile + " + single_line_offset(shape, d, strideTile);
+
+                    str += "\n";
+                    str += "\t// dimension " + std::to_string(d) + ": "
+                           + std::to_string(lines) + " transforms of length " + len + ", "
+                           + tpts + " threads each\n";
+                    if(!first)
+                        str += "\t__syncthreads();\n";
+                    str += "\tt = me / " + tpts + ";\n";
+                    str += "\trw = (t < " + std::to_string(lines) + ") ? 1 : 0;\n";
+                    // only unit output strides may take the vectorized writes
+                    // of the last pass
+                    const std::string stride_out = last ? strideOut[d] : strideTile[d];
+                    const std::string sb = (stride_out == "1") ? "SB_UNIT" : "SB_NONUNIT";
+                    str += "\t" + dirName + "_len" + len + "_device<T, " + sb + ">(twiddles";
+                    if(twOffset)
+                        str += " + " + std::to_string(twOffset);
+                    str += ", " + (first ? strideIn[d] : strideTile[d]);
+                    str += ", " + stride_out;
+                    str += ", rw, 0, me%" + tpts + ", t*" + len;
+                    str += last ? ", scale, " : ", 1, ";
+                    str += in + ", " + out + ", lds);\n";
+
+                    twOffset += shape[d];
+                }
+
+                str += "}\n";
+                str += "\n";
+            }
+        }
+    }
+
+    WriteKernelToFile(str, name + "_single");
+}
+
+/* =====================================================================
+   Write CPU functions (launching the fused 2D and 3D kernels) to
+   *.cpp.h file
+=================================================================== */
+
+extern "C" void write_cpu_function_single(std::vector<std::vector<size_t>> single_list,
+                                          std::string                      precision)
+{
+    std::string str;
+
+    std::string complex_case_precision = "float2";
+    std::string short_name_precision   = "sp";
+
+    if(precision == "double")
+    {
+        complex_case_precision = "double2";
+        short_name_precision   = "dp";
+    }
+
+    str += "\n";
+    str += "#include \"kernel_launch.h\" \n"; // kernel_launch.h has the required
+    // macros
+    str += "\n";
+
+    // the small kernels have no include guards, so each length goes in once
+    std::vector<size_t> lengths;
+    for(const auto& shape : single_list)
+        lengths.insert(lengths.end(), shape.begin(), shape.end());
+    std::sort(lengths.begin(), lengths.end());
+    lengths.erase(std::unique(lengths.begin(), lengths.end()), lengths.end());
+    for(auto len : lengths)
+        str += "#include \"rocfft_kernel_" + std::to_string(len) + ".h\" \n";
+
+    str += "\n";
+    str += "//" + precision + " precision \n";
+    str += "\n";
+
+    for(const auto& shape : single_list)
+    {
+        std::string name = single_shape_name(shape);
+        str += "#include \"rocfft_kernel_" + name + "_single.h\" \n";
+        str += "POWX_SINGLE_GENERATOR( rocfft_internal_dfn_" + short_name_precision
+               + "_ci_ci_single_" + name + ", fft_fwd_len" + name + "_single, fft_back_len" + name
+               + "_single, " + complex_case_precision + ")\n";
+    }
+
+    std::ofstream file;
+    std::string   headerFileName = "kernel_launch_" + precision + "_md.cpp.h";
+    file.open(headerFileName);
+
+    if(!file.is_open())
+    {
+        std::cout << "File: " << headerFileName << " could not be opened, exiting ...."
+                  << std::endl;
+    }
+    file << str;
+    file.close();
+
+    std::string sourceFileName = "kernel_launch_" + precision + "_md.cpp";
+    file.open(sourceFileName);
+    if(!file.is_open())
+    {
+        std::cout << "File: " << sourceFileName << " could not be opened, exiting ...."
+                  << std::endl;
+    }
+    file << "#include \"" << headerFileName << "\"";
+    file.close();
+}
+
+/* =====================================================================
+   Host (CPU) Stockham kernels: the butterflies and passes above are
+   emitted as plain C++ so the host backend runs the same radix
+   decomposition as the device kernels
+=================================================================== */
+
+extern "C" void get_host_support_list(const std::vector<size_t>& support_list,
+                                      std::vector<size_t>&       host_list)
+{
+    host_list.clear();
+    for(auto len : support_list)
+    {
+        FFTKernelGenKeyParams params;
+        std::vector<size_t>   fft_N(1, len);
+        initParams(params, fft_N, false, BCT_C2C);
+
+        Kernel<rocfft_precision_single> kernel(params);
+        std::vector<size_t>             hostRadices;
+        if(kernel.GetHostRadices(hostRadices))
+            host_list.push_back(len);
+    }
+}
+
+extern "C" void write_host_butterflies()
+{
+    std::string str;
+
+    str += "\n";
+    str += "#pragma once\n";
+    str += "#include \"butterfly_constant.h\"\n";
+    str += "\n";
+
+    // radices with split real/imag register support, see Kernel::GetHostRadices
+    size_t radices[] = {2, 3, 4, 5, 6, 7, 8, 10, 11, 13};
+    for(auto rad : radices)
+    {
+        for(size_t d = 0; d < 2; d++)
+        {
+            Butterfly<rocfft_precision_single> bfly(rad, 1, d == 0, false, true);
+            bfly.GenerateButterfly(str);
+            str += "\n";
+        }
+    }
+
+    std::ofstream file;
+    std::string   fileName = "rocfft_host_butterfly.h";
+    file.open(fileName);
+
+    if(!file.is_open())
+    {
+        std::cout << "File: " << fileName << " could not be opened, exiting ...." << std::endl;
+    }
+    file << str;
+    file.close();
+}
+
+extern "C" void write_host_function_small(std::vector<size_t> host_list, size_t group_num)
+{
+    std::string prec_names[2] = {"sp", "dp"};
+    std::string prec_types[2] = {"float", "double"};
+    std::string dir_names[2]  = {"fwd", "back"};
+
+    size_t group_size = std::max<size_t>((host_list.size() + group_num - 1) / group_num, 1);
+
+    for(size_t j = 0; j < group_num; j++)
+    {
+        size_t i_start = std::min(j * group_size, host_list.size());
+        size_t i_end   = std::min((j + 1) * group_size, host_list.size());
+
+        std::string str;
+
+        str += "\n";
+        str += "#include \"host_kernel_launch_generator.h\" \n";
+        str += "#include \"rocfft_host_butterfly.h\" \n";
+        str += "#include <cstddef> \n";
+        str += "\n";
+
+        for(size_t i = i_start; i < i_end; i++)
+        {
+            FFTKernelGenKeyParams params;
+            std::vector<size_t>   fft_N(1, host_list[i]);
+            initParams(params, fft_N, false, BCT_C2C);
+
+            Kernel<rocfft_precision_single> kernel(params);
+            kernel.GenerateHostKernel(str, true);
+            kernel.GenerateHostKernel(str, false);
+        }
+
+        for(size_t i = i_start; i < i_end; i++)
+        {
+            std::string str_len = std::to_string(host_list[i]);
+            for(size_t p = 0; p < 2; p++)
+            {
+                for(size_t d = 0; d < 2; d++)
+                {
+                    std::string type = prec_types[p];
+                    str += "void rocfft_internal_host_" + prec_names[p] + "_stoc_" + dir_names[d]
+                           + "_" + str_len + "(" + type + "* re, " + type + "* im, " + type
+                           + "* tre, " + type + "* tim, const " + type + "* tw)\n";
+                    str += "{\n";
+                    str += "    host_fft_" + dir_names[d] + "_len" + str_len
+                           + "(re, im, tre, tim, tw);\n";
+                    str += "}\n\n";
+                }
+            }
+        }
+
+        std::ofstream file;
+        std::string   sourceFileName = "host_kernel_launch_" + std::to_string(j) + ".cpp";
+        file.open(sourceFileName);
+        if(!file.is_open())
+        {
+            std::cout << "File: " << sourceFileName << " could not be opened, exiting ...."
+                      << std::endl;
+        }
+        file << str;
+        file.close();
+    }
+}
+
+extern "C" void WriteHostHeaders(std::vector<size_t> host_list)
+{
+    std::string str;
+
+    str += "\n";
+    str += "#pragma once\n";
+    str += "#if !defined( host_kernel_launch_generator_H )\n";
+    str += "#define host_kernel_launch_generator_H \n";
+
+    str += "//generated host Stockham kernels\n";
+    str += "\n";
+    str += "extern \"C\"\n";
+    str += "{\n";
+
+    std::string prec_names[2] = {"sp", "dp"};
+    std::string prec_types[2] = {"float", "double"};
+    std::string dir_names[2]  = {"fwd", "back"};
+    for(size_t p = 0; p < 2; p++)
+    {
+        str += "\n";
+        for(size_t i = 0; i < host_list.size(); i++)
+        {
+            std::string str_len = std::to_string(host_list[i]);
+            std::string type    = prec_types[p];
+            for(size_t d = 0; d < 2; d++)
+            {
+                str += "void rocfft_internal_host_" + prec_names[p] + "_stoc_" + dir_names[d] + "_"
+                       + str_len + "(" + type + "* re, " + type + "* im, " + type + "* tre, "
+                       + type + "* tim, const " + type + "* tw);\n";
+            }
+        }
+    }
+
+    str += "\n";
+    str += "}\n";
+
+    str += "\n";
+    str += "#endif";
+
+    std::ofstream file;
+    std::string   fileName = "host_kernel_launch_generator.h";
+    file.open(fileName);
+
+    if(!file.is_open())
+    {
+        std::cout << "File: " << fileName << " could not be opened, exiting ...." << std::endl;
+    }
+    file << str;
+    file.close();
+}
+
+extern "C" void AddHostFunctionToPool(std::vector<size_t> host_list)
+{
+    std::string str;
+
+    str += "\n";
+    str += "#include \"../include/host_function_pool.h\" \n";
+    str += "#include \"host_kernel_launch_generator.h\" \n";
+    str += "\n";
+    str += "//build hash map to store the host function pointers\n";
+    str += "host_function_pool::host_function_pool()\n";
+    str += "{\n";
+
+    std::string prec_names[2] = {"sp", "dp"};
+    std::string map_names[2]  = {"function_map_single", "function_map_double"};
+    for(size_t p = 0; p < 2; p++)
+    {
+        for(size_t i = 0; i < host_list.size(); i++)
+        {
+            std::string str_len = std::to_string(host_list[i]);
+            str += "\t" + map_names[p] + "[std::make_pair(" + str_len
+                   + ", -1)] = &rocfft_internal_host_" + prec_names[p] + "_stoc_fwd_" + str_len
+                   + ";\n";
+            str += "\t" + map_names[p] + "[std::make_pair(" + str_len
+                   + ", 1)] = &rocfft_internal_host_" + prec_names[p] + "_stoc_back_" + str_len
+                   + ";\n";
+        }
+        str += "\n";
+    }
+
+    str += "}\n";
+
+    std::ofstream file;
+    std::string   sourceFileName = "host_function_pool.cpp";
+    file.open(sourceFileName);
+    if(!file.is_open())
+    {
+        std::cout << "File: " << sourceFileName << " could not be opened, exiting ...."
+                  << std::endl;
+    }
+    file << str;
+    file.close();
+}
@@ -16,7 +16,8 @@ extern "C" rocfft_status initParams(FFTKernelGenKeyParams& params,
 extern "C" void WriteButterflyToFile(std::string& str, int LEN);
 
 extern "C" void WriteCPUHeaders(std::vector<size_t>                            support_list,
-                                std::vector<std::tuple<size_t, ComputeScheme>> large1D_list);
+                                std::vector<std::tuple<size_t, ComputeScheme>> large1D_list,
+                                std::vector<std::vector<size_t>>               single_list);
 
 extern "C" void write_cpu_function_small(std::vector<size_t> support_list,
                                          std::string         precision,
@@ -27,8 +28,28 @@ extern "C" void
                              std::string                                    precision);
 
 extern "C" void AddCPUFunctionToPool(std::vector<size_t>                            support_list,
-                                     std::vector<std::tuple<size_t, ComputeScheme>> large1D_list);
+                                     std::vector<std::tuple<size_t, ComputeScheme>> large1D_list,
+                                     std::vector<std::vector<size_t>>               single_list);
 
 extern "C" void generate_kernel(size_t len, ComputeScheme scheme);
 
+extern "C" void get_single_support_list(const std::vector<size_t>&        support_list,
+                                        std::vector<std::vector<size_t>>& single_list);
+
+extern "C" void generate_single_kernel(const std::vector<size_t>& shape);
+
+extern "C" void write_cpu_function_single(std::vector<std::vector<size_t>> single_list,
+                                          std::string                      precision);
+
+extern "C" void get_host_support_list(const std::vector<size_t>& support_list,
+                                      std::vector<size_t>&       host_list);
+
+extern "C" void write_host_butterflies();
+
+extern "C" void write_host_function_small(std::vector<size_t> host_list, size_t group_num);
+
+extern "C" void WriteHostHeaders(std::vector<size_t> host_list);
+
+extern "C" void AddHostFunctionToPool(std::vector<size_t> host_list);
+
 #endif // generator_file_H
@@ -274,7 +274,7 @@ namespace StockhamGenerator
 
             std::string loop;
             loop += "\tfor(int i = dim; i>2; i--){\n"; // dim is a runtime variable
-            loop += "\t\tint currentLength = 1;\n";
+            loop += "\t\tsize_t currentLength = 1;\n";
             loop += "\t\tfor(int j=2; j<i; j++){\n";
             loop += "\t\t\tcurrentLength *= lengths[j];\n";
             loop += "\t\t}\n";
@@ -336,11 +336,11 @@ namespace StockhamGenerator
             /*===========the comments assume a 16-point
              * FFT============================================*/
 
-            // generate statement like "size_t counter_mod = batch*16 + (me/4);"
+            // generate statement like "size_t counter_mod = (size_t)batch*16 + (me/4);"
             std::string counter_mod;
             if(r2c2r && !rcSimple)
             {
-                counter_mod += "(batch*";
+                counter_mod += "((size_t)batch*";
                 counter_mod += std::to_string(2 * numTrans);
                 if(rc_second_index)
                     counter_mod += " + 1";
@@ -366,7 +366,7 @@ namespace StockhamGenerator
                 }
                 else
                 {
-                    counter_mod += "(batch*";
+                    counter_mod += "((size_t)batch*";
                     counter_mod += std::to_string(numTrans);
                     counter_mod += " + (me/";
                     counter_mod += std::to_string(workGroupSizePerTrans);
@@ -423,8 +423,8 @@ namespace StockhamGenerator
             loop += "\t}\n";
 
             loop += "\telse if(dim == 2){\n";
-            loop += "\t\tint counter_1 = counter_mod / lengths[1];\n";
-            loop += "\t\tint counter_mod_1 = counter_mod % lengths[1];\n";
+            loop += "\t\tsize_t counter_1 = counter_mod / lengths[1];\n";
+            loop += "\t\tsize_t counter_mod_1 = counter_mod % lengths[1];\n";
             loop += "\t\t" + offset_name1 + " += counter_1*" + stride_name1 + "[2] + counter_mod_1*"
                     + stride_name1 + "[1];\n";
             if(output == true)
@@ -433,10 +433,10 @@ namespace StockhamGenerator
             loop += "\t}\n";
 
             loop += "\telse if(dim == 3){\n";
-            loop += "\t\tint counter_2 = counter_mod / (lengths[1] * lengths[2]);\n";
-            loop += "\t\tint counter_mod_2 = counter_mod % (lengths[1] * lengths[2]);\n";
-            loop += "\t\tint counter_1 = counter_mod_2 / lengths[1];\n";
-            loop += "\t\tint counter_mod_1 = counter_mod_2 % lengths[1];\n";
+            loop += "\t\tsize_t counter_2 = counter_mod / (lengths[1] * lengths[2]);\n";
+            loop += "\t\tsize_t counter_mod_2 = counter_mod % (lengths[1] * lengths[2]);\n";
+            loop += "\t\tsize_t counter_1 = counter_mod_2 / lengths[1];\n";
+            loop += "\t\tsize_t counter_mod_1 = counter_mod_2 % lengths[1];\n";
             loop += "\t\t" + offset_name1 + " += counter_2*" + stride_name1 + "[3] + counter_1*"
                     + stride_name1 + "[2] + counter_mod_1*" + stride_name1 + "[1];\n";
             if(output == true)
@@ -446,7 +446,7 @@ namespace StockhamGenerator
 
             loop += "\telse{\n";
             loop += "\t\tfor(int i = dim; i>1; i--){\n"; // dim is a runtime variable
-            loop += "\t\t\tint currentLength = 1;\n";
+            loop += "\t\t\tsize_t currentLength = 1;\n";
             loop += "\t\t\tfor(int j=1; j<i; j++){\n";
             loop += "\t\t\t\tcurrentLength *= lengths[j];\n"; // lengths is a runtime
             // variable
@@ -581,7 +581,7 @@ namespace StockhamGenerator
                     GenerateSinglePassKernel(str, fwd, scale, inReal, outReal, true, true, p);
 
                     // TODO: double check the special cases sbrc and sbcc
-                    if(!(name_suffix == "_sbrc" || name_suffix == "_sbcc"))
+                    if(!(name_suffix == "_sbrc" || IsBlockCC(name_suffix)))
                     {
                         if(numPasses == 1)
                         {
@@ -644,13 +644,14 @@ namespace StockhamGenerator
                         str += "_device";
 
                         str += "(const T *twiddles, ";
-                        if(blockCompute && name_suffix == "_sbcc")
+                        if(blockCompute && IsBlockCC(name_suffix))
                             str += "const T *twiddles_large, "; // the blockCompute BCT_C2C
                         // algorithm use one more twiddle
                         // parameter
-                        str += "const size_t stride_in, const size_t stride_out, unsigned int "
-                               "rw, unsigned int b, ";
+                        str += "const size_t stride_in, const size_t stride_out, unsigned int rw, "
+                               "size_t b, ";
                         str += "unsigned int me, unsigned int ldsOffset, ";
+                        str += "const " + rType + " scale, ";
 
                         if(inInterleaved)
                             str += r2Type + " *lwbIn, ";
@@ -690,10 +691,10 @@ namespace StockhamGenerator
                             str += "\t";
                             str += PassName(0, fwd, length, name_suffix);
                             str += "<T, sb>(twiddles, ";
-                            if(blockCompute && name_suffix == "_sbcc")
+                            if(blockCompute && IsBlockCC(name_suffix))
                                 str += "twiddles_large, "; // the blockCompute BCT_C2C algorithm use
                             // one more twiddle parameter
-                            str += "stride_in, stride_out, rw, b, me, 0, 0,";
+                            str += "stride_in, stride_out, rw, b, me, 0, 0, scale,";
 
                             if(inInterleaved)
                                 str += " lwbIn,";
@@ -719,7 +720,7 @@ namespace StockhamGenerator
                                 str += PassName(p->GetPosition(), fwd, length, name_suffix);
                                 str += "<T, sb>(twiddles, ";
                                 // the blockCompute BCT_C2C algorithm use one more twiddle parameter
-                                if(blockCompute && name_suffix == "_sbcc")
+                                if(blockCompute && IsBlockCC(name_suffix))
                                     str += "twiddles_large, ";
                                 str += "stride_in, stride_out, rw, b, me, ";
 
@@ -774,6 +775,7 @@ namespace StockhamGenerator
                                     {
                                         str += "0, ";
                                     }
+                                    str += "scale, ";
                                     str += ldsArgs;
 
                                     if(outInterleaved)
@@ -851,7 +853,7 @@ namespace StockhamGenerator
                 */
                 str += "( ";
                 str += "const " + r2Type + " * __restrict__ twiddles, ";
-                if(blockCompute && name_suffix == "_sbcc")
+                if(blockCompute && IsBlockCC(name_suffix))
                 {
                     str += "const " + r2Type
                            + " * __restrict__ twiddles_large, "; // blockCompute introduce
@@ -863,6 +865,7 @@ namespace StockhamGenerator
                 if(placeness == rocfft_placement_notinplace)
                     str += "const size_t *stride_out, ";
                 str += "const size_t batch_count, ";
+                str += "const " + rType + " scale, ";
 
                 // Function attributes
                 if(placeness == rocfft_placement_inplace)
@@ -959,7 +962,7 @@ namespace StockhamGenerator
 
                 if(placeness == rocfft_placement_inplace)
                 {
-                    str += "unsigned int ioOffset = 0;\n\t";
+                    str += "size_t ioOffset = 0;\n\t";
 
                     // Skip if callback is set
                     if(!params.fft_hasPreCallback || !params.fft_hasPostCallback)
@@ -981,8 +984,8 @@ namespace StockhamGenerator
                 }
                 else
                 {
-                    str += "unsigned int iOffset = 0;\n\t";
-                    str += "unsigned int oOffset = 0;\n\t";
+                    str += "size_t iOffset = 0;\n\t";
+                    str += "size_t oOffset = 0;\n\t";
 
                     // Skip if precallback is set
                     if(!(params.fft_hasPreCallback))
@@ -1028,12 +1031,12 @@ namespace StockhamGenerator
                 // configurating the thread blocks
                 if((numTrans > 1) && !blockCompute)
                 {
-                    str += "\tunsigned int upper_count = batch_count;\n";
+                    str += "\tsize_t upper_count = batch_count;\n";
                     str += "\tfor(int i=1; i<dim; i++){\n";
                     str += "\t\tupper_count *= lengths[i];\n";
                     str += "\t}\n";
                     str += "\tunsigned int rw = (me < (upper_count ";
-                    str += " - batch*";
+                    str += " - (size_t)batch*";
                     str += std::to_string(numTrans);
                     str += ")*";
                     str += std::to_string(workGroupSizePerTrans);
@@ -1061,11 +1064,11 @@ namespace StockhamGenerator
                 {
                     if(numTrans == 1)
                     {
-                        str += "\tunsigned int b = batch%";
+                        str += "\tsize_t b = batch%";
                     }
                     else
                     {
-                        str += "\tunsigned int b = (batch*";
+                        str += "\tsize_t b = ((size_t)batch*";
                         str += std::to_string(numTrans);
                         str += " + (me/";
                         str += std::to_string(workGroupSizePerTrans);
@@ -1078,7 +1081,7 @@ namespace StockhamGenerator
                 }
                 else
                 {
-                    str += "\tunsigned int b = 0;\n\n";
+                    str += "\tsize_t b = 0;\n\n";
                 }
 
                 /* =====================================================================
@@ -1385,7 +1388,7 @@ namespace StockhamGenerator
                     str += "back_len";
                 str += std::to_string(length) + name_suffix;
                 str += "_device<T, sb>(twiddles, ";
-                if(blockCompute && name_suffix == "_sbcc")
+                if(blockCompute && IsBlockCC(name_suffix))
                     str += "twiddles_large, ";
                 str += "stride_in[0], ";
                 str += ((placeness == rocfft_placement_inplace) ? "stride_in[0], "
@@ -1394,6 +1397,7 @@ namespace StockhamGenerator
                 str += rw;
                 str += me;
                 str += ldsOff + ", ";
+                str += "scale, ";
 
                 str += inBuf + outBuf;
 
@@ -1765,6 +1769,159 @@ namespace StockhamGenerator
             }
         };
 
+        /* =====================================================================
+            Radices used by the host (CPU) kernel, derived from the device
+            passes; radix-16 passes are split into two radix-4 passes since
+            host butterflies are only generated for radices with split
+            real/imag register support. Returns false if the length cannot be
+            generated for the host.
+            =================================================================== */
+        bool GetHostRadices(std::vector<size_t>& hostRadices) const
+        {
+            hostRadices.clear();
+            for(auto& p : passes)
+            {
+                size_t rad = p.GetRadix();
+                switch(rad)
+                {
+                case 1:
+                    break;
+                case 16:
+                    hostRadices.push_back(4);
+                    hostRadices.push_back(4);
+                    break;
+                case 2:
+                case 3:
+                case 4:
+                case 5:
+                case 6:
+                case 7:
+                case 8:
+                case 10:
+                case 11:
+                case 13:
+                    hostRadices.push_back(rad);
+                    break;
+                default:
+                    return false;
+                }
+            }
+            return !hostRadices.empty();
+        }
+
+        /* =====================================================================
+            Generate the host (CPU) Stockham kernel. The data is kept in split
+            real/imag arrays so every pass is a straight-line sequence of
+            loads, twiddle multiplies, butterfly and stores over unit-stride
+            arrays that the host compiler vectorizes. The twiddle table holds
+            interleaved exp(-2*pi*i*m/length) for m < length.
+            =================================================================== */
+        void GenerateHostKernel(std::string& str, bool fwd) const
+        {
+            std::vector<size_t> hostRadices;
+            if(!GetHostRadices(hostRadices))
+                return;
+
+            std::string strLen = std::to_string(length);
+
+            str += "// length " + strLen + ", radices";
+            for(auto rad : hostRadices)
+                str += " " + std::to_string(rad);
+            str += "\n";
+            str += "template <typename T>\n";
+            str += "static void host_fft_";
+            str += fwd ? "fwd" : "back";
+            str += "_len" + strLen;
+            str += "(T* re, T* im, T* tre, T* tim, const T* tw)\n";
+            str += "{\n";
+
+            size_t LS = 1;
+            for(size_t p = 0; p < hostRadices.size(); p++)
+            {
+                size_t rad = hostRadices[p];
+                size_t L   = LS * rad;
+                size_t R   = length / L;
+
+                std::string src = (p % 2 == 0) ? "" : "t";
+                std::string dst = (p % 2 == 0) ? "t" : "";
+
+                str += "    // pass " + std::to_string(p) + ", radix " + std::to_string(rad)
+                       + "\n";
+                // the first pass has no twiddles and a single butterfly
+                // column, so it is vectorized along k instead of j
+                std::string indent = (LS == 1) ? "        " : "            ";
+                if(LS == 1)
+                {
+                    str += "#pragma omp simd\n";
+                    str += "    for(size_t k = 0; k < " + std::to_string(R) + "; k++)\n";
+                    str += "    {\n";
+                }
+                else
+                {
+                    str += "    for(size_t k = 0; k < " + std::to_string(R) + "; k++)\n";
+                    str += "    {\n";
+                    str += "#pragma omp simd\n";
+                    str += "        for(size_t j = 0; j < " + std::to_string(LS) + "; j++)\n";
+                    str += "        {\n";
+                }
+
+                for(size_t r = 0; r < rad; r++)
+                {
+                    std::string idx = (LS == 1) ? "k + " + std::to_string(r * R)
+                                                : "(k + " + std::to_string(r * R) + ") * "
+                                                      + std::to_string(LS) + " + j";
+                    str += indent + "T R" + std::to_string(r) + " = " + src + "re[" + idx + "], I"
+                           + std::to_string(r) + " = " + src + "im[" + idx + "];\n";
+                }
+
+                for(size_t r = 1; (LS > 1) && (r < rad); r++)
+                {
+                    std::string sr   = std::to_string(r);
+                    std::string tIdx = "j * " + std::to_string(2 * r * (length / L));
+                    str += indent + "{\n";
+                    str += indent + "    T wr = tw[" + tIdx + "], wi = " + (fwd ? "" : "-") + "tw["
+                           + tIdx + " + 1];\n";
+                    str += indent + "    T t  = R" + sr + " * wr - I" + sr + " * wi;\n";
+                    str += indent + "    I" + sr + " = R" + sr + " * wi + I" + sr + " * wr;\n";
+                    str += indent + "    R" + sr + " = t;\n";
+                    str += indent + "}\n";
+                }
+
+                str += indent + ButterflyName(rad, 1, fwd) + "(";
+                for(size_t r = 0; r < rad; r++)
+                {
+                    str += "&R" + std::to_string(r) + ", &I" + std::to_string(r);
+                    str += (r + 1 == rad) ? ");\n" : ", ";
+                }
+
+                for(size_t r = 0; r < rad; r++)
+                {
+                    std::string idx = "k * " + std::to_string(L) + ((LS == 1) ? "" : " + j")
+                                      + " + " + std::to_string(r * LS);
+                    str += indent + dst + "re[" + idx + "] = R" + std::to_string(r) + "; " + dst
+                           + "im[" + idx + "] = I" + std::to_string(r) + ";\n";
+                }
+
+                if(LS > 1)
+                    str += "        }\n";
+                str += "    }\n";
+
+                LS *= rad;
+            }
+
+            // an odd number of passes leaves the result in the temp arrays
+            if(hostRadices.size() % 2 == 1)
+            {
+                str += "#pragma omp simd\n";
+                str += "    for(size_t i = 0; i < " + strLen + "; i++)\n";
+                str += "    {\n";
+                str += "        re[i] = tre[i];\n";
+                str += "        im[i] = tim[i];\n";
+                str += "    }\n";
+            }
+            str += "}\n\n";
+        }
+
         /* =====================================================================
             This is the main entrance to generate all device code.
             Notes:
@@ -56,6 +56,38 @@ int generate_support_size_list(std::vector<size_t>& support_size_list,
     return 0;
 }
 
+/* =====================================================================
+    Append the sizes with radix-7, 11 or 13 factors up to the upper bound:
+    multiples of 7 that are 7-smooth, and 2^a * 11^b or 2^a * 13^b
+=================================================================== */
+
+int generate_support_size_list_7_11_13(std::vector<size_t>& support_size_list,
+                                       size_t               upper_bound)
+{
+    for(size_t len = 7; len <= upper_bound; len += 7)
+    {
+        size_t p = len;
+        for(size_t rad : {2, 3, 5, 7})
+        {
+            while(!(p % rad))
+                p /= rad;
+        }
+        if(p == 1)
+            support_size_list.push_back(len);
+    }
+
+    for(size_t rad : {11, 13})
+    {
+        for(size_t i = rad; i <= upper_bound; i *= rad)
+        {
+            for(size_t len = i; len <= upper_bound; len *= 2)
+                support_size_list.push_back(len);
+        }
+    }
+
+    return 0;
+}
+
 int main(int argc, char* argv[])
 {
 
@@ -116,16 +148,20 @@ int main(int argc, char* argv[])
         }
         else if(strcmp(argv[1], "all") == 0)
         {
-            // printf("Generating len mix of 2,3,5 FFT kernels\n");
+            // printf("Generating len mix of 2,3,5,7,11,13 FFT kernels\n");
             generate_support_size_list(
                 support_size_list, 3125, 2187, Large1DThreshold(rocfft_precision_single));
+            generate_support_size_list_7_11_13(support_size_list,
+                                               Large1DThreshold(rocfft_precision_single));
         }
     }
     else
     { // if no arguments, generate all possible sizes
-        // printf("Generating len mix of 2,3,5 FFT kernels\n");
+        // printf("Generating len mix of 2,3,5,7,11,13 FFT kernels\n");
         generate_support_size_list(
             support_size_list, 3125, 2187, Large1DThreshold(rocfft_precision_single));
+        generate_support_size_list_7_11_13(support_size_list,
+                                           Large1DThreshold(rocfft_precision_single));
     }
 
     if(argc > 2)
@@ -138,14 +174,6 @@ int main(int argc, char* argv[])
         }
     }
 
-    /*
-      for(size_t i=7;i<=2401;i*=7){
-          printf("Generating len %d FFT kernels\n", (int)i);
-          generate_kernel(i);
-          support_size_list.push_back(i);
-      }
-  */
-
     /* =====================================================================
      generate small kernel into *.h file
   =================================================================== */
@@ -177,6 +205,11 @@ int main(int argc, char* argv[])
     large1D_list.push_back(std::make_tuple(128, CS_KERNEL_STOCKHAM_BLOCK_RC));
     large1D_list.push_back(std::make_tuple(256, CS_KERNEL_STOCKHAM_BLOCK_RC));
 
+    // column kernels of the 2D and 3D row-column schemes
+    large1D_list.push_back(std::make_tuple(64, CS_KERNEL_2D_STOCKHAM_BLOCK_CC));
+    large1D_list.push_back(std::make_tuple(128, CS_KERNEL_2D_STOCKHAM_BLOCK_CC));
+    large1D_list.push_back(std::make_tuple(256, CS_KERNEL_2D_STOCKHAM_BLOCK_CC));
+
     for(int i = 0; i < large1D_list.size(); i++)
     {
         auto my_tuple = large1D_list[i];
@@ -186,11 +219,38 @@ int main(int argc, char* argv[])
     write_cpu_function_large(large1D_list, "single");
     write_cpu_function_large(large1D_list, "double");
 
+    /* =====================================================================
+     fused 2D and 3D kernels, which run the small kernels above along each
+     dimension of a transform kept in LDS
+  =================================================================== */
+
+    std::vector<std::vector<size_t>> single_list;
+    get_single_support_list(support_size_list, single_list);
+
+    for(const auto& shape : single_list)
+        generate_single_kernel(shape);
+
+    write_cpu_function_single(single_list, "single");
+    write_cpu_function_single(single_list, "double");
+
     // write big size CPU functions; one file for one size
 
     // printf("Write CPU functions declaration to *.h file \n");
-    WriteCPUHeaders(support_size_list, large1D_list);
+    WriteCPUHeaders(support_size_list, large1D_list, single_list);
 
     // printf("Add CPU function into hash map \n");
-    AddCPUFunctionToPool(support_size_list, large1D_list);
+    AddCPUFunctionToPool(support_size_list, large1D_list, single_list);
+
+    /* =====================================================================
+     generate host (CPU) Stockham kernels for the host execution backend,
+     sbcc/sbrc lengths are covered by the small sizes
+  =================================================================== */
+
+    std::vector<size_t> host_size_list;
+    get_host_support_list(support_size_list, host_size_list);
+
+    write_host_butterflies();
+    write_host_function_small(host_size_list, small_kernels_group_num);
+    WriteHostHeaders(host_size_list);
+    AddHostFunctionToPool(host_size_list);
 }
@@ -175,12 +175,14 @@ namespace StockhamGenerator
         // SweepRegs is to iterate through the registers to do the three basic
         // operations:
         // reading, twiddle multiplication, writing
+        // scale is the expression the written values are multiplied by, or
+        // empty
         void SweepRegs(size_t             flag,
                        bool               fwd,
                        bool               interleaved,
                        size_t             stride,
                        size_t             component,
-                       double             scale,
+                       const std::string& scale,
                        bool               frontTwiddle,
                        const std::string& bufferRe,
                        const std::string& bufferIm,
@@ -315,11 +317,10 @@ namespace StockhamGenerator
                         passStr += ".x, ";
                         passStr += regIndexB;
                         passStr += ".y) ";
-                        if(scale != 1.0f)
+                        if(!scale.empty())
                         {
                             passStr += " * ";
-                            passStr += FloatToStr(scale);
-                            passStr += FloatSuffix<PR>();
+                            passStr += scale;
                         }
                         passStr += ";";
 
@@ -530,11 +531,10 @@ namespace StockhamGenerator
                             bufOffset += " )";
                             bufOffset += (stride == 1) ? " " : "*stride_out";
 
-                            if(scale != 1.0f)
+                            if(!scale.empty())
                             {
                                 regIndex += " * ";
-                                regIndex += FloatToStr(scale);
-                                regIndex += FloatSuffix<PR>();
+                                regIndex += scale;
                             }
                             if(c == cStart)
                                 regIndexC0 = regIndex;
@@ -946,11 +946,10 @@ namespace StockhamGenerator
 
                                 passStr += "\n\t";
 
-                                if(scale != 1.0f)
+                                if(!scale.empty())
                                 {
                                     regIndex += " * ";
-                                    regIndex += FloatToStr(scale);
-                                    regIndex += FloatSuffix<PR>();
+                                    regIndex += scale;
                                 }
                                 if(c == 0)
                                     regIndexC0 += regIndex;
@@ -1022,7 +1021,7 @@ namespace StockhamGenerator
                          bool               interleaved,
                          size_t             stride,
                          size_t             component,
-                         double             scale,
+                         const std::string& scale,
                          bool               setZero,
                          bool               batch2,
                          bool               oddt,
@@ -1288,11 +1287,10 @@ namespace StockhamGenerator
                             std::string oddpadd = oddp ? " (me/2) + " : " ";
 
                             std::string sclStr = "";
-                            if(scale != 1.0f)
+                            if(!scale.empty())
                             {
                                 sclStr += " * ";
-                                sclStr += FloatToStr(scale);
-                                sclStr += FloatSuffix<PR>();
+                                sclStr += scale;
                             }
 
                             if(fwd)
@@ -1717,10 +1715,21 @@ namespace StockhamGenerator
                           bool         outReal,
                           size_t       inStride,
                           size_t       outStride,
-                          double       scale,
+                          double       constScale,
                           bool         gIn  = false,
                           bool         gOut = false) const
         {
+            // The last pass multiplies the values it stores by the scale
+            // argument of the plan, and by the scale of the generator
+            // parameters.
+            std::string scale;
+            if(nextPass == NULL)
+            {
+                scale = "scale";
+                if(constScale != 1.0)
+                    scale += " * " + FloatToStr(constScale) + FloatSuffix<PR>();
+            }
+
             const std::string bufferInRe  = (inReal || inInterleaved) ? "bufIn" : "bufInRe";
             const std::string bufferInIm  = (inReal || inInterleaved) ? "bufIn" : "bufInIm";
             const std::string bufferOutRe = (outReal || outInterleaved) ? "bufOut" : "bufOutRe";
@@ -1760,15 +1769,17 @@ namespace StockhamGenerator
 
             // Function arguments
             passStr += "(const " + regB2Type + " *twiddles, ";
-            if(name_suffix == "_sbcc")
+            if(IsBlockCC(name_suffix))
                 passStr += "const " + regB2Type
                            + " *twiddles_large, "; // the blockCompute BCT_C2C algorithm use
             // one more twiddle parameter
             passStr += "const size_t stride_in, const size_t stride_out, ";
-            passStr += "unsigned int rw, unsigned int b, ";
+            passStr += "unsigned int rw, size_t b, ";
             if(realSpecial)
                 passStr += "unsigned int t, ";
             passStr += "unsigned int me, unsigned int inOffset, unsigned int outOffset, ";
+            if(nextPass == NULL)
+                passStr += "const " + regB1Type + " scale, ";
 
             if(r2c || c2r)
             {
@@ -2055,7 +2066,7 @@ namespace StockhamGenerator
                               inInterleaved,
                               inStride,
                               SR_COMP_REAL,
-                              1.0f,
+                              "",
                               false,
                               bufferInRe,
                               bufferInIm,
@@ -2074,7 +2085,7 @@ namespace StockhamGenerator
                                     inInterleaved,
                                     inStride,
                                     SR_COMP_IMAG,
-                                    1.0f,
+                                    "",
                                     true,
                                     true,
                                     false,
@@ -2093,7 +2104,7 @@ namespace StockhamGenerator
                                   inInterleaved,
                                   inStride,
                                   SR_COMP_IMAG,
-                                  1.0f,
+                                  "",
                                   false,
                                   bufferInRe2,
                                   bufferInIm2,
@@ -2111,7 +2122,7 @@ namespace StockhamGenerator
                                     inInterleaved,
                                     inStride,
                                     SR_COMP_IMAG,
-                                    1.0f,
+                                    "",
                                     true,
                                     true,
                                     false,
@@ -2163,7 +2174,7 @@ namespace StockhamGenerator
                                     inInterleaved,
                                     inStride,
                                     SR_COMP_REAL,
-                                    1.0f,
+                                    "",
                                     false,
                                     false,
                                     false,
@@ -2181,7 +2192,7 @@ namespace StockhamGenerator
                                     inInterleaved,
                                     inStride,
                                     SR_COMP_REAL,
-                                    1.0f,
+                                    "",
                                     false,
                                     true,
                                     false,
@@ -2196,7 +2207,7 @@ namespace StockhamGenerator
                                     inInterleaved,
                                     inStride,
                                     SR_COMP_REAL,
-                                    1.0f,
+                                    "",
                                     true,
                                     true,
                                     false,
@@ -2215,7 +2226,7 @@ namespace StockhamGenerator
                                         inInterleaved,
                                         inStride,
                                         SR_COMP_REAL,
-                                        1.0f,
+                                        "",
                                         false,
                                         false,
                                         true,
@@ -2232,7 +2243,7 @@ namespace StockhamGenerator
                                         inInterleaved,
                                         inStride,
                                         SR_COMP_REAL,
-                                        1.0f,
+                                        "",
                                         false,
                                         true,
                                         true,
@@ -2249,7 +2260,7 @@ namespace StockhamGenerator
                                     outInterleaved,
                                     processBufStride,
                                     SR_COMP_REAL,
-                                    1.0f,
+                                    "",
                                     false,
                                     true,
                                     false,
@@ -2265,7 +2276,7 @@ namespace StockhamGenerator
                                         outInterleaved,
                                         processBufStride,
                                         SR_COMP_REAL,
-                                        1.0f,
+                                        "",
                                         false,
                                         true,
                                         true,
@@ -2280,7 +2291,7 @@ namespace StockhamGenerator
                                     outInterleaved,
                                     processBufStride,
                                     SR_COMP_REAL,
-                                    1.0f,
+                                    "",
                                     false,
                                     false,
                                     false,
@@ -2296,7 +2307,7 @@ namespace StockhamGenerator
                                         outInterleaved,
                                         processBufStride,
                                         SR_COMP_REAL,
-                                        1.0f,
+                                        "",
                                         false,
                                         false,
                                         true,
@@ -2314,7 +2325,7 @@ namespace StockhamGenerator
                               outInterleaved,
                               processBufStride,
                               SR_COMP_REAL,
-                              1.0f,
+                              "",
                               false,
                               processBufRe,
                               processBufIm,
@@ -2356,7 +2367,7 @@ namespace StockhamGenerator
                                         inInterleaved,
                                         inStride,
                                         SR_COMP_IMAG,
-                                        1.0f,
+                                        "",
                                         false,
                                         false,
                                         false,
@@ -2372,7 +2383,7 @@ namespace StockhamGenerator
                                         inInterleaved,
                                         inStride,
                                         SR_COMP_IMAG,
-                                        1.0f,
+                                        "",
                                         false,
                                         true,
                                         false,
@@ -2386,7 +2397,7 @@ namespace StockhamGenerator
                                         inInterleaved,
                                         inStride,
                                         SR_COMP_IMAG,
-                                        1.0f,
+                                        "",
                                         true,
                                         true,
                                         false,
@@ -2404,7 +2415,7 @@ namespace StockhamGenerator
                                             inInterleaved,
                                             inStride,
                                             SR_COMP_IMAG,
-                                            1.0f,
+                                            "",
                                             false,
                                             false,
                                             true,
@@ -2419,7 +2430,7 @@ namespace StockhamGenerator
                                             inInterleaved,
                                             inStride,
                                             SR_COMP_IMAG,
-                                            1.0f,
+                                            "",
                                             false,
                                             true,
                                             true,
@@ -2437,7 +2448,7 @@ namespace StockhamGenerator
                                     outInterleaved,
                                     processBufStride,
                                     SR_COMP_IMAG,
-                                    1.0f,
+                                    "",
                                     false,
                                     true,
                                     false,
@@ -2453,7 +2464,7 @@ namespace StockhamGenerator
                                         outInterleaved,
                                         processBufStride,
                                         SR_COMP_IMAG,
-                                        1.0f,
+                                        "",
                                         false,
                                         true,
                                         true,
@@ -2468,7 +2479,7 @@ namespace StockhamGenerator
                                     outInterleaved,
                                     processBufStride,
                                     SR_COMP_IMAG,
-                                    1.0f,
+                                    "",
                                     false,
                                     false,
                                     false,
@@ -2484,7 +2495,7 @@ namespace StockhamGenerator
                                         outInterleaved,
                                         processBufStride,
                                         SR_COMP_IMAG,
-                                        1.0f,
+                                        "",
                                         false,
                                         false,
                                         true,
@@ -2502,7 +2513,7 @@ namespace StockhamGenerator
                               outInterleaved,
                               processBufStride,
                               SR_COMP_IMAG,
-                              1.0f,
+                              "",
                               false,
                               processBufRe,
                               processBufIm,
@@ -2526,7 +2537,7 @@ namespace StockhamGenerator
                               inInterleaved,
                               inStride,
                               SR_COMP_BOTH,
-                              1.0f,
+                              "",
                               false,
                               bufferInRe,
                               bufferInIm,
@@ -2541,7 +2552,7 @@ namespace StockhamGenerator
                               inInterleaved,
                               inStride,
                               SR_COMP_BOTH,
-                              1.0f,
+                              "",
                               false,
                               bufferInRe,
                               bufferInIm,
@@ -2556,7 +2567,7 @@ namespace StockhamGenerator
                               inInterleaved,
                               inStride,
                               SR_COMP_BOTH,
-                              1.0f,
+                              "",
                               false,
                               bufferInRe,
                               bufferInIm,
@@ -2584,7 +2595,7 @@ namespace StockhamGenerator
                               false,
                               1,
                               SR_COMP_BOTH,
-                              1.0f,
+                              "",
                               true,
                               bufferInRe,
                               bufferInIm,
@@ -2601,7 +2612,7 @@ namespace StockhamGenerator
                               false,
                               1,
                               SR_COMP_BOTH,
-                              1.0f,
+                              "",
                               true,
                               bufferInRe,
                               bufferInIm,
@@ -2615,7 +2626,7 @@ namespace StockhamGenerator
                               false,
                               1,
                               SR_COMP_BOTH,
-                              1.0f,
+                              "",
                               true,
                               bufferInRe,
                               bufferInIm,
@@ -2629,7 +2640,7 @@ namespace StockhamGenerator
                               false,
                               1,
                               SR_COMP_BOTH,
-                              1.0f,
+                              "",
                               true,
                               bufferInRe,
                               bufferInIm,
@@ -2651,7 +2662,7 @@ namespace StockhamGenerator
                           false,
                           1,
                           SR_COMP_BOTH,
-                          1.0f,
+                          "",
                           false,
                           bufferInRe,
                           bufferInIm,
@@ -2665,7 +2676,7 @@ namespace StockhamGenerator
                           false,
                           1,
                           SR_COMP_BOTH,
-                          1.0f,
+                          "",
                           false,
                           bufferInRe,
                           bufferInIm,
@@ -2679,7 +2690,7 @@ namespace StockhamGenerator
                           false,
                           1,
                           SR_COMP_BOTH,
-                          1.0f,
+                          "",
                           false,
                           bufferInRe,
                           bufferInIm,
@@ -2716,7 +2727,7 @@ namespace StockhamGenerator
                               false,
                               1,
                               SR_COMP_BOTH,
-                              1.0f,
+                              "",
                               false,
                               bufferInRe,
                               bufferInIm,
@@ -2733,7 +2744,7 @@ namespace StockhamGenerator
                               false,
                               1,
                               SR_COMP_BOTH,
-                              1.0f,
+                              "",
                               false,
                               bufferInRe,
                               bufferInIm,
@@ -2747,7 +2758,7 @@ namespace StockhamGenerator
                               false,
                               1,
                               SR_COMP_BOTH,
-                              1.0f,
+                              "",
                               false,
                               bufferInRe,
                               bufferInIm,
@@ -2761,7 +2772,7 @@ namespace StockhamGenerator
                               false,
                               1,
                               SR_COMP_BOTH,
-                              1.0f,
+                              "",
                               false,
                               bufferInRe,
                               bufferInIm,
@@ -2792,7 +2803,7 @@ namespace StockhamGenerator
                                       inInterleaved,
                                       inStride,
                                       SR_COMP_REAL,
-                                      1.0f,
+                                      "",
                                       false,
                                       bufferInRe,
                                       bufferInIm,
@@ -2807,7 +2818,7 @@ namespace StockhamGenerator
                                         inInterleaved,
                                         inStride,
                                         SR_COMP_REAL,
-                                        1.0f,
+                                        "",
                                         false,
                                         false,
                                         false,
@@ -2823,7 +2834,7 @@ namespace StockhamGenerator
                                             inInterleaved,
                                             inStride,
                                             SR_COMP_REAL,
-                                            1.0f,
+                                            "",
                                             false,
                                             false,
                                             true,
@@ -2842,11 +2853,10 @@ namespace StockhamGenerator
                                 passStr += "[outOffset].x = ";
                                 passStr += bufferInRe;
                                 passStr += "[inOffset]";
-                                if(scale != 1.0)
+                                if(!scale.empty())
                                 {
                                     passStr += " * ";
-                                    passStr += FloatToStr(scale);
-                                    passStr += FloatSuffix<PR>();
+                                    passStr += scale;
                                 }
                                 passStr += ";\n\t";
                                 passStr += bufferOutIm;
@@ -2860,11 +2870,10 @@ namespace StockhamGenerator
                                 passStr += "[outOffset] = ";
                                 passStr += bufferInRe;
                                 passStr += "[inOffset]";
-                                if(scale != 1.0)
+                                if(!scale.empty())
                                 {
                                     passStr += " * ";
-                                    passStr += FloatToStr(scale);
-                                    passStr += FloatSuffix<PR>();
+                                    passStr += scale;
                                 }
                                 passStr += ";\n\t";
                                 passStr += bufferOutIm;
@@ -2878,7 +2887,7 @@ namespace StockhamGenerator
                                       inInterleaved,
                                       inStride,
                                       SR_COMP_IMAG,
-                                      1.0f,
+                                      "",
                                       false,
                                       bufferInRe,
                                       bufferInIm,
@@ -2893,7 +2902,7 @@ namespace StockhamGenerator
                                         inInterleaved,
                                         inStride,
                                         SR_COMP_IMAG,
-                                        1.0f,
+                                        "",
                                         false,
                                         false,
                                         false,
@@ -2909,7 +2918,7 @@ namespace StockhamGenerator
                                             inInterleaved,
                                             inStride,
                                             SR_COMP_IMAG,
-                                            1.0f,
+                                            "",
                                             false,
                                             false,
                                             true,
@@ -2928,11 +2937,10 @@ namespace StockhamGenerator
                                 passStr += "[outOffset].x = ";
                                 passStr += bufferInIm;
                                 passStr += "[inOffset]";
-                                if(scale != 1.0)
+                                if(!scale.empty())
                                 {
                                     passStr += " * ";
-                                    passStr += FloatToStr(scale);
-                                    passStr += FloatSuffix<PR>();
+                                    passStr += scale;
                                 }
                                 passStr += ";\n\t";
                                 passStr += bufferOutIm2;
@@ -2946,11 +2954,10 @@ namespace StockhamGenerator
                                 passStr += "[outOffset] = ";
                                 passStr += bufferInIm;
                                 passStr += "[inOffset]";
-                                if(scale != 1.0)
+                                if(!scale.empty())
                                 {
                                     passStr += " * ";
-                                    passStr += FloatToStr(scale);
-                                    passStr += FloatSuffix<PR>();
+                                    passStr += scale;
                                 }
                                 passStr += ";\n\t";
                                 passStr += bufferOutIm2;
@@ -173,6 +173,13 @@ namespace StockhamGenerator
         return str;
     }
 
+    // The block column kernels of the large 1D (_sbcc) and of the 2D/3D
+    // row-column (_sbcc_md) schemes share the same interface
+    inline bool IsBlockCC(const std::string& name_suffix)
+    {
+        return name_suffix.compare(0, 5, "_sbcc") == 0;
+    }
+
     inline std::string TwTableName()
     {
         return "twiddles";
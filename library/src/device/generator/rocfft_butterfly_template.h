@@ -698,6 +698,788 @@ __device__ void InvRad10B1(T* R0, T* R1, T* R2, T* R3, T* R4, T* R5, T* R6, T* R
     (*R9).y = TI8 - (C5QD * TR9 - C5QE * TI9);
 }
 
+template <typename T>
+__device__ void FwdRad11B1(T* R0,
+                           T* R1,
+                           T* R2,
+                           T* R3,
+                           T* R4,
+                           T* R5,
+                           T* R6,
+                           T* R7,
+                           T* R8,
+                           T* R9,
+                           T* R10)
+{
+    const real_type_t<T> dir = -1;
+
+    real_type_t<T> p0, p1, p2, p3, p4, p5, p6, p7, p8, p9;
+    p0 = ((*R1).x - (*R10).x) * dir;
+    p1 = (*R1).x + (*R10).x;
+    p2 = ((*R5).x - (*R6).x) * dir;
+    p3 = (*R5).x + (*R6).x;
+    p4 = ((*R2).x - (*R9).x) * dir;
+    p5 = (*R2).x + (*R9).x;
+    p6 = ((*R3).x - (*R8).x) * dir;
+    p7 = (*R3).x + (*R8).x;
+    p8 = (*R4).x + (*R7).x;
+    p9 = ((*R4).x - (*R7).x) * dir;
+
+    real_type_t<T> r0, r1, r2, r3, r4, r5, r6, r7, r8, r9;
+    r0 = p4 - p0 * b11_9;
+    r1 = p0 + p2 * b11_9;
+    r2 = p2 + p6 * b11_9;
+    r3 = p6 + p9 * b11_9;
+    r4 = p9 - p4 * b11_9;
+    r5 = p7 - p1 * b11_8;
+    r6 = p5 - p7 * b11_8;
+    r7 = p1 - p8 * b11_8;
+    r8 = p3 - p5 * b11_8;
+    r9 = p8 - p3 * b11_8;
+
+    real_type_t<T> s0, s1, s2, s3, s4, s5, s6, s7, s8, s9;
+    s0 = p6 - r0 * b11_6;
+    s1 = p9 + r1 * b11_6;
+    s2 = p4 - r2 * b11_6;
+    s3 = p0 + r3 * b11_6;
+    s4 = p2 + r4 * b11_6;
+    s5 = p3 - r5 * b11_7;
+    s6 = p8 - r6 * b11_7;
+    s7 = p5 - r7 * b11_7;
+    s8 = p1 - r8 * b11_7;
+    s9 = p7 - r9 * b11_7;
+
+    real_type_t<T> p10, p11, p12, p13, p14, p15, p16, p17, p18, p19;
+    p10 = ((*R10).y - (*R1).y) * dir;
+    p11 = (*R1).y + (*R10).y;
+    p12 = ((*R9).y - (*R2).y) * dir;
+    p13 = (*R2).y + (*R9).y;
+    p14 = ((*R8).y - (*R3).y) * dir;
+    p15 = (*R3).y + (*R8).y;
+    p16 = ((*R7).y - (*R4).y) * dir;
+    p17 = (*R4).y + (*R7).y;
+    p18 = ((*R6).y - (*R5).y) * dir;
+    p19 = (*R5).y + (*R6).y;
+
+    real_type_t<T> r10, r11, r12, r13, r14, r15, r16, r17, r18, r19;
+    r10 = p12 - p10 * b11_9;
+    r11 = p16 - p12 * b11_9;
+    r12 = p18 + p14 * b11_9;
+    r13 = p14 + p16 * b11_9;
+    r14 = p10 + p18 * b11_9;
+    r15 = p15 - p11 * b11_8;
+    r16 = p19 - p13 * b11_8;
+    r17 = p13 - p15 * b11_8;
+    r18 = p11 - p17 * b11_8;
+    r19 = p17 - p19 * b11_8;
+
+    real_type_t<T> s10, s11, s12, s13, s14, s15, s16, s17, s18, s19;
+    s10 = p14 - r10 * b11_6;
+    s11 = p18 + r11 * b11_6;
+    s12 = p12 - r12 * b11_6;
+    s13 = p10 + r13 * b11_6;
+    s14 = p16 + r14 * b11_6;
+    s15 = p19 - r15 * b11_7;
+    s16 = p11 - r16 * b11_7;
+    s17 = p17 - r17 * b11_7;
+    s18 = p13 - r18 * b11_7;
+    s19 = p15 - r19 * b11_7;
+
+    real_type_t<T> v0, v1, v2, v3, v4, v5, v6, v7, v8, v9;
+    real_type_t<T> v10, v11, v12, v13, v14, v15, v16, v17, v18, v19;
+    v0  = p9 - s0 * b11_4;
+    v1  = p4 + s1 * b11_4;
+    v2  = p0 + s2 * b11_4;
+    v3  = p2 - s3 * b11_4;
+    v4  = p6 - s4 * b11_4;
+    v5  = p8 - s5 * b11_5;
+    v6  = p1 - s6 * b11_5;
+    v7  = p3 - s7 * b11_5;
+    v8  = p7 - s8 * b11_5;
+    v9  = p5 - s9 * b11_5;
+    v10 = p16 - s10 * b11_4;
+    v11 = p14 - s11 * b11_4;
+    v12 = p10 + s12 * b11_4;
+    v13 = p18 - s13 * b11_4;
+    v14 = p12 + s14 * b11_4;
+    v15 = p17 - s15 * b11_5;
+    v16 = p15 - s16 * b11_5;
+    v17 = p11 - s17 * b11_5;
+    v18 = p19 - s18 * b11_5;
+    v19 = p13 - s19 * b11_5;
+
+    real_type_t<T> w0, w1, w2, w3, w4, w5, w6, w7, w8, w9;
+    real_type_t<T> w10, w11, w12, w13, w14, w15, w16, w17, w18, w19;
+    w0  = p2 - v0 * b11_2;
+    w1  = p6 + v1 * b11_2;
+    w2  = p9 - v2 * b11_2;
+    w3  = p4 + v3 * b11_2;
+    w4  = p0 - v4 * b11_2;
+    w5  = p5 - v5 * b11_3;
+    w6  = p3 - v6 * b11_3;
+    w7  = p7 - v7 * b11_3;
+    w8  = p8 - v8 * b11_3;
+    w9  = p1 - v9 * b11_3;
+    w10 = p18 - v10 * b11_2;
+    w11 = p10 - v11 * b11_2;
+    w12 = p16 - v12 * b11_2;
+    w13 = p12 + v13 * b11_2;
+    w14 = p14 + v14 * b11_2;
+    w15 = p13 - v15 * b11_3;
+    w16 = p17 - v16 * b11_3;
+    w17 = p19 - v17 * b11_3;
+    w18 = p15 - v18 * b11_3;
+    w19 = p11 - v19 * b11_3;
+
+    real_type_t<T> z0, z1, z2, z3, z4, z5, z6, z7, z8, z9;
+    z0 = (*R0).x - w5 * b11_1;
+    z1 = (*R0).x - w6 * b11_1;
+    z2 = (*R0).x - w7 * b11_1;
+    z3 = (*R0).x - w8 * b11_1;
+    z4 = (*R0).x - w9 * b11_1;
+    z5 = (*R0).y - w15 * b11_1;
+    z6 = (*R0).y - w16 * b11_1;
+    z7 = (*R0).y - w17 * b11_1;
+    z8 = (*R0).y - w18 * b11_1;
+    z9 = (*R0).y - w19 * b11_1;
+
+    (*R0).x  = (*R0).x + p1 + p3 + p5 + p7 + p8;
+    (*R0).y  = (*R0).y + p11 + p13 + p15 + p17 + p19;
+    (*R1).x  = z1 + w14 * b11_0;
+    (*R1).y  = z7 + w1 * b11_0;
+    (*R2).x  = z2 - w12 * b11_0;
+    (*R2).y  = z8 - w2 * b11_0;
+    (*R3).x  = z0 + w11 * b11_0;
+    (*R3).y  = z5 + w4 * b11_0;
+    (*R4).x  = z3 - w13 * b11_0;
+    (*R4).y  = z6 - w3 * b11_0;
+    (*R5).x  = z4 + w10 * b11_0;
+    (*R5).y  = z9 + w0 * b11_0;
+    (*R6).x  = z4 - w10 * b11_0;
+    (*R6).y  = z9 - w0 * b11_0;
+    (*R7).x  = z3 + w13 * b11_0;
+    (*R7).y  = z6 + w3 * b11_0;
+    (*R8).x  = z0 - w11 * b11_0;
+    (*R8).y  = z5 - w4 * b11_0;
+    (*R9).x  = z2 + w12 * b11_0;
+    (*R9).y  = z8 + w2 * b11_0;
+    (*R10).x = z1 - w14 * b11_0;
+    (*R10).y = z7 - w1 * b11_0;
+}
+
+template <typename T>
+__device__ void InvRad11B1(T* R0,
+                           T* R1,
+                           T* R2,
+                           T* R3,
+                           T* R4,
+                           T* R5,
+                           T* R6,
+                           T* R7,
+                           T* R8,
+                           T* R9,
+                           T* R10)
+{
+    const real_type_t<T> dir = 1;
+
+    real_type_t<T> p0, p1, p2, p3, p4, p5, p6, p7, p8, p9;
+    p0 = ((*R1).x - (*R10).x) * dir;
+    p1 = (*R1).x + (*R10).x;
+    p2 = ((*R5).x - (*R6).x) * dir;
+    p3 = (*R5).x + (*R6).x;
+    p4 = ((*R2).x - (*R9).x) * dir;
+    p5 = (*R2).x + (*R9).x;
+    p6 = ((*R3).x - (*R8).x) * dir;
+    p7 = (*R3).x + (*R8).x;
+    p8 = (*R4).x + (*R7).x;
+    p9 = ((*R4).x - (*R7).x) * dir;
+
+    real_type_t<T> r0, r1, r2, r3, r4, r5, r6, r7, r8, r9;
+    r0 = p4 - p0 * b11_9;
+    r1 = p0 + p2 * b11_9;
+    r2 = p2 + p6 * b11_9;
+    r3 = p6 + p9 * b11_9;
+    r4 = p9 - p4 * b11_9;
+    r5 = p7 - p1 * b11_8;
+    r6 = p5 - p7 * b11_8;
+    r7 = p1 - p8 * b11_8;
+    r8 = p3 - p5 * b11_8;
+    r9 = p8 - p3 * b11_8;
+
+    real_type_t<T> s0, s1, s2, s3, s4, s5, s6, s7, s8, s9;
+    s0 = p6 - r0 * b11_6;
+    s1 = p9 + r1 * b11_6;
+    s2 = p4 - r2 * b11_6;
+    s3 = p0 + r3 * b11_6;
+    s4 = p2 + r4 * b11_6;
+    s5 = p3 - r5 * b11_7;
+    s6 = p8 - r6 * b11_7;
+    s7 = p5 - r7 * b11_7;
+    s8 = p1 - r8 * b11_7;
+    s9 = p7 - r9 * b11_7;
+
+    real_type_t<T> p10, p11, p12, p13, p14, p15, p16, p17, p18, p19;
+    p10 = ((*R10).y - (*R1).y) * dir;
+    p11 = (*R1).y + (*R10).y;
+    p12 = ((*R9).y - (*R2).y) * dir;
+    p13 = (*R2).y + (*R9).y;
+    p14 = ((*R8).y - (*R3).y) * dir;
+    p15 = (*R3).y + (*R8).y;
+    p16 = ((*R7).y - (*R4).y) * dir;
+    p17 = (*R4).y + (*R7).y;
+    p18 = ((*R6).y - (*R5).y) * dir;
+    p19 = (*R5).y + (*R6).y;
+
+    real_type_t<T> r10, r11, r12, r13, r14, r15, r16, r17, r18, r19;
+    r10 = p12 - p10 * b11_9;
+    r11 = p16 - p12 * b11_9;
+    r12 = p18 + p14 * b11_9;
+    r13 = p14 + p16 * b11_9;
+    r14 = p10 + p18 * b11_9;
+    r15 = p15 - p11 * b11_8;
+    r16 = p19 - p13 * b11_8;
+    r17 = p13 - p15 * b11_8;
+    r18 = p11 - p17 * b11_8;
+    r19 = p17 - p19 * b11_8;
+
+    real_type_t<T> s10, s11, s12, s13, s14, s15, s16, s17, s18, s19;
+    s10 = p14 - r10 * b11_6;
+    s11 = p18 + r11 * b11_6;
+    s12 = p12 - r12 * b11_6;
+    s13 = p10 + r13 * b11_6;
+    s14 = p16 + r14 * b11_6;
+    s15 = p19 - r15 * b11_7;
+    s16 = p11 - r16 * b11_7;
+    s17 = p17 - r17 * b11_7;
+    s18 = p13 - r18 * b11_7;
+    s19 = p15 - r19 * b11_7;
+
+    real_type_t<T> v0, v1, v2, v3, v4, v5, v6, v7, v8, v9;
+    real_type_t<T> v10, v11, v12, v13, v14, v15, v16, v17, v18, v19;
+    v0  = p9 - s0 * b11_4;
+    v1  = p4 + s1 * b11_4;
+    v2  = p0 + s2 * b11_4;
+    v3  = p2 - s3 * b11_4;
+    v4  = p6 - s4 * b11_4;
+    v5  = p8 - s5 * b11_5;
+    v6  = p1 - s6 * b11_5;
+    v7  = p3 - s7 * b11_5;
+    v8  = p7 - s8 * b11_5;
+    v9  = p5 - s9 * b11_5;
+    v10 = p16 - s10 * b11_4;
+    v11 = p14 - s11 * b11_4;
+    v12 = p10 + s12 * b11_4;
+    v13 = p18 - s13 * b11_4;
+    v14 = p12 + s14 * b11_4;
+    v15 = p17 - s15 * b11_5;
+    v16 = p15 - s16 * b11_5;
+    v17 = p11 - s17 * b11_5;
+    v18 = p19 - s18 * b11_5;
+    v19 = p13 - s19 * b11_5;
+
+    real_type_t<T> w0, w1, w2, w3, w4, w5, w6, w7, w8, w9;
+    real_type_t<T> w10, w11, w12, w13, w14, w15, w16, w17, w18, w19;
+    w0  = p2 - v0 * b11_2;
+    w1  = p6 + v1 * b11_2;
+    w2  = p9 - v2 * b11_2;
+    w3  = p4 + v3 * b11_2;
+    w4  = p0 - v4 * b11_2;
+    w5  = p5 - v5 * b11_3;
+    w6  = p3 - v6 * b11_3;
+    w7  = p7 - v7 * b11_3;
+    w8  = p8 - v8 * b11_3;
+    w9  = p1 - v9 * b11_3;
+    w10 = p18 - v10 * b11_2;
+    w11 = p10 - v11 * b11_2;
+    w12 = p16 - v12 * b11_2;
+    w13 = p12 + v13 * b11_2;
+    w14 = p14 + v14 * b11_2;
+    w15 = p13 - v15 * b11_3;
+    w16 = p17 - v16 * b11_3;
+    w17 = p19 - v17 * b11_3;
+    w18 = p15 - v18 * b11_3;
+    w19 = p11 - v19 * b11_3;
+
+    real_type_t<T> z0, z1, z2, z3, z4, z5, z6, z7, z8, z9;
+    z0 = (*R0).x - w5 * b11_1;
+    z1 = (*R0).x - w6 * b11_1;
+    z2 = (*R0).x - w7 * b11_1;
+    z3 = (*R0).x - w8 * b11_1;
+    z4 = (*R0).x - w9 * b11_1;
+    z5 = (*R0).y - w15 * b11_1;
+    z6 = (*R0).y - w16 * b11_1;
+    z7 = (*R0).y - w17 * b11_1;
+    z8 = (*R0).y - w18 * b11_1;
+    z9 = (*R0).y - w19 * b11_1;
+
+    (*R0).x  = (*R0).x + p1 + p3 + p5 + p7 + p8;
+    (*R0).y  = (*R0).y + p11 + p13 + p15 + p17 + p19;
+    (*R1).x  = z1 + w14 * b11_0;
+    (*R1).y  = z7 + w1 * b11_0;
+    (*R2).x  = z2 - w12 * b11_0;
+    (*R2).y  = z8 - w2 * b11_0;
+    (*R3).x  = z0 + w11 * b11_0;
+    (*R3).y  = z5 + w4 * b11_0;
+    (*R4).x  = z3 - w13 * b11_0;
+    (*R4).y  = z6 - w3 * b11_0;
+    (*R5).x  = z4 + w10 * b11_0;
+    (*R5).y  = z9 + w0 * b11_0;
+    (*R6).x  = z4 - w10 * b11_0;
+    (*R6).y  = z9 - w0 * b11_0;
+    (*R7).x  = z3 + w13 * b11_0;
+    (*R7).y  = z6 + w3 * b11_0;
+    (*R8).x  = z0 - w11 * b11_0;
+    (*R8).y  = z5 - w4 * b11_0;
+    (*R9).x  = z2 + w12 * b11_0;
+    (*R9).y  = z8 + w2 * b11_0;
+    (*R10).x = z1 - w14 * b11_0;
+    (*R10).y = z7 - w1 * b11_0;
+}
+
+template <typename T>
+__device__ void FwdRad13B1(T* R0,
+                           T* R1,
+                           T* R2,
+                           T* R3,
+                           T* R4,
+                           T* R5,
+                           T* R6,
+                           T* R7,
+                           T* R8,
+                           T* R9,
+                           T* R10,
+                           T* R11,
+                           T* R12)
+{
+    const real_type_t<T> dir = -1;
+
+    real_type_t<T> p0, p1, p2, p3, p4, p5, p6, p7, p8, p9;
+    p0 = (*R7).x - (*R2).x;
+    p1 = (*R7).x + (*R2).x;
+    p2 = (*R8).x - (*R5).x;
+    p3 = (*R8).x + (*R5).x;
+    p4 = (*R9).x - (*R3).x;
+    p5 = (*R3).x + (*R9).x;
+    p6 = (*R10).x + (*R4).x;
+    p7 = (*R10).x - (*R4).x;
+    p8 = (*R11).x + (*R6).x;
+    p9 = (*R11).x - (*R6).x;
+
+    real_type_t<T> p10, p11, p12, p13, p14, p15, p16, p17, p18, p19;
+    p10 = (*R12).x + p6;
+    p11 = (*R1).x + p5;
+    p12 = p8 - p1;
+    p13 = p8 + p1;
+    p14 = p9 + p0;
+    p15 = p9 - p0;
+    p16 = p7 - p4;
+    p17 = p4 + p7;
+    p18 = p11 + p10;
+    p19 = p11 - p10;
+
+    real_type_t<T> s0, s1, s2, s3, s4, s5, s6, s7, s8, s9, s10, s11;
+    s0                = p3 + p13;
+    s1                = p2 + p14;
+    s2                = p16 - p15;
+    s3                = p16 + p15;
+    s4                = -(*R12).x + p6 * b13_17;
+    s5                = (*R1).x - p5 * b13_17;
+    s6                = s5 - s4;
+    s7                = s5 + s4;
+    s8                = p18 + s0;
+    s9                = p18 - s0;
+    real_type_t<T> c2 = p3 - p13 * b13_17;
+    s10               = s6 - c2;
+    s11               = s6 + c2;
+
+    real_type_t<T> r0, r1, r2, r3, r4, r5, r6, r7, r8, r9, r10, r11;
+    r0  = (*R7).y + (*R2).y;
+    r1  = (*R7).y - (*R2).y;
+    r2  = (*R8).y + (*R5).y;
+    r3  = (*R8).y - (*R5).y;
+    r4  = (*R9).y - (*R3).y;
+    r5  = (*R3).y + (*R9).y;
+    r6  = (*R10).y + (*R4).y;
+    r7  = (*R10).y - (*R4).y;
+    r8  = (*R11).y - (*R6).y;
+    r9  = (*R11).y + (*R6).y;
+    r10 = (*R12).y + r6;
+    r11 = (*R1).y + r5;
+
+    real_type_t<T> m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10;
+    real_type_t<T> m11, m12, m13, m14, m15, m16, m17, m18, m19, m20;
+    m0  = r4 + r7;
+    m1  = r7 - r4;
+    m2  = r8 - r1;
+    m3  = r8 + r1;
+    m4  = r9 + r0;
+    m5  = r9 - r0;
+    m6  = r11 + r10;
+    m7  = r11 - r10;
+    m8  = m1 - m2;
+    m9  = m1 + m2;
+    m10 = r3 + m3;
+    m11 = r2 + m4;
+    m12 = m6 - m11;
+    m13 = m6 + m11;
+
+    m14 = (*R1).y - r5 * b13_17;
+    m15 = -(*R12).y + r6 * b13_17;
+    m16 = r2 - m4 * b13_17;
+
+    m17 = m14 + m15;
+    m18 = m14 - m15;
+    m19 = m18 + m16;
+    m20 = m18 - m16;
+
+    real_type_t<T> c0, c1, c3, c4, c5, c6, c7, c8, c9;
+    real_type_t<T> c10, c11, c12, c13, c14, c15, c16, c17, c18, c19;
+    real_type_t<T> c20, c21, c22, c23, c24;
+    c0  = s7 - p12 * b13_3;
+    c1  = s7 + p12 * b13_3;
+    c3  = p2 - p14 * b13_17;
+    c4  = s1 - p19 * b13_18;
+    c5  = p19 + s1 * b13_18;
+    c6  = s10 - s2 * b13_15;
+    c7  = s11 - s3 * b13_22;
+    c8  = (*R0).x - s8 * b13_23;
+    c9  = s2 + s10 * b13_7;
+    c10 = s3 + s11 * b13_19;
+    c11 = r3 - m3 * b13_17;
+    c12 = m17 - m5 * b13_3;
+    c13 = m17 + m5 * b13_3;
+    c14 = m10 - m7 * b13_18;
+    c15 = m20 - m8 * b13_15;
+    c16 = m19 - m9 * b13_22;
+    c17 = m7 + m10 * b13_18;
+    c18 = (*R0).y- m13 * b13_23;
+    c19 = m9 + m19 * b13_19;
+    c20 = m8 + m20 * b13_7;
+    c21 = c3 + p17 * b13_3;
+    c22 = c3 - p17 * b13_3;
+    c23 = c11 + m0 * b13_3;
+    c24 = c11 - m0 * b13_3;
+
+    real_type_t<T> d0, d1, d2, d3, d4, d5, d6, d7, d8, d9;
+    real_type_t<T> d10, d11, d12, d13, d14, d15, d16, d17, d18, d19;
+    d0  = c22 + c0 * b13_8;
+    d1  = c0 - c22 * b13_8;
+    d2  = c21 + c1 * b13_24;
+    d3  = c1 - c21 * b13_24;
+    d4  = s9 - c6 * b13_4;
+    d5  = c6 + s9 * b13_10;
+    d6  = c7 + c9 * b13_6;
+    d7  = c7 - c9 * b13_6;
+    d8  = c8 - c10 * b13_21;
+    d9  = c8 + c10 * b13_16;
+    d10 = c24 + c12 * b13_8;
+    d11 = c12 - c24 * b13_8;
+    d12 = c23 + c13 * b13_24;
+    d13 = c13 - c23 * b13_24;
+    d14 = m12 - c15 * b13_4;
+    d15 = c15 + m12 * b13_10;
+    d16 = c18 + c19 * b13_16;
+    d17 = c18 - c19 * b13_21;
+    d18 = c16 - c20 * b13_6;
+    d19 = c16 + c20 * b13_6;
+
+    real_type_t<T> e0, e1, e2, e3, e4, e5, e6, e7, e8, e9;
+    real_type_t<T> e10, e11, e12, e13, e14, e15;
+    e0  = d2 + d0 * b13_5;
+    e1  = d2 - d0 * b13_5;
+    e2  = d3 - d1 * b13_5;
+    e3  = d3 + d1 * b13_5;
+    e4  = d8 - d4 * b13_20;
+    e5  = d8 + d4 * b13_20;
+    e6  = d9 + d5 * b13_14;
+    e7  = d9 - d5 * b13_14;
+    e8  = d12 + d10 * b13_5;
+    e9  = d12 - d10 * b13_5;
+    e10 = d13 - d11 * b13_5;
+    e11 = d13 + d11 * b13_5;
+    e12 = d16 + d15 * b13_14;
+    e13 = d16 - d15 * b13_14;
+    e14 = d17 + d14 * b13_20;
+    e15 = d17 - d14 * b13_20;
+
+    real_type_t<T> f0, f1, f2, f3, f4, f5, f6, f7, f8, f9;
+    real_type_t<T> f10, f11, f12, f13, f14, f15, f16, f17, f18, f19;
+    real_type_t<T> f20, f21, f22, f23;
+    f0  = c17 - e10 * b13_12;
+    f1  = e10 + c17 * b13_1;
+    f2  = e9 + c14 * b13_1;
+    f3  = c14 - e9 * b13_12;
+    f4  = e11 + dir * d7 * b13_0;
+    f5  = e11 - dir * d7 * b13_0;
+    f6  = e5 + dir * f3 * b13_11;
+    f7  = e5 - dir * f3 * b13_11;
+    f8  = e4 + dir * e8 * b13_13;
+    f9  = e4 - dir * e8 * b13_13;
+    f10 = f0 - dir * d6 * b13_2;
+    f11 = f0 + dir * d6 * b13_2;
+    f12 = e1 + c4 * b13_1;
+    f13 = c4 - e1 * b13_12;
+    f14 = c5 - e2 * b13_12;
+    f15 = e2 + c5 * b13_1;
+    f16 = f14 + dir * d19 * b13_2;
+    f17 = f14 - dir * d19 * b13_2;
+    f18 = e15 - dir * e0 * b13_13;
+    f19 = e15 + dir * e0 * b13_13;
+    f20 = e14 - dir * f13 * b13_11;
+    f21 = e14 + dir * f13 * b13_11;
+    f22 = e3 - dir * d18 * b13_0;
+    f23 = e3 + dir * d18 * b13_0;
+
+    (*R0).x  = (*R0).x + s8;
+    (*R0).y  = (*R0).y + m13;
+    (*R1).x  = e6 + f2 * dir * b13_9;
+    (*R1).y  = e12 - f12 * dir * b13_9;
+    (*R2).x  = f9 - f10 * dir * b13_11;
+    (*R2).y  = f19 + f16 * dir * b13_11;
+    (*R3).x  = f6 - f5 * dir * b13_13;
+    (*R3).y  = f20 + f23 * dir * b13_13;
+    (*R4).x  = f7 - f4 * dir * b13_13;
+    (*R4).y  = f21 + f22 * dir * b13_13;
+    (*R5).x  = e7 - f1 * dir * b13_9;
+    (*R5).y  = e13 + f15 * dir * b13_9;
+    (*R6).x  = f8 - f11 * dir * b13_11;
+    (*R6).y  = f18 + f17 * dir * b13_11;
+    (*R7).x  = f9 + f10 * dir * b13_11;
+    (*R7).y  = f19 - f16 * dir * b13_11;
+    (*R8).x  = e7 + f1 * dir * b13_9;
+    (*R8).y  = e13 - f15 * dir * b13_9;
+    (*R9).x  = f6 + f5 * dir * b13_13;
+    (*R9).y  = f20 - f23 * dir * b13_13;
+    (*R10).x = f7 + f4 * dir * b13_13;
+    (*R10).y = f21 - f22 * dir * b13_13;
+    (*R11).x = f8 + f11 * dir * b13_11;
+    (*R11).y = f18 - f17 * dir * b13_11;
+    (*R12).x = e6 - f2 * dir * b13_9;
+    (*R12).y = e12 + f12 * dir * b13_9;
+}
+
+template <typename T>
+__device__ void InvRad13B1(T* R0,
+                           T* R1,
+                           T* R2,
+                           T* R3,
+                           T* R4,
+                           T* R5,
+                           T* R6,
+                           T* R7,
+                           T* R8,
+                           T* R9,
+                           T* R10,
+                           T* R11,
+                           T* R12)
+{
+    const real_type_t<T> dir = 1;
+
+    real_type_t<T> p0, p1, p2, p3, p4, p5, p6, p7, p8, p9;
+    p0 = (*R7).x - (*R2).x;
+    p1 = (*R7).x + (*R2).x;
+    p2 = (*R8).x - (*R5).x;
+    p3 = (*R8).x + (*R5).x;
+    p4 = (*R9).x - (*R3).x;
+    p5 = (*R3).x + (*R9).x;
+    p6 = (*R10).x + (*R4).x;
+    p7 = (*R10).x - (*R4).x;
+    p8 = (*R11).x + (*R6).x;
+    p9 = (*R11).x - (*R6).x;
+
+    real_type_t<T> p10, p11, p12, p13, p14, p15, p16, p17, p18, p19;
+    p10 = (*R12).x + p6;
+    p11 = (*R1).x + p5;
+    p12 = p8 - p1;
+    p13 = p8 + p1;
+    p14 = p9 + p0;
+    p15 = p9 - p0;
+    p16 = p7 - p4;
+    p17 = p4 + p7;
+    p18 = p11 + p10;
+    p19 = p11 - p10;
+
+    real_type_t<T> s0, s1, s2, s3, s4, s5, s6, s7, s8, s9, s10, s11;
+    s0                = p3 + p13;
+    s1                = p2 + p14;
+    s2                = p16 - p15;
+    s3                = p16 + p15;
+    s4                = -(*R12).x + p6 * b13_17;
+    s5                = (*R1).x - p5 * b13_17;
+    s6                = s5 - s4;
+    s7                = s5 + s4;
+    s8                = p18 + s0;
+    s9                = p18 - s0;
+    real_type_t<T> c2 = p3 - p13 * b13_17;
+    s10               = s6 - c2;
+    s11               = s6 + c2;
+
+    real_type_t<T> r0, r1, r2, r3, r4, r5, r6, r7, r8, r9, r10, r11;
+    r0  = (*R7).y + (*R2).y;
+    r1  = (*R7).y - (*R2).y;
+    r2  = (*R8).y + (*R5).y;
+    r3  = (*R8).y - (*R5).y;
+    r4  = (*R9).y - (*R3).y;
+    r5  = (*R3).y + (*R9).y;
+    r6  = (*R10).y + (*R4).y;
+    r7  = (*R10).y - (*R4).y;
+    r8  = (*R11).y - (*R6).y;
+    r9  = (*R11).y + (*R6).y;
+    r10 = (*R12).y + r6;
+    r11 = (*R1).y + r5;
+
+    real_type_t<T> m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10;
+    real_type_t<T> m11, m12, m13, m14, m15, m16, m17, m18, m19, m20;
+    m0  = r4 + r7;
+    m1  = r7 - r4;
+    m2  = r8 - r1;
+    m3  = r8 + r1;
+    m4  = r9 + r0;
+    m5  = r9 - r0;
+    m6  = r11 + r10;
+    m7  = r11 - r10;
+    m8  = m1 - m2;
+    m9  = m1 + m2;
+    m10 = r3 + m3;
+    m11 = r2 + m4;
+    m12 = m6 - m11;
+    m13 = m6 + m11;
+
+    m14 = (*R1).y - r5 * b13_17;
+    m15 = -(*R12).y + r6 * b13_17;
+    m16 = r2 - m4 * b13_17;
+
+    m17 = m14 + m15;
+    m18 = m14 - m15;
+    m19 = m18 + m16;
+    m20 = m18 - m16;
+
+    real_type_t<T> c0, c1, c3, c4, c5, c6, c7, c8, c9;
+    real_type_t<T> c10, c11, c12, c13, c14, c15, c16, c17, c18, c19;
+    real_type_t<T> c20, c21, c22, c23, c24;
+    c0  = s7 - p12 * b13_3;
+    c1  = s7 + p12 * b13_3;
+    c3  = p2 - p14 * b13_17;
+    c4  = s1 - p19 * b13_18;
+    c5  = p19 + s1 * b13_18;
+    c6  = s10 - s2 * b13_15;
+    c7  = s11 - s3 * b13_22;
+    c8  = (*R0).x - s8 * b13_23;
+    c9  = s2 + s10 * b13_7;
+    c10 = s3 + s11 * b13_19;
+    c11 = r3 - m3 * b13_17;
+    c12 = m17 - m5 * b13_3;
+    c13 = m17 + m5 * b13_3;
+    c14 = m10 - m7 * b13_18;
+    c15 = m20 - m8 * b13_15;
+    c16 = m19 - m9 * b13_22;
+    c17 = m7 + m10 * b13_18;
+    c18 = (*R0).y- m13 * b13_23;
+    c19 = m9 + m19 * b13_19;
+    c20 = m8 + m20 * b13_7;
+    c21 = c3 + p17 * b13_3;
+    c22 = c3 - p17 * b13_3;
+    c23 = c11 + m0 * b13_3;
+    c24 = c11 - m0 * b13_3;
+
+    real_type_t<T> d0, d1, d2, d3, d4, d5, d6, d7, d8, d9;
+    real_type_t<T> d10, d11, d12, d13, d14, d15, d16, d17, d18, d19;
+    d0  = c22 + c0 * b13_8;
+    d1  = c0 - c22 * b13_8;
+    d2  = c21 + c1 * b13_24;
+    d3  = c1 - c21 * b13_24;
+    d4  = s9 - c6 * b13_4;
+    d5  = c6 + s9 * b13_10;
+    d6  = c7 + c9 * b13_6;
+    d7  = c7 - c9 * b13_6;
+    d8  = c8 - c10 * b13_21;
+    d9  = c8 + c10 * b13_16;
+    d10 = c24 + c12 * b13_8;
+    d11 = c12 - c24 * b13_8;
+    d12 = c23 + c13 * b13_24;
+    d13 = c13 - c23 * b13_24;
+    d14 = m12 - c15 * b13_4;
+    d15 = c15 + m12 * b13_10;
+    d16 = c18 + c19 * b13_16;
+    d17 = c18 - c19 * b13_21;
+    d18 = c16 - c20 * b13_6;
+    d19 = c16 + c20 * b13_6;
+
+    real_type_t<T> e0, e1, e2, e3, e4, e5, e6, e7, e8, e9;
+    real_type_t<T> e10, e11, e12, e13, e14, e15;
+    e0  = d2 + d0 * b13_5;
+    e1  = d2 - d0 * b13_5;
+    e2  = d3 - d1 * b13_5;
+    e3  = d3 + d1 * b13_5;
+    e4  = d8 - d4 * b13_20;
+    e5  = d8 + d4 * b13_20;
+    e6  = d9 + d5 * b13_14;
+    e7  = d9 - d5 * b13_14;
+    e8  = d12 + d10 * b13_5;
+    e9  = d12 - d10 * b13_5;
+    e10 = d13 - d11 * b13_5;
+    e11 = d13 + d11 * b13_5;
+    e12 = d16 + d15 * b13_14;
+    e13 = d16 - d15 * b13_14;
+    e14 = d17 + d14 * b13_20;
+    e15 = d17 - d14 * b13_20;
+
+    real_type_t<T> f0, f1, f2, f3, f4, f5, f6, f7, f8, f9;
+    real_type_t<T> f10, f11, f12, f13, f14, f15, f16, f17, f18, f19;
+    real_type_t<T> f20, f21, f22, f23;
+    f0  = c17 - e10 * b13_12;
+    f1  = e10 + c17 * b13_1;
+    f2  = e9 + c14 * b13_1;
+    f3  = c14 - e9 * b13_12;
+    f4  = e11 + dir * d7 * b13_0;
+    f5  = e11 - dir * d7 * b13_0;
+    f6  = e5 + dir * f3 * b13_11;
+    f7  = e5 - dir * f3 * b13_11;
+    f8  = e4 + dir * e8 * b13_13;
+    f9  = e4 - dir * e8 * b13_13;
+    f10 = f0 - dir * d6 * b13_2;
+    f11 = f0 + dir * d6 * b13_2;
+    f12 = e1 + c4 * b13_1;
+    f13 = c4 - e1 * b13_12;
+    f14 = c5 - e2 * b13_12;
+    f15 = e2 + c5 * b13_1;
+    f16 = f14 + dir * d19 * b13_2;
+    f17 = f14 - dir * d19 * b13_2;
+    f18 = e15 - dir * e0 * b13_13;
+    f19 = e15 + dir * e0 * b13_13;
+    f20 = e14 - dir * f13 * b13_11;
+    f21 = e14 + dir * f13 * b13_11;
+    f22 = e3 - dir * d18 * b13_0;
+    f23 = e3 + dir * d18 * b13_0;
+
+    (*R0).x  = (*R0).x + s8;
+    (*R0).y  = (*R0).y + m13;
+    (*R1).x  = e6 + f2 * dir * b13_9;
+    (*R1).y  = e12 - f12 * dir * b13_9;
+    (*R2).x  = f9 - f10 * dir * b13_11;
+    (*R2).y  = f19 + f16 * dir * b13_11;
+    (*R3).x  = f6 - f5 * dir * b13_13;
+    (*R3).y  = f20 + f23 * dir * b13_13;
+    (*R4).x  = f7 - f4 * dir * b13_13;
+    (*R4).y  = f21 + f22 * dir * b13_13;
+    (*R5).x  = e7 - f1 * dir * b13_9;
+    (*R5).y  = e13 + f15 * dir * b13_9;
+    (*R6).x  = f8 - f11 * dir * b13_11;
+    (*R6).y  = f18 + f17 * dir * b13_11;
+    (*R7).x  = f9 + f10 * dir * b13_11;
+    (*R7).y  = f19 - f16 * dir * b13_11;
+    (*R8).x  = e7 + f1 * dir * b13_9;
+    (*R8).y  = e13 - f15 * dir * b13_9;
+    (*R9).x  = f6 + f5 * dir * b13_13;
+    (*R9).y  = f20 - f23 * dir * b13_13;
+    (*R10).x = f7 + f4 * dir * b13_13;
+    (*R10).y = f21 - f22 * dir * b13_13;
+    (*R11).x = f8 + f11 * dir * b13_11;
+    (*R11).y = f18 - f17 * dir * b13_11;
+    (*R12).x = e6 - f2 * dir * b13_9;
+    (*R12).y = e12 + f12 * dir * b13_9;
+}
+
 template <typename T>
 __device__ void FwdRad16B1(T* R0,
                            T* R8,
@@ -26,6 +26,10 @@
 #include "common.h"
 #include "rocfft_hip.h"
 
+// chirp_device writes the length M chirp of a length N transform, wrapped
+// around so that the convolution with the padded data is circular, from
+// the large twiddles of length 2N.  chirp_create transforms it into the
+// second half of the chirp table of the plan.
 template <typename T>
 __global__ void chirp_device(
     const size_t N, const size_t M, T* output, T* twiddles_large, const int twl, const int dir)
@@ -47,42 +51,41 @@ __global__ void chirp_device(
 
     if(tx == 0)
     {
-        output[tx]     = val;
-        output[tx + M] = val;
+        output[tx] = val;
     }
     else if(tx < N)
     {
         output[tx]     = val;
-        output[tx + M] = val;
-
-        output[M - tx]     = val;
-        output[M - tx + M] = val;
+        output[M - tx] = val;
     }
     else if(tx <= (M - N))
     {
-        output[tx]     = lib_make_vector2<T>(0, 0);
-        output[tx + M] = lib_make_vector2<T>(0, 0);
+        output[tx] = lib_make_vector2<T>(0, 0);
     }
 }
 
 // mul_device takes care of fft_mul, pad_mul, and res_mul, which
-// are 3 steps in Bluestein algorithm. And In the below, we have
-// 4 similar overloaded functions to support interleaved and
-// planar format. There might be a better way to do it.
+// are 3 steps in Bluestein algorithm. chirp holds the length M chirp
+// followed by its FFT, computed when the plan is created. And In the
+// below, we have 4 similar overloaded functions to support interleaved
+// and planar format. There might be a better way to do it. res_mul ends
+// the transform, so it also multiplies by the scale of the plan.
 
 template <typename T>
-__global__ void mul_device(const size_t  numof,
-                           const size_t  totalWI,
-                           const size_t  N,
-                           const size_t  M,
-                           const T*      input,
-                           T*            output,
-                           const size_t  dim,
-                           const size_t* lengths,
-                           const size_t* stride_in,
-                           const size_t* stride_out,
-                           const int     dir,
-                           const int     scheme)
+__global__ void mul_device(const size_t         numof,
+                           const size_t         totalWI,
+                           const size_t         N,
+                           const size_t         M,
+                           const T*             chirp,
+                           const T*             input,
+                           T*                   output,
+                           const size_t         dim,
+                           const size_t*        lengths,
+                           const size_t*        stride_in,
+                           const size_t*        stride_out,
+                           const int            dir,
+                           const int            scheme,
+                           const real_type_t<T> scale)
 {
     size_t tx = hipThreadIdx_x + hipBlockIdx_x * hipBlockDim_x;
 
@@ -112,45 +115,42 @@ __global__ void mul_device(const size_t  numof,
     tx          = tx % numof;
     size_t iIdx = tx * stride_in[0];
     size_t oIdx = tx * stride_out[0];
+
     if(scheme == 0)
     {
         output += oOffset;
 
-        T out          = output[oIdx];
-        output[oIdx].x = input[iIdx].x * out.x - input[iIdx].y * out.y;
-        output[oIdx].y = input[iIdx].x * out.y + input[iIdx].y * out.x;
+        const T out    = output[oIdx];
+        const T c      = chirp[M + tx];
+        output[oIdx].x = out.x * c.x - out.y * c.y;
+        output[oIdx].y = out.x * c.y + out.y * c.x;
     }
     else if(scheme == 1)
     {
-        T* chirp = output;
-
         input += iOffset;
-
-        output += M;
         output += oOffset;
 
         if(tx < N)
         {
-            output[oIdx].x = input[iIdx].x * chirp[tx].x + input[iIdx].y * chirp[tx].y;
-            output[oIdx].y = -input[iIdx].x * chirp[tx].y + input[iIdx].y * chirp[tx].x;
+            const T in     = input[iIdx];
+            output[oIdx].x = in.x * chirp[tx].x + in.y * chirp[tx].y;
+            output[oIdx].y = -in.x * chirp[tx].y + in.y * chirp[tx].x;
         }
         else
         {
-            output[oIdx] = lib_make_vector2<T>(0, 0);
+            output[oIdx].x = 0;
+            output[oIdx].y = 0;
         }
     }
     else if(scheme == 2)
     {
-        const T* chirp = input;
-
-        input += 2 * M;
         input += iOffset;
-
         output += oOffset;
 
-        real_type_t<T> MI = 1.0 / (real_type_t<T>)M;
-        output[oIdx].x    = MI * (input[iIdx].x * chirp[tx].x + input[iIdx].y * chirp[tx].y);
-        output[oIdx].y    = MI * (-input[iIdx].x * chirp[tx].y + input[iIdx].y * chirp[tx].x);
+        const T        in = input[iIdx];
+        real_type_t<T> MI = scale / (real_type_t<T>)M;
+        output[oIdx].x    = MI * (in.x * chirp[tx].x + in.y * chirp[tx].y);
+        output[oIdx].y    = MI * (-in.x * chirp[tx].y + in.y * chirp[tx].x);
     }
 }
 
@@ -159,6 +159,7 @@ __global__ void mul_device(const size_t          numof,
                            const size_t          totalWI,
                            const size_t          N,
                            const size_t          M,
+                           const T*              chirp,
                            const real_type_t<T>* inputRe,
                            const real_type_t<T>* inputIm,
                            T*                    output,
@@ -167,7 +168,8 @@ __global__ void mul_device(const size_t          numof,
                            const size_t*         stride_in,
                            const size_t*         stride_out,
                            const int             dir,
-                           const int             scheme)
+                           const int             scheme,
+                           const real_type_t<T>  scale)
 {
     size_t tx = hipThreadIdx_x + hipBlockIdx_x * hipBlockDim_x;
 
@@ -202,63 +204,58 @@ __global__ void mul_device(const size_t          numof,
     {
         output += oOffset;
 
-        T out          = output[oIdx];
-        output[oIdx].x = inputRe[iIdx] * out.x - inputIm[iIdx] * out.y;
-        output[oIdx].y = inputRe[iIdx] * out.y + inputIm[iIdx] * out.x;
+        const T out    = output[oIdx];
+        const T c      = chirp[M + tx];
+        output[oIdx].x = out.x * c.x - out.y * c.y;
+        output[oIdx].y = out.x * c.y + out.y * c.x;
     }
     else if(scheme == 1)
     {
-        T* chirp = output;
-
         inputRe += iOffset;
         inputIm += iOffset;
-
-        output += M;
         output += oOffset;
 
         if(tx < N)
         {
-            output[oIdx].x = inputRe[iIdx] * chirp[tx].x + inputIm[iIdx] * chirp[tx].y;
-            output[oIdx].y = -inputRe[iIdx] * chirp[tx].y + inputIm[iIdx] * chirp[tx].x;
+            const T in     = lib_make_vector2<T>(inputRe[iIdx], inputIm[iIdx]);
+            output[oIdx].x = in.x * chirp[tx].x + in.y * chirp[tx].y;
+            output[oIdx].y = -in.x * chirp[tx].y + in.y * chirp[tx].x;
         }
         else
         {
-            output[oIdx] = lib_make_vector2<T>(0, 0);
+            output[oIdx].x = 0;
+            output[oIdx].y = 0;
         }
     }
     else if(scheme == 2)
     {
-        const real_type_t<T>* chirpRe = inputRe;
-        const real_type_t<T>* chirpIm = inputIm;
-
-        inputRe += 2 * M;
         inputRe += iOffset;
-
-        inputIm += 2 * M;
         inputIm += iOffset;
-
         output += oOffset;
 
-        real_type_t<T> MI = 1.0 / (real_type_t<T>)M;
-        output[oIdx].x    = MI * (inputRe[iIdx] * chirpRe[tx] + inputIm[iIdx] * chirpIm[tx]);
-        output[oIdx].y    = MI * (-inputRe[iIdx] * chirpIm[tx] + inputIm[iIdx] * chirpRe[tx]);
+        const T        in = lib_make_vector2<T>(inputRe[iIdx], inputIm[iIdx]);
+        real_type_t<T> MI = scale / (real_type_t<T>)M;
+        output[oIdx].x    = MI * (in.x * chirp[tx].x + in.y * chirp[tx].y);
+        output[oIdx].y    = MI * (-in.x * chirp[tx].y + in.y * chirp[tx].x);
     }
 }
 
 template <typename T>
-__global__ void mul_device(const size_t    numof,
-                           const size_t    totalWI,
-                           const size_t    N,
-                           const size_t    M,
-                           const T*        input,
-                           real_type_t<T>* outputRe,
-                           real_type_t<T>* outputIm,
-                           const size_t    dim,
-                           const size_t*   lengths,
-                           const size_t*   stride_in,
-                           const size_t*   stride_out,
-                           const int       dir,
-                           const int       scheme)
+__global__ void mul_device(const size_t         numof,
+                           const size_t         totalWI,
+                           const size_t         N,
+                           const size_t         M,
+                           const T*             chirp,
+                           const T*             input,
+                           real_type_t<T>*      outputRe,
+                           real_type_t<T>*      outputIm,
+                           const size_t         dim,
+                           const size_t*        lengths,
+                           const size_t*        stride_in,
+                           const size_t*        stride_out,
+                           const int            dir,
+                           const int            scheme,
+                           const real_type_t<T> scale)
 {
     size_t tx = hipThreadIdx_x + hipBlockIdx_x * hipBlockDim_x;
 
@@ -294,27 +291,22 @@ __global__ void mul_device(const size_t    numof,
         outputRe += oOffset;
         outputIm += oOffset;
 
-        T out          = lib_make_vector2<T>(outputRe[oIdx], outputIm[oIdx]);
-        outputRe[oIdx] = input[iIdx].x * out.x - input[iIdx].y * out.y;
-        outputIm[oIdx] = input[iIdx].x * out.y + input[iIdx].y * out.x;
+        const T out    = lib_make_vector2<T>(outputRe[oIdx], outputIm[oIdx]);
+        const T c      = chirp[M + tx];
+        outputRe[oIdx] = out.x * c.x - out.y * c.y;
+        outputIm[oIdx] = out.x * c.y + out.y * c.x;
     }
     else if(scheme == 1)
     {
-        real_type_t<T>* chirpRe = outputRe;
-        real_type_t<T>* chirpIm = outputIm;
-
         input += iOffset;
-
-        outputRe += M;
         outputRe += oOffset;
-
-        outputIm += M;
         outputIm += oOffset;
 
         if(tx < N)
         {
-            outputRe[oIdx] = input[iIdx].x * chirpRe[tx] + input[iIdx].y * chirpIm[tx];
-            outputIm[oIdx] = -input[iIdx].x * chirpIm[tx] + input[iIdx].y * chirpRe[tx];
+            const T in     = input[iIdx];
+            outputRe[oIdx] = in.x * chirp[tx].x + in.y * chirp[tx].y;
+            outputIm[oIdx] = -in.x * chirp[tx].y + in.y * chirp[tx].x;
         }
         else
         {
@@ -324,17 +316,14 @@ __global__ void mul_device(const size_t    numof,
     }
     else if(scheme == 2)
     {
-        const T* chirp = input;
-
-        input += 2 * M;
         input += iOffset;
-
         outputRe += oOffset;
         outputIm += oOffset;
 
-        real_type_t<T> MI = 1.0 / (real_type_t<T>)M;
-        outputRe[oIdx]    = MI * (input[iIdx].x * chirp[tx].x + input[iIdx].y * chirp[tx].y);
-        outputIm[oIdx]    = MI * (-input[iIdx].x * chirp[tx].y + input[iIdx].y * chirp[tx].x);
+        const T        in = input[iIdx];
+        real_type_t<T> MI = scale / (real_type_t<T>)M;
+        outputRe[oIdx]    = MI * (in.x * chirp[tx].x + in.y * chirp[tx].y);
+        outputIm[oIdx]    = MI * (-in.x * chirp[tx].y + in.y * chirp[tx].x);
     }
 }
 
@@ -343,6 +332,7 @@ __global__ void mul_device(const size_t          numof,
                            const size_t          totalWI,
                            const size_t          N,
                            const size_t          M,
+                           const T*              chirp,
                            const real_type_t<T>* inputRe,
                            const real_type_t<T>* inputIm,
                            real_type_t<T>*       outputRe,
@@ -352,7 +342,8 @@ __global__ void mul_device(const size_t          numof,
                            const size_t*         stride_in,
                            const size_t*         stride_out,
                            const int             dir,
-                           const int             scheme)
+                           const int             scheme,
+                           const real_type_t<T>  scale)
 {
     size_t tx = hipThreadIdx_x + hipBlockIdx_x * hipBlockDim_x;
 
@@ -388,52 +379,41 @@ __global__ void mul_device(const size_t          numof,
         outputRe += oOffset;
         outputIm += oOffset;
 
-        T out          = lib_make_vector2<T>(outputRe[oIdx], outputIm[oIdx]);
-        outputRe[oIdx] = inputRe[iIdx] * out.x - inputIm[iIdx] * out.y;
-        outputIm[oIdx] = inputRe[iIdx] * out.y + inputIm[iIdx] * out.x;
+        const T out    = lib_make_vector2<T>(outputRe[oIdx], outputIm[oIdx]);
+        const T c      = chirp[M + tx];
+        outputRe[oIdx] = out.x * c.x - out.y * c.y;
+        outputIm[oIdx] = out.x * c.y + out.y * c.x;
     }
     else if(scheme == 1)
     {
-        real_type_t<T>* chirpRe = outputRe;
-        real_type_t<T>* chirpIm = outputIm;
-
         inputRe += iOffset;
         inputIm += iOffset;
-
-        outputRe += M;
         outputRe += oOffset;
-
-        outputIm += M;
         outputIm += oOffset;
 
         if(tx < N)
         {
-            outputRe[oIdx] = inputRe[iIdx] * chirpRe[tx] + inputIm[iIdx] * chirpIm[tx];
-            outputIm[oIdx] = -inputRe[iIdx] * chirpIm[tx] + inputIm[iIdx] * chirpRe[tx];
+            const T in     = lib_make_vector2<T>(inputRe[iIdx], inputIm[iIdx]);
+            outputRe[oIdx] = in.x * chirp[tx].x + in.y * chirp[tx].y;
+            outputIm[oIdx] = -in.x * chirp[tx].y + in.y * chirp[tx].x;
         }
         else
         {
-            outputRe[tx] = 0;
-            outputIm[tx] = 0;
+            outputRe[oIdx] = 0;
+            outputIm[oIdx] = 0;
         }
     }
     else if(scheme == 2)
     {
-        const real_type_t<T>* chirpRe = inputRe;
-        const real_type_t<T>* chirpIm = inputIm;
-
-        inputRe += 2 * M;
         inputRe += iOffset;
-
-        inputIm += 2 * M;
         inputIm += iOffset;
-
         outputRe += oOffset;
         outputIm += oOffset;
 
-        real_type_t<T> MI = 1.0 / (real_type_t<T>)M;
-        outputRe[oIdx]    = MI * (inputRe[iIdx] * chirpRe[tx] + inputIm[iIdx] * chirpIm[tx]);
-        outputIm[oIdx]    = MI * (-inputRe[iIdx] * chirpIm[tx] + inputIm[iIdx] * chirpRe[tx]);
+        const T        in = lib_make_vector2<T>(inputRe[iIdx], inputIm[iIdx]);
+        real_type_t<T> MI = scale / (real_type_t<T>)M;
+        outputRe[oIdx]    = MI * (in.x * chirp[tx].x + in.y * chirp[tx].y);
+        outputIm[oIdx]    = MI * (-in.x * chirp[tx].y + in.y * chirp[tx].x);
     }
 }
 
@@ -0,0 +1,172 @@
+/******************************************************************************
+* Copyright (c) 2016 - present Advanced Micro Devices, Inc. All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*******************************************************************************/
+
+#ifndef RADER_H
+#define RADER_H
+
+#include "common.h"
+#include "rocfft_hip.h"
+
+__device__ inline size_t rader_pow_mod(size_t base, size_t exp, const size_t mod)
+{
+    size_t result = 1;
+    for(; exp; exp >>= 1)
+    {
+        if(exp & 1)
+            result = result * base % mod;
+        base = base * base % mod;
+    }
+    return result;
+}
+
+// rader_kernel_device writes the length N-1 kernel of a Rader transform,
+// the twiddles exp(dir 2 pi i g^-m / N) scaled by 1 / (N - 1) so that the
+// inverse FFT of the convolution needs no normalization.  ginv is the
+// inverse of the primitive root g modulo N.  rader_create transforms it
+// into the table of the plan.
+template <typename T>
+__global__ void rader_kernel_device(const size_t N, const size_t ginv, T* output, const int dir)
+{
+    size_t tx = hipThreadIdx_x + hipBlockIdx_x * hipBlockDim_x;
+
+    if(tx >= N - 1)
+        return;
+
+    const double theta = dir * 2 * M_PI * (double)rader_pow_mod(ginv, tx, N) / N;
+    const double scale = 1.0 / (N - 1);
+
+    output[tx] = lib_make_vector2<T>((real_type_t<T>)(scale * cos(theta)),
+                                     (real_type_t<T>)(scale * sin(theta)));
+}
+
+// rader_device takes care of the permutation of the inputs by powers of the
+// primitive root g (scheme 0), the multiplication by the FFT of the kernel
+// (scheme 1) and the permutation of the outputs by powers of its inverse
+// (scheme 2).  Each length N row of the temp buffer holds the N-1 permuted
+// inputs followed by x[0], which the multiplication replaces by X[0].
+// Real and imaginary parts are read with a step of 2 for interleaved and 1
+// for planar buffers.  The stored values are multiplied by scale.
+template <typename T>
+__global__ void rader_device(const size_t          totalWI,
+                             const size_t          N,
+                             const size_t          g,
+                             const T*              kernel,
+                             const size_t          dim,
+                             const size_t*         lengths,
+                             const size_t*         stride_in,
+                             const size_t*         stride_out,
+                             const int             scheme,
+                             const real_type_t<T>* inRe,
+                             const real_type_t<T>* inIm,
+                             const size_t          inStep,
+                             real_type_t<T>*       outRe,
+                             real_type_t<T>*       outIm,
+                             const size_t          outStep,
+                             const real_type_t<T>  scale)
+{
+    size_t tx = hipThreadIdx_x + hipBlockIdx_x * hipBlockDim_x;
+
+    if(tx >= totalWI)
+        return;
+
+    size_t iOffset = 0;
+    size_t oOffset = 0;
+
+    size_t counter_mod = tx / N;
+
+    for(size_t i = dim; i > 1; i--)
+    {
+        size_t currentLength = 1;
+        for(size_t j = 1; j < i; j++)
+        {
+            currentLength *= lengths[j];
+        }
+
+        iOffset += (counter_mod / currentLength) * stride_in[i];
+        oOffset += (counter_mod / currentLength) * stride_out[i];
+        counter_mod = counter_mod % currentLength;
+    }
+    iOffset += counter_mod * stride_in[1];
+    oOffset += counter_mod * stride_out[1];
+
+    tx = tx % N;
+
+    size_t iIdx = 0;
+    size_t oIdx = 0;
+    if(scheme == 0)
+    {
+        iIdx = (tx < N - 1) ? rader_pow_mod(g, tx, N) : 0;
+        oIdx = tx;
+    }
+    else if(scheme == 1)
+    {
+        if(tx == N - 1)
+            return;
+
+        iIdx = tx;
+        oIdx = tx;
+    }
+    else
+    {
+        iIdx = tx;
+        oIdx = (tx < N - 1) ? rader_pow_mod(rader_pow_mod(g, N - 2, N), tx, N) : 0;
+    }
+
+    iIdx = (iOffset + iIdx * stride_in[0]) * inStep;
+    oIdx = (oOffset + oIdx * stride_out[0]) * outStep;
+
+    real_type_t<T> re = inRe[iIdx];
+    real_type_t<T> im = inIm[iIdx];
+
+    if(scheme == 1)
+    {
+        const T k = kernel[tx];
+
+        const real_type_t<T> mulRe = re * k.x - im * k.y;
+        const real_type_t<T> mulIm = re * k.y + im * k.x;
+
+        if(tx == 0)
+        {
+            // X[0] = x[0] + A[0], and x[0] is added to every output by
+            // adding it to the zero frequency of the convolution
+            const size_t   x0Idx = (iOffset + (N - 1) * stride_in[0]) * inStep;
+            const size_t   X0Idx = (oOffset + (N - 1) * stride_out[0]) * outStep;
+            real_type_t<T> x0Re  = inRe[x0Idx];
+            real_type_t<T> x0Im  = inIm[x0Idx];
+            outRe[X0Idx]         = scale * (x0Re + re);
+            outIm[X0Idx]         = scale * (x0Im + im);
+
+            re = mulRe + x0Re;
+            im = mulIm + x0Im;
+        }
+        else
+        {
+            re = mulRe;
+            im = mulIm;
+        }
+    }
+
+    outRe[oIdx] = scale * re;
+    outIm[oIdx] = scale * im;
+}
+
+#endif // RADER_H
@@ -198,17 +198,18 @@ template <typename T,
           int    TWL,
           int    DIR,
           bool   ALL>
-__device__ void transpose_tile_device(const T_I*   input,
-                                      T_O*         output,
-                                      size_t       in_offset,
-                                      size_t       out_offset,
-                                      const size_t m,
-                                      const size_t n,
-                                      size_t       gx,
-                                      size_t       gy,
-                                      size_t       ld_in,
-                                      size_t       ld_out,
-                                      T*           twiddles_large)
+__device__ void transpose_tile_device(const T_I*           input,
+                                      T_O*                 output,
+                                      size_t               in_offset,
+                                      size_t               out_offset,
+                                      const size_t         m,
+                                      const size_t         n,
+                                      size_t               gx,
+                                      size_t               gy,
+                                      size_t               ld_in,
+                                      size_t               ld_out,
+                                      T*                   twiddles_large,
+                                      const real_type_t<T> scale)
 {
     __shared__ T shared_A[DIM_X][DIM_X];
 
@@ -234,7 +235,7 @@ __device__ void transpose_tile_device(const T_I*   input,
             // reconfigure the threads
             //output[tx1 + (i + ty1) * ld_out] = shared_A[ty1 + i][tx1];
             Handler<T_O>::write(
-                output, out_offset + tx1 + (i + ty1) * ld_out, shared_A[ty1 + i][tx1]);
+                output, out_offset + tx1 + (i + ty1) * ld_out, scale * shared_A[ty1 + i][tx1]);
         }
     }
     else
@@ -257,8 +258,9 @@ __device__ void transpose_tile_device(const T_I*   input,
             if(tx1 < m && (ty1 + i) < n)
             {
                 //output[tx1 + (i + ty1) * ld_out] = shared_A[ty1 + i][tx1];
-                Handler<T_O>::write(
-                    output, out_offset + tx1 + (i + ty1) * ld_out, shared_A[ty1 + i][tx1]);
+                Handler<T_O>::write(output,
+                                    out_offset + tx1 + (i + ty1) * ld_out,
+                                    scale * shared_A[ty1 + i][tx1]);
             }
         }
     }
@@ -277,13 +279,14 @@ template <typename T,
           int    TWL,
           int    DIR,
           bool   ALL>
-__global__ void transpose_kernel2(const T_I* input,
-                                  T_O*       output,
-                                  T*         twiddles_large,
-                                  size_t     dim,
-                                  size_t*    lengths,
-                                  size_t*    stride_in,
-                                  size_t*    stride_out)
+__global__ void transpose_kernel2(const T_I*           input,
+                                  T_O*                 output,
+                                  T*                   twiddles_large,
+                                  size_t               dim,
+                                  size_t*              lengths,
+                                  size_t*              stride_in,
+                                  size_t*              stride_out,
+                                  const real_type_t<T> scale)
 {
     size_t ld_in  = stride_in[1];
     size_t ld_out = stride_out[1];
@@ -326,7 +329,8 @@ __global__ void transpose_kernel2(const T_I* input,
             hipBlockIdx_y * DIM_X,
             ld_in,
             ld_out,
-            twiddles_large);
+            twiddles_large,
+            scale);
     }
     else
     {
@@ -345,19 +349,101 @@ __global__ void transpose_kernel2(const T_I* input,
             hipBlockIdx_y * DIM_X,
             ld_in,
             ld_out,
-            twiddles_large);
+            twiddles_large,
+            scale);
+    }
+}
+
+// - Good-Thomas transpose of a CS_L1D_PFA plan: element (i0, i1) of the
+//   lengths[0] x lengths[1] input is read from linear index
+//   (pfa_in0 * i0 + pfa_in1 * i1) mod N of the input and written to linear
+//   index (pfa_out0 * i0 + pfa_out1 * i1) mod N of the transposed output,
+//   N = lengths[0] * lengths[1]
+// - 2D grid and 2D thread block (DIM_X, DIM_Y) as in transpose_kernel2, so
+//   a plain map reads and writes as it does
+template <typename T, typename T_I, typename T_O, size_t DIM_X, size_t DIM_Y>
+__global__ void transpose_kernel2_pfa(const T_I*           input,
+                                      T_O*                 output,
+                                      size_t               dim,
+                                      size_t*              lengths,
+                                      size_t*              stride_in,
+                                      size_t*              stride_out,
+                                      const size_t         pfa_in0,
+                                      const size_t         pfa_in1,
+                                      const size_t         pfa_out0,
+                                      const size_t         pfa_out1,
+                                      const real_type_t<T> scale)
+{
+    __shared__ T shared_A[DIM_X][DIM_X];
+
+    size_t iOffset = 0;
+    size_t oOffset = 0;
+
+    size_t counter_mod = hipBlockIdx_z;
+
+    for(size_t i = dim; i > 2; i--)
+    {
+        size_t currentLength = 1;
+        for(size_t j = 2; j < i; j++)
+        {
+            currentLength *= lengths[j];
+        }
+
+        iOffset += (counter_mod / currentLength) * stride_in[i];
+        oOffset += (counter_mod / currentLength) * stride_out[i];
+        counter_mod = counter_mod % currentLength;
+    }
+    iOffset += counter_mod * stride_in[2];
+    oOffset += counter_mod * stride_out[2];
+
+    const size_t n0 = lengths[0];
+    const size_t n1 = lengths[1];
+    const size_t N  = n0 * n1;
+
+    size_t tid = hipThreadIdx_x + hipThreadIdx_y * hipBlockDim_x;
+    size_t tx1 = tid % DIM_X;
+    size_t ty1 = tid / DIM_X;
+    size_t gx  = hipBlockIdx_x * DIM_X;
+    size_t gy  = hipBlockIdx_y * DIM_X;
+
+    for(size_t i = 0; i < DIM_X; i += DIM_Y)
+    {
+        const size_t i0 = gx + tx1;
+        const size_t i1 = gy + ty1 + i;
+        if(i0 < n0 && i1 < n1)
+        {
+            const size_t l = (pfa_in0 * i0 + pfa_in1 * i1) % N;
+            shared_A[tx1][ty1 + i] = Handler<T_I>::read(
+                input, iOffset + (l % n0) * stride_in[0] + (l / n0) * stride_in[1]);
+        }
+    }
+
+    __syncthreads();
+
+    for(size_t i = 0; i < DIM_X; i += DIM_Y)
+    {
+        const size_t i0 = gx + ty1 + i;
+        const size_t i1 = gy + tx1;
+        if(i0 < n0 && i1 < n1)
+        {
+            const size_t l = (pfa_out0 * i0 + pfa_out1 * i1) % N;
+            Handler<T_O>::write(output,
+                                oOffset + (l % n1) * stride_out[0] + (l / n1) * stride_out[1],
+                                scale * shared_A[ty1 + i][tx1]);
+        }
     }
 }
 
 template <typename T, typename T_I, typename T_O, size_t DIM_X, size_t DIM_Y, bool ALL>
-__global__ void transpose_kernel2_scheme(const T_I*   input,
-                                         T_O*         output,
-                                         T*           twiddles_large,
-                                         size_t       dim,
-                                         size_t*      lengths,
-                                         size_t*      stride_in,
-                                         size_t*      stride_out,
-                                         const size_t scheme)
+__global__ void transpose_kernel2_scheme(const T_I*           input,
+                                         T_O*                 output,
+                                         T*                   twiddles_large,
+                                         size_t               dim,
+                                         size_t*              lengths,
+                                         size_t*              stride_in,
+                                         size_t*              stride_out,
+                                         const size_t         scheme,
+                                         const real_type_t<T> scale)
 {
     size_t ld_in  = scheme == 1 ? stride_in[2] : stride_in[1];
     size_t ld_out = scheme == 1 ? stride_out[1] : stride_out[2];
@@ -399,7 +485,8 @@ __global__ void transpose_kernel2_scheme(const T_I*   input,
                                                                            hipBlockIdx_y * DIM_X,
                                                                            ld_in,
                                                                            ld_out,
-                                                                           twiddles_large);
+                                                                           twiddles_large,
+                                                                           scale);
     }
     else
     {
@@ -417,8 +504,88 @@ __global__ void transpose_kernel2_scheme(const T_I*   input,
                                                                            hipBlockIdx_y * DIM_X,
                                                                            ld_in,
                                                                            ld_out,
-                                                                           twiddles_large);
+                                                                           twiddles_large,
+                                                                           scale);
+    }
+}
+
+// In-place transpose of count contiguous square dim x dim matrices, one per
+// block in z.  The block at tile (x, y) with x >= y exchanges its tile with
+// the tile at (y, x) through LDS; a diagonal tile is exchanged with itself.
+template <typename T, size_t DIM_X, size_t DIM_Y>
+__global__ void transpose_inplace_square_kernel(T*                   data,
+                                                const size_t         dim,
+                                                const size_t         dist,
+                                                const real_type_t<T> scale)
+{
+    if(hipBlockIdx_x < hipBlockIdx_y)
+        return;
+
+    __shared__ T tileA[DIM_X][DIM_X + 1];
+    __shared__ T tileB[DIM_X][DIM_X + 1];
+
+    T*           a   = data + hipBlockIdx_z * dist;
+    const size_t ax  = hipBlockIdx_x * DIM_X;
+    const size_t ay  = hipBlockIdx_y * DIM_X;
+    const size_t col = hipThreadIdx_x;
+
+    for(size_t j = hipThreadIdx_y; j < DIM_X; j += DIM_Y)
+    {
+        if(ay + j < dim && ax + col < dim)
+            tileA[j][col] = a[(ay + j) * dim + ax + col];
+        if(ax + j < dim && ay + col < dim)
+            tileB[j][col] = a[(ax + j) * dim + ay + col];
     }
+
+    __syncthreads();
+
+    for(size_t j = hipThreadIdx_y; j < DIM_X; j += DIM_Y)
+    {
+        if(ax + j < dim && ay + col < dim)
+            a[(ax + j) * dim + ay + col] = scale * tileA[col][j];
+        if(ay + j < dim && ax + col < dim)
+            a[(ay + j) * dim + ax + col] = scale * tileB[col][j];
+    }
+}
+
+// In-place transpose of count contiguous rectangular matrices of N elements
+// in rows rows, one per block in z.  The element at p moves to
+// p * rows mod (N - 1); each thread takes one start index and, if that is
+// the smallest index of its permutation cycle, moves the whole cycle.
+template <typename T>
+__global__ void transpose_inplace_cycle_kernel(T*                   data,
+                                               const size_t         rows,
+                                               const size_t         N,
+                                               const size_t         dist,
+                                               const real_type_t<T> scale)
+{
+    const size_t start = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(start >= N)
+        return;
+
+    T* a = data + hipBlockIdx_z * dist;
+
+    // the first and last elements stay in place and are only scaled
+    if(start == 0 || start == N - 1)
+    {
+        a[start] = scale * a[start];
+        return;
+    }
+
+    size_t p = start * rows % (N - 1);
+    while(p > start)
+        p = p * rows % (N - 1);
+    if(p != start)
+        return;
+
+    T carry = a[start];
+    do
+    {
+        p      = p * rows % (N - 1);
+        T next = a[p];
+        a[p]   = scale * carry;
+        carry  = next;
+    } while(p != start);
 }
 
 #endif // TRANSPOSE_H
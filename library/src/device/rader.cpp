@@ -0,0 +1,124 @@
+/******************************************************************************
+* Copyright (c) 2016 - present Advanced Micro Devices, Inc. All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*******************************************************************************/
+
+#include "rader.h"
+#include "kernel_launch.h"
+#include "plan.h"
+#include "rocfft_hip.h"
+#include <iostream>
+
+template <typename T>
+static void rader_launch(const DeviceCallIn* data)
+{
+    using R = real_type_t<T>;
+
+    const TreeNode* node = data->node;
+
+    int scheme = 1; // mul
+    if(node->scheme == CS_KERNEL_RADER_PERMUTE)
+        scheme = 0;
+    else if(node->scheme == CS_KERNEL_RADER_UNPERMUTE)
+        scheme = 2;
+
+    const size_t N = node->length[0];
+
+    size_t count = data->batch;
+    for(size_t i = 1; i < node->length.size(); i++)
+        count *= node->length[i];
+    count *= N;
+
+    const bool inPlanar  = (node->inArrayType == rocfft_array_type_complex_planar)
+                          || (node->inArrayType == rocfft_array_type_hermitian_planar);
+    const bool outPlanar = (node->outArrayType == rocfft_array_type_complex_planar)
+                           || (node->outArrayType == rocfft_array_type_hermitian_planar);
+
+    const R* inRe  = (const R*)data->bufIn[0];
+    const R* inIm  = inPlanar ? (const R*)data->bufIn[1] : inRe + 1;
+    R*       outRe = (R*)data->bufOut[0];
+    R*       outIm = outPlanar ? (R*)data->bufOut[1] : outRe + 1;
+
+    dim3 grid((count - 1) / 64 + 1);
+    dim3 threads(64);
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(rader_device<T>),
+                       grid,
+                       threads,
+                       0,
+                       data->rocfft_stream,
+                       count,
+                       N,
+                       node->raderRoot,
+                       (const T*)node->chirp,
+                       node->length.size(),
+                       node->devKernArg,
+                       node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,
+                       node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,
+                       scheme,
+                       inRe,
+                       inIm,
+                       inPlanar ? 1 : 2,
+                       outRe,
+                       outIm,
+                       outPlanar ? 1 : 2,
+                       (R)node->scale);
+}
+
+void rocfft_internal_rader(const void* data_p, void* back_p)
+{
+    DeviceCallIn* data = (DeviceCallIn*)data_p;
+
+    if(data->node->precision == rocfft_precision_single)
+        rader_launch<float2>(data);
+    else
+        rader_launch<double2>(data);
+}
+
+template <typename T>
+static void rader_kernel_launch(
+    const size_t N, const size_t g, const int dir, T* kernel, hipStream_t rocfft_stream)
+{
+    dim3 grid((N - 2) / 64 + 1);
+    dim3 threads(64);
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(rader_kernel_device<T>),
+                       grid,
+                       threads,
+                       0,
+                       rocfft_stream,
+                       N,
+                       PowMod(g, N - 2, N),
+                       kernel,
+                       dir);
+}
+
+void rocfft_internal_rader_kernel(size_t           N,
+                                  size_t           g,
+                                  int              dir,
+                                  rocfft_precision precision,
+                                  void*            kernel,
+                                  hipStream_t      rocfft_stream)
+{
+    if(precision == rocfft_precision_single)
+        rader_kernel_launch<float2>(N, g, dir, (float2*)kernel, rocfft_stream);
+    else
+        rader_kernel_launch<double2>(N, g, dir, (double2*)kernel, rocfft_stream);
+}
@@ -33,7 +33,8 @@ __global__ static void real2complex_kernel(const size_t                 input_si
                                            const real_type_t<Tcomplex>* input0,
                                            const size_t                 idist,
                                            Tcomplex*                    output0,
-                                           const size_t                 odist)
+                                           const size_t                 odist,
+                                           const real_type_t<Tcomplex>  scale)
 {
     const size_t tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
 
@@ -44,7 +45,7 @@ __global__ static void real2complex_kernel(const size_t                 input_si
         const auto input  = input0 + blockIdx.y * idist1D + blockIdx.z * idist;
         auto       output = output0 + blockIdx.y * odist1D + blockIdx.z * odist;
 
-        output[tid].x = input[tid];
+        output[tid].x = scale * input[tid];
         output[tid].y = 0.0;
     }
 }
@@ -76,7 +77,7 @@ void real2complex(const void* data_p, void* back_p)
     void* input_buffer  = data->bufIn[0];
     void* output_buffer = data->bufOut[0];
 
-    size_t batch          = data->node->batch;
+    size_t batch          = data->batch;
     size_t high_dimension = 1;
     if(data->node->length.size() > 1)
     {
@@ -112,7 +113,8 @@ void real2complex(const void* data_p, void* back_p)
                            (float*)input_buffer,
                            input_distance,
                            (float2*)output_buffer,
-                           output_distance);
+                           output_distance,
+                           (float)data->node->scale);
     else
         hipLaunchKernelGGL(real2complex_kernel<double2>,
                            grid,
@@ -125,7 +127,8 @@ void real2complex(const void* data_p, void* back_p)
                            (double*)input_buffer,
                            input_distance,
                            (double2*)output_buffer,
-                           output_distance);
+                           output_distance,
+                           (double)data->node->scale);
 
     // float2* tmp; tmp = (float2*)malloc(sizeof(float2)*output_distance*batch);
     // hipMemcpy(tmp, output_buffer, sizeof(float2)*output_distance*batch,
@@ -143,13 +146,14 @@ void real2complex(const void* data_p, void* back_p)
 
 // The complex to hermitian simple copy kernel for interleaved format
 template <typename Tcomplex>
-__global__ static void complex2hermitian_kernel(const size_t    input_size,
-                                                const size_t    idist1D,
-                                                const size_t    odist1D,
-                                                const Tcomplex* input0,
-                                                const size_t    idist,
-                                                Tcomplex*       output0,
-                                                const size_t    odist)
+__global__ static void complex2hermitian_kernel(const size_t                input_size,
+                                                const size_t                idist1D,
+                                                const size_t                odist1D,
+                                                const Tcomplex*             input0,
+                                                const size_t                idist,
+                                                Tcomplex*                   output0,
+                                                const size_t                odist,
+                                                const real_type_t<Tcomplex> scale)
 {
     const size_t tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
 
@@ -161,20 +165,21 @@ __global__ static void complex2hermitian_kernel(const size_t    input_size,
         const auto input  = input0 + blockIdx.y * idist1D + blockIdx.z * idist;
         auto       output = output0 + blockIdx.y * odist1D + blockIdx.z * odist;
 
-        output[tid] = input[tid];
+        output[tid] = scale * input[tid];
     }
 }
 
 // The planar overload function of the above interleaved one
 template <typename Tcomplex>
-__global__ static void complex2hermitian_kernel(const size_t           input_size,
-                                                const size_t           idist1D,
-                                                const size_t           odist1D,
-                                                const Tcomplex*        input0,
-                                                const size_t           idist,
-                                                real_type_t<Tcomplex>* outputRe0,
-                                                real_type_t<Tcomplex>* outputIm0,
-                                                const size_t           odist)
+__global__ static void complex2hermitian_kernel(const size_t                input_size,
+                                                const size_t                idist1D,
+                                                const size_t                odist1D,
+                                                const Tcomplex*             input0,
+                                                const size_t                idist,
+                                                real_type_t<Tcomplex>*      outputRe0,
+                                                real_type_t<Tcomplex>*      outputIm0,
+                                                const size_t                odist,
+                                                const real_type_t<Tcomplex> scale)
 {
     const size_t tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
 
@@ -187,8 +192,8 @@ __global__ static void complex2hermitian_kernel(const size_t           input_siz
         auto       outputRe = outputRe0 + blockIdx.y * odist1D + blockIdx.z * odist;
         auto       outputIm = outputIm0 + blockIdx.y * odist1D + blockIdx.z * odist;
 
-        outputRe[tid] = input[tid].x;
-        outputIm[tid] = input[tid].y;
+        outputRe[tid] = scale * input[tid].x;
+        outputIm[tid] = scale * input[tid].y;
     }
 }
 
@@ -223,7 +228,7 @@ void complex2hermitian(const void* data_p, void* back_p)
     void* input_buffer  = data->bufIn[0];
     void* output_buffer = data->bufOut[0];
 
-    size_t batch          = data->node->batch;
+    size_t batch          = data->batch;
     size_t high_dimension = 1;
     if(data->node->length.size() > 1)
     {
@@ -275,7 +280,8 @@ void complex2hermitian(const void* data_p, void* back_p)
                                (float2*)input_buffer,
                                input_distance,
                                (float2*)output_buffer,
-                               output_distance);
+                               output_distance,
+                               (float)data->node->scale);
         else
             hipLaunchKernelGGL(complex2hermitian_kernel<double2>,
                                grid,
@@ -288,7 +294,8 @@ void complex2hermitian(const void* data_p, void* back_p)
                                (double2*)input_buffer,
                                input_distance,
                                (double2*)output_buffer,
-                               output_distance);
+                               output_distance,
+                               (double)data->node->scale);
     }
     else if(data->node->outArrayType == rocfft_array_type_hermitian_planar)
     {
@@ -305,7 +312,8 @@ void complex2hermitian(const void* data_p, void* back_p)
                                input_distance,
                                (float*)data->bufOut[0],
                                (float*)data->bufOut[1],
-                               output_distance);
+                               output_distance,
+                               (float)data->node->scale);
         else
             hipLaunchKernelGGL(complex2hermitian_kernel<double2>,
                                grid,
@@ -319,7 +327,8 @@ void complex2hermitian(const void* data_p, void* back_p)
                                input_distance,
                                (double*)data->bufOut[0],
                                (double*)data->bufOut[1],
-                               output_distance);
+                               output_distance,
+                               (double)data->node->scale);
     }
     else
     {
@@ -327,3 +336,239 @@ void complex2hermitian(const void* data_p, void* back_p)
         std::cout << "Unsupported output format in complex2hermitian kernel!" << std::endl;
     }
 }
+
+// Pack batch members 2p and 2p + 1 of real input into the real and
+// imaginary parts of the p-th complex output.  The last member of an odd
+// batch is paired with zeros.
+template <typename Tcomplex>
+__global__ static void pair_real2complex_kernel(const size_t                 dim_0,
+                                                const size_t                 dim_1,
+                                                const size_t                 batch,
+                                                const size_t                 istride0,
+                                                const size_t                 istride1,
+                                                const size_t                 istride2,
+                                                const real_type_t<Tcomplex>* input,
+                                                const size_t                 idist,
+                                                const size_t                 ostride0,
+                                                const size_t                 ostride1,
+                                                const size_t                 ostride2,
+                                                Tcomplex*                    output,
+                                                const size_t                 odist,
+                                                const real_type_t<Tcomplex>  scale)
+{
+    const size_t tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(tid < dim_0)
+    {
+        const size_t i1 = hipBlockIdx_y % dim_1;
+        const size_t i2 = hipBlockIdx_y / dim_1;
+        const size_t p  = hipBlockIdx_z;
+
+        const size_t iOffset = i2 * istride2 + i1 * istride1 + tid * istride0;
+
+        Tcomplex z;
+        z.x = input[2 * p * idist + iOffset];
+        z.y = (2 * p + 1 < batch) ? input[(2 * p + 1) * idist + iOffset] : 0;
+
+        output[p * odist + i2 * ostride2 + i1 * ostride1 + tid * ostride0] = scale * z;
+    }
+}
+
+// Separate the transform Z of a pair into the hermitian halves of the
+// transforms of its members: A[k] = (Z[k] + conj(Z[-k])) / 2 and
+// B[k] = (Z[k] - conj(Z[-k])) / 2i, with -k mirrored in every dimension.
+template <typename Tcomplex>
+__global__ static void pair_complex2hermitian_kernel(const size_t                hermitian_size,
+                                                     const size_t                dim_0,
+                                                     const size_t                dim_1,
+                                                     const size_t                dim_2,
+                                                     const size_t                batch,
+                                                     const size_t                istride0,
+                                                     const size_t                istride1,
+                                                     const size_t                istride2,
+                                                     const Tcomplex*             input,
+                                                     const size_t                idist,
+                                                     const size_t                ostride0,
+                                                     const size_t                ostride1,
+                                                     const size_t                ostride2,
+                                                     Tcomplex*                   output,
+                                                     const size_t                odist,
+                                                     const real_type_t<Tcomplex> scale)
+{
+    const size_t tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(tid < hermitian_size)
+    {
+        const size_t k1 = hipBlockIdx_y % dim_1;
+        const size_t k2 = hipBlockIdx_y / dim_1;
+        const size_t p  = hipBlockIdx_z;
+
+        // mirrored indices
+        const size_t m0 = (tid == 0) ? 0 : dim_0 - tid;
+        const size_t m1 = (k1 == 0) ? 0 : dim_1 - k1;
+        const size_t m2 = (k2 == 0) ? 0 : dim_2 - k2;
+
+        const Tcomplex z  = input[p * idist + k2 * istride2 + k1 * istride1 + tid * istride0];
+        const Tcomplex zm = input[p * idist + m2 * istride2 + m1 * istride1 + m0 * istride0];
+
+        const size_t                oOffset = k2 * ostride2 + k1 * ostride1 + tid * ostride0;
+        const real_type_t<Tcomplex> half    = 0.5 * scale;
+
+        Tcomplex a;
+        a.x                             = half * (z.x + zm.x);
+        a.y                             = half * (z.y - zm.y);
+        output[2 * p * odist + oOffset] = a;
+
+        if(2 * p + 1 < batch)
+        {
+            Tcomplex b;
+            b.x                                   = half * (z.y + zm.y);
+            b.y                                   = -half * (z.x - zm.x);
+            output[(2 * p + 1) * odist + oOffset] = b;
+        }
+    }
+}
+
+// Strides of the two outer dimensions of a node of up to three dimensions.
+static void pair_outer_strides(const std::vector<size_t>& stride, size_t& stride1, size_t& stride2)
+{
+    stride1 = (stride.size() > 1) ? stride[1] : 0;
+    stride2 = (stride.size() > 2) ? stride[2] : 0;
+}
+
+/// \brief auxiliary function
+///   pack pairs of real batch members into the real and imaginary parts of
+///   complex transforms of half the batch size
+void pair_real2complex(const void* data_p, void* back_p)
+{
+    DeviceCallIn* data = (DeviceCallIn*)data_p;
+
+    const size_t dim_0 = data->node->length[0];
+    const size_t dim_1 = (data->node->length.size() > 1) ? data->node->length[1] : 1;
+    const size_t dim_2 = (data->node->length.size() > 2) ? data->node->length[2] : 1;
+
+    size_t istride1, istride2, ostride1, ostride2;
+    pair_outer_strides(data->node->inStride, istride1, istride2);
+    pair_outer_strides(data->node->outStride, ostride1, ostride2);
+
+    const size_t batch = data->batch;
+    const size_t pairs = (batch + 1) / 2;
+
+    dim3 grid((dim_0 - 1) / 512 + 1, dim_1 * dim_2, pairs);
+    dim3 threads(512, 1, 1);
+
+    hipStream_t rocfft_stream = data->rocfft_stream;
+
+    if(data->node->precision == rocfft_precision_single)
+        hipLaunchKernelGGL(pair_real2complex_kernel<float2>,
+                           grid,
+                           threads,
+                           0,
+                           rocfft_stream,
+                           dim_0,
+                           dim_1,
+                           batch,
+                           data->node->inStride[0],
+                           istride1,
+                           istride2,
+                           (float*)data->bufIn[0],
+                           data->node->iDist,
+                           data->node->outStride[0],
+                           ostride1,
+                           ostride2,
+                           (float2*)data->bufOut[0],
+                           data->node->oDist,
+                           (float)data->node->scale);
+    else
+        hipLaunchKernelGGL(pair_real2complex_kernel<double2>,
+                           grid,
+                           threads,
+                           0,
+                           rocfft_stream,
+                           dim_0,
+                           dim_1,
+                           batch,
+                           data->node->inStride[0],
+                           istride1,
+                           istride2,
+                           (double*)data->bufIn[0],
+                           data->node->iDist,
+                           data->node->outStride[0],
+                           ostride1,
+                           ostride2,
+                           (double2*)data->bufOut[0],
+                           data->node->oDist,
+                           (double)data->node->scale);
+}
+
+/// \brief auxiliary function
+///   separate the complex transforms of pairs of real batch members into the
+///   hermitian outputs of both members
+void pair_complex2hermitian(const void* data_p, void* back_p)
+{
+    DeviceCallIn* data = (DeviceCallIn*)data_p;
+
+    const size_t dim_0          = data->node->length[0];
+    const size_t dim_1          = (data->node->length.size() > 1) ? data->node->length[1] : 1;
+    const size_t dim_2          = (data->node->length.size() > 2) ? data->node->length[2] : 1;
+    const size_t hermitian_size = dim_0 / 2 + 1;
+
+    size_t istride1, istride2, ostride1, ostride2;
+    pair_outer_strides(data->node->inStride, istride1, istride2);
+    pair_outer_strides(data->node->outStride, ostride1, ostride2);
+
+    const size_t batch = data->batch;
+    const size_t pairs = (batch + 1) / 2;
+
+    dim3 grid((hermitian_size - 1) / 512 + 1, dim_1 * dim_2, pairs);
+    dim3 threads(512, 1, 1);
+
+    hipStream_t rocfft_stream = data->rocfft_stream;
+
+    assert(data->node->outArrayType == rocfft_array_type_hermitian_interleaved);
+
+    if(data->node->precision == rocfft_precision_single)
+        hipLaunchKernelGGL(pair_complex2hermitian_kernel<float2>,
+                           grid,
+                           threads,
+                           0,
+                           rocfft_stream,
+                           hermitian_size,
+                           dim_0,
+                           dim_1,
+                           dim_2,
+                           batch,
+                           data->node->inStride[0],
+                           istride1,
+                           istride2,
+                           (float2*)data->bufIn[0],
+                           data->node->iDist,
+                           data->node->outStride[0],
+                           ostride1,
+                           ostride2,
+                           (float2*)data->bufOut[0],
+                           data->node->oDist,
+                           (float)data->node->scale);
+    else
+        hipLaunchKernelGGL(pair_complex2hermitian_kernel<double2>,
+                           grid,
+                           threads,
+                           0,
+                           rocfft_stream,
+                           hermitian_size,
+                           dim_0,
+                           dim_1,
+                           dim_2,
+                           batch,
+                           data->node->inStride[0],
+                           istride1,
+                           istride2,
+                           (double2*)data->bufIn[0],
+                           data->node->iDist,
+                           data->node->outStride[0],
+                           ostride1,
+                           ostride2,
+                           (double2*)data->bufOut[0],
+                           data->node->oDist,
+                           (double)data->node->scale);
+}
@@ -31,14 +31,17 @@
 // Each thread handles 2 points.
 // When N is divisible by 4, one value is handled separately; this is controlled by Ndiv4.
 template <typename Tcomplex, bool Ndiv4>
-__global__ static void real_post_process_kernel(const size_t    half_N,
-                                                const size_t    idist1D,
-                                                const size_t    odist1D,
-                                                const Tcomplex* input0,
-                                                const size_t    idist,
-                                                Tcomplex*       output0,
-                                                const size_t    odist,
-                                                Tcomplex const* twiddles)
+__global__ static void real_post_process_kernel(const size_t                half_N,
+                                                const size_t                idist1D,
+                                                const size_t                odist1D,
+                                                const size_t                istride0,
+                                                const size_t                ostride0,
+                                                const Tcomplex*             input0,
+                                                const size_t                idist,
+                                                Tcomplex*                   output0,
+                                                const size_t                odist,
+                                                Tcomplex const*             twiddles,
+                                                const real_type_t<Tcomplex> scale)
 {
     // blockIdx.y gives the multi-dimensional offset
     // blockIdx.z gives the batch offset
@@ -57,47 +60,50 @@ __global__ static void real_post_process_kernel(const size_t    half_N,
 
         if(idx_p == 0)
         {
-            output[half_N].x = input[0].x - input[0].y;
-            output[half_N].y = 0;
-            output[0].x      = input[0].x + input[0].y;
-            output[0].y      = 0;
+            output[half_N * ostride0].x = scale * (input[0].x - input[0].y);
+            output[half_N * ostride0].y = 0;
+            output[0].x                 = scale * (input[0].x + input[0].y);
+            output[0].y                 = 0;
 
             if(Ndiv4)
             {
-                output[quarter_N].x = input[quarter_N].x;
-                output[quarter_N].y = -input[quarter_N].y;
+                output[quarter_N * ostride0].x = scale * input[quarter_N * istride0].x;
+                output[quarter_N * ostride0].y = -scale * input[quarter_N * istride0].y;
             }
         }
         else
         {
-            const Tcomplex p = input[idx_p];
-            const Tcomplex q = input[idx_q];
-            const Tcomplex u = 0.5 * (p + q);
-            const Tcomplex v = 0.5 * (p - q);
+            const Tcomplex p = input[idx_p * istride0];
+            const Tcomplex q = input[idx_q * istride0];
+            const Tcomplex u = (0.5 * scale) * (p + q);
+            const Tcomplex v = (0.5 * scale) * (p - q);
 
             const Tcomplex twd_p = twiddles[idx_p];
             // NB: twd_q = -conj(twd_p) = (-twd_p.x, twd_p.y);
 
-            output[idx_p].x = u.x + v.x * twd_p.y + u.y * twd_p.x;
-            output[idx_p].y = v.y + u.y * twd_p.y - v.x * twd_p.x;
+            output[idx_p * ostride0].x = u.x + v.x * twd_p.y + u.y * twd_p.x;
+            output[idx_p * ostride0].y = v.y + u.y * twd_p.y - v.x * twd_p.x;
 
-            output[idx_q].x = u.x - v.x * twd_p.y - u.y * twd_p.x;
-            output[idx_q].y = -v.y + u.y * twd_p.y - v.x * twd_p.x;
+            output[idx_q * ostride0].x = u.x - v.x * twd_p.y - u.y * twd_p.x;
+            output[idx_q * ostride0].y = -v.y + u.y * twd_p.y - v.x * twd_p.x;
         }
     }
 }
 
 // Overloaded version of the above for planar format
 template <typename Tcomplex, bool Ndiv4>
-__global__ static void real_post_process_kernel(const size_t           half_N,
-                                                const size_t           idist1D,
-                                                const size_t           odist1D,
-                                                const Tcomplex*        input0,
-                                                const size_t           idist,
-                                                real_type_t<Tcomplex>* output0Re,
-                                                real_type_t<Tcomplex>* output0Im,
-                                                const size_t           odist,
-                                                Tcomplex const*        twiddles)
+__global__ static void real_post_process_kernel(const size_t                half_N,
+                                                const size_t                idist1D,
+                                                const size_t                odist1D,
+                                                const size_t                istride0,
+                                                const size_t                ostride0,
+                                                const Tcomplex*             input0,
+                                                const size_t                idist,
+                                                real_type_t<Tcomplex>*      output0Re,
+                                                real_type_t<Tcomplex>*      output0Im,
+                                                const size_t                odist,
+                                                Tcomplex const*             twiddles,
+                                                const real_type_t<Tcomplex> scale)
 {
     // blockIdx.y gives the multi-dimensional offset
     // blockIdx.z gives the batch offset
@@ -117,32 +123,32 @@ __global__ static void real_post_process_kernel(const size_t           half_N,
 
         if(idx_p == 0)
         {
-            outputRe[half_N] = input[0].x - input[0].y;
-            outputIm[half_N] = 0;
-            outputRe[0]      = input[0].x + input[0].y;
-            outputIm[0]      = 0;
+            outputRe[half_N * ostride0] = scale * (input[0].x - input[0].y);
+            outputIm[half_N * ostride0] = 0;
+            outputRe[0]                 = scale * (input[0].x + input[0].y);
+            outputIm[0]                 = 0;
 
             if(Ndiv4)
             {
-                outputRe[quarter_N] = input[quarter_N].x;
-                outputIm[quarter_N] = -input[quarter_N].y;
+                outputRe[quarter_N * ostride0] = scale * input[quarter_N * istride0].x;
+                outputIm[quarter_N * ostride0] = -scale * input[quarter_N * istride0].y;
             }
         }
         else
         {
-            const Tcomplex p = input[idx_p];
-            const Tcomplex q = input[idx_q];
-            const Tcomplex u = 0.5 * (p + q);
-            const Tcomplex v = 0.5 * (p - q);
+            const Tcomplex p = input[idx_p * istride0];
+            const Tcomplex q = input[idx_q * istride0];
+            const Tcomplex u = (0.5 * scale) * (p + q);
+            const Tcomplex v = (0.5 * scale) * (p - q);
 
             const Tcomplex twd_p = twiddles[idx_p];
             // NB: twd_q = -conj(twd_p) = (-twd_p.x, twd_p.y);
 
-            outputRe[idx_p] = u.x + v.x * twd_p.y + u.y * twd_p.x;
-            outputIm[idx_p] = v.y + u.y * twd_p.y - v.x * twd_p.x;
+            outputRe[idx_p * ostride0] = u.x + v.x * twd_p.y + u.y * twd_p.x;
+            outputIm[idx_p * ostride0] = v.y + u.y * twd_p.y - v.x * twd_p.x;
 
-            outputRe[idx_q] = u.x - v.x * twd_p.y - u.y * twd_p.x;
-            outputIm[idx_q] = -v.y + u.y * twd_p.y - v.x * twd_p.x;
+            outputRe[idx_q * ostride0] = u.x - v.x * twd_p.y - u.y * twd_p.x;
+            outputIm[idx_q * ostride0] = -v.y + u.y * twd_p.y - v.x * twd_p.x;
         }
     }
 }
@@ -152,14 +158,17 @@ __global__ static void real_post_process_kernel(const size_t           half_N,
 // Each thread handles 2 points.
 // When N is divisible by 4, one value is handled separately; this is controlled by Ndiv4.
 template <typename Tcomplex, bool Ndiv4>
-__global__ static void real_pre_process_kernel(const size_t    half_N,
-                                               const size_t    idist1D,
-                                               const size_t    odist1D,
-                                               const Tcomplex* input0,
-                                               const size_t    idist,
-                                               Tcomplex*       output0,
-                                               const size_t    odist,
-                                               Tcomplex const* twiddles)
+__global__ static void real_pre_process_kernel(const size_t                half_N,
+                                               const size_t                idist1D,
+                                               const size_t                odist1D,
+                                               const size_t                istride0,
+                                               const size_t                ostride0,
+                                               const Tcomplex*             input0,
+                                               const size_t                idist,
+                                               Tcomplex*                   output0,
+                                               const size_t                odist,
+                                               Tcomplex const*             twiddles,
+                                               const real_type_t<Tcomplex> scale)
 {
     const size_t idx_p = blockIdx.x * blockDim.x + threadIdx.x;
     const size_t idx_q = half_N - idx_p;
@@ -180,48 +189,51 @@ __global__ static void real_pre_process_kernel(const size_t    half_N,
             // NB: multi-dimensional transforms may have non-zero
             // imaginary part at index 0 or at the Nyquist frequency.
 
-            const Tcomplex p = input[idx_p];
-            const Tcomplex q = input[idx_q];
-            output[idx_p].x  = p.x - p.y + q.x + q.y;
-            output[idx_p].y  = p.x + p.y - q.x + q.y;
+            const Tcomplex p           = input[idx_p * istride0];
+            const Tcomplex q           = input[idx_q * istride0];
+            output[idx_p * ostride0].x = scale * (p.x - p.y + q.x + q.y);
+            output[idx_p * ostride0].y = scale * (p.x + p.y - q.x + q.y);
 
             if(Ndiv4)
             {
-                output[quarter_N].x = 2.0 * input[quarter_N].x;
-                output[quarter_N].y = -2.0 * input[quarter_N].y;
+                output[quarter_N * ostride0].x = 2.0 * scale * input[quarter_N * istride0].x;
+                output[quarter_N * ostride0].y = -2.0 * scale * input[quarter_N * istride0].y;
             }
         }
         else
         {
-            const Tcomplex p = input[idx_p];
-            const Tcomplex q = input[idx_q];
+            const Tcomplex p = input[idx_p * istride0];
+            const Tcomplex q = input[idx_q * istride0];
 
-            const Tcomplex u = p + q;
-            const Tcomplex v = p - q;
+            const Tcomplex u = scale * (p + q);
+            const Tcomplex v = scale * (p - q);
 
             const Tcomplex twd_p = twiddles[idx_p];
             // NB: twd_q = -conj(twd_p);
 
-            output[idx_p].x = u.x + v.x * twd_p.y - u.y * twd_p.x;
-            output[idx_p].y = v.y + u.y * twd_p.y + v.x * twd_p.x;
+            output[idx_p * ostride0].x = u.x + v.x * twd_p.y - u.y * twd_p.x;
+            output[idx_p * ostride0].y = v.y + u.y * twd_p.y + v.x * twd_p.x;
 
-            output[idx_q].x = u.x - v.x * twd_p.y + u.y * twd_p.x;
-            output[idx_q].y = -v.y + u.y * twd_p.y + v.x * twd_p.x;
+            output[idx_q * ostride0].x = u.x - v.x * twd_p.y + u.y * twd_p.x;
+            output[idx_q * ostride0].y = -v.y + u.y * twd_p.y + v.x * twd_p.x;
         }
     }
 }
 
 // Overloaded version of the above for planar format
 template <typename Tcomplex, bool Ndiv4>
-__global__ static void real_pre_process_kernel(const size_t           half_N,
-                                               const size_t           idist1D,
-                                               const size_t           odist1D,
-                                               real_type_t<Tcomplex>* input0Re,
-                                               real_type_t<Tcomplex>* input0Im,
-                                               const size_t           idist,
-                                               Tcomplex*              output0,
-                                               const size_t           odist,
-                                               const Tcomplex* const  twiddles)
+__global__ static void real_pre_process_kernel(const size_t                half_N,
+                                               const size_t                idist1D,
+                                               const size_t                odist1D,
+                                               const size_t                istride0,
+                                               const size_t                ostride0,
+                                               real_type_t<Tcomplex>*      input0Re,
+                                               real_type_t<Tcomplex>*      input0Im,
+                                               const size_t                idist,
+                                               Tcomplex*                   output0,
+                                               const size_t                odist,
+                                               const Tcomplex* const       twiddles,
+                                               const real_type_t<Tcomplex> scale)
 {
     const size_t idx_p = blockIdx.x * blockDim.x + threadIdx.x;
     const size_t idx_q = half_N - idx_p;
@@ -244,55 +256,58 @@ __global__ static void real_pre_process_kernel(const size_t           half_N,
             // imaginary part at index 0 or at the Nyquist frequency.
 
             Tcomplex p, q;
-            p.x             = inputRe[idx_p];
-            p.y             = inputIm[idx_p];
-            q.x             = inputRe[idx_q];
-            q.y             = inputIm[idx_q];
-            output[idx_p].x = p.x - p.y + q.x + q.y;
-            output[idx_p].y = p.x + p.y - q.x + q.y;
+            p.x                        = inputRe[idx_p * istride0];
+            p.y                        = inputIm[idx_p * istride0];
+            q.x                        = inputRe[idx_q * istride0];
+            q.y                        = inputIm[idx_q * istride0];
+            output[idx_p * ostride0].x = scale * (p.x - p.y + q.x + q.y);
+            output[idx_p * ostride0].y = scale * (p.x + p.y - q.x + q.y);
 
             if(Ndiv4)
             {
-                output[quarter_N].x = 2.0 * inputRe[quarter_N];
-                output[quarter_N].y = -2.0 * inputIm[quarter_N];
+                output[quarter_N * ostride0].x = 2.0 * scale * inputRe[quarter_N * istride0];
+                output[quarter_N * ostride0].y = -2.0 * scale * inputIm[quarter_N * istride0];
             }
         }
         else
         {
             Tcomplex p, q;
-            p.x = inputRe[idx_p];
-            p.y = inputIm[idx_p];
-            q.x = inputRe[idx_q];
-            q.y = inputIm[idx_q];
+            p.x = inputRe[idx_p * istride0];
+            p.y = inputIm[idx_p * istride0];
+            q.x = inputRe[idx_q * istride0];
+            q.y = inputIm[idx_q * istride0];
 
-            const Tcomplex u = p + q;
-            const Tcomplex v = p - q;
+            const Tcomplex u = scale * (p + q);
+            const Tcomplex v = scale * (p - q);
 
             const Tcomplex twd_p = twiddles[idx_p];
             // NB: twd_q = -conj(twd_p);
 
-            output[idx_p].x = u.x + v.x * twd_p.y - u.y * twd_p.x;
-            output[idx_p].y = v.y + u.y * twd_p.y + v.x * twd_p.x;
+            output[idx_p * ostride0].x = u.x + v.x * twd_p.y - u.y * twd_p.x;
+            output[idx_p * ostride0].y = v.y + u.y * twd_p.y + v.x * twd_p.x;
 
-            output[idx_q].x = u.x - v.x * twd_p.y + u.y * twd_p.x;
-            output[idx_q].y = -v.y + u.y * twd_p.y + v.x * twd_p.x;
+            output[idx_q * ostride0].x = u.x - v.x * twd_p.y + u.y * twd_p.x;
+            output[idx_q * ostride0].y = -v.y + u.y * twd_p.y + v.x * twd_p.x;
         }
     }
 }
 
 // GPU intermediate host code
 template <typename Tcomplex, bool R2C>
-static void real_1d_pre_post_process(const size_t half_N,
-                                     const size_t batch,
-                                     Tcomplex*    d_input,
-                                     Tcomplex*    d_output,
-                                     Tcomplex*    d_twiddles,
-                                     const size_t high_dimension,
-                                     const size_t istride,
-                                     const size_t ostride,
-                                     const size_t idist,
-                                     const size_t odist,
-                                     hipStream_t  rocfft_stream)
+static void real_1d_pre_post_process(const size_t                half_N,
+                                     const size_t                batch,
+                                     Tcomplex*                   d_input,
+                                     Tcomplex*                   d_output,
+                                     Tcomplex*                   d_twiddles,
+                                     const size_t                high_dimension,
+                                     const size_t                istride,
+                                     const size_t                ostride,
+                                     const size_t                istride0,
+                                     const size_t                ostride0,
+                                     const size_t                idist,
+                                     const size_t                odist,
+                                     const real_type_t<Tcomplex> scale,
+                                     hipStream_t                 rocfft_stream)
 {
     const size_t block_size = 512;
     size_t       blocks     = ((half_N + 1) / 2 + block_size - 1) / block_size;
@@ -327,11 +342,14 @@ static void real_1d_pre_post_process(const size_t half_N,
                                half_N,
                                idist1D,
                                odist1D,
+                               istride0,
+                               ostride0,
                                d_input,
                                idist,
                                d_output,
                                odist,
-                               d_twiddles);
+                               d_twiddles,
+                               scale);
         else
             hipLaunchKernelGGL((real_post_process_kernel<Tcomplex, false>),
                                grid,
@@ -341,11 +359,14 @@ static void real_1d_pre_post_process(const size_t half_N,
                                half_N,
                                idist1D,
                                odist1D,
+                               istride0,
+                               ostride0,
                                d_input,
                                idist,
                                d_output,
                                odist,
-                               d_twiddles);
+                               d_twiddles,
+                               scale);
     }
     else
     {
@@ -358,11 +379,14 @@ static void real_1d_pre_post_process(const size_t half_N,
                                half_N,
                                idist1D,
                                odist1D,
+                               istride0,
+                               ostride0,
                                d_input,
                                idist,
                                d_output,
                                odist,
-                               d_twiddles);
+                               d_twiddles,
+                               scale);
         else
             hipLaunchKernelGGL((real_pre_process_kernel<Tcomplex, false>),
                                grid,
@@ -372,11 +396,14 @@ static void real_1d_pre_post_process(const size_t half_N,
                                half_N,
                                idist1D,
                                odist1D,
+                               istride0,
+                               ostride0,
                                d_input,
                                idist,
                                d_output,
                                odist,
-                               d_twiddles);
+                               d_twiddles,
+                               scale);
     }
 }
 
@@ -384,18 +411,21 @@ static void real_1d_pre_post_process(const size_t half_N,
 // For R2C, d_real is the input, d_complexRe and d_complexIm are outputs.
 // For C2R, d_complexRe and d_complexIm are inputs, and d_real is output.
 template <typename Tcomplex, bool R2C>
-static void real_1d_pre_post_process(const size_t           half_N,
-                                     const size_t           batch,
-                                     Tcomplex*              d_real,
-                                     real_type_t<Tcomplex>* d_complexRe,
-                                     real_type_t<Tcomplex>* d_complexIm,
-                                     Tcomplex*              d_twiddles,
-                                     const size_t           high_dimension,
-                                     const size_t           istride,
-                                     const size_t           ostride,
-                                     const size_t           idist,
-                                     const size_t           odist,
-                                     hipStream_t            rocfft_stream)
+static void real_1d_pre_post_process(const size_t                half_N,
+                                     const size_t                batch,
+                                     Tcomplex*                   d_real,
+                                     real_type_t<Tcomplex>*      d_complexRe,
+                                     real_type_t<Tcomplex>*      d_complexIm,
+                                     Tcomplex*                   d_twiddles,
+                                     const size_t                high_dimension,
+                                     const size_t                istride,
+                                     const size_t                ostride,
+                                     const size_t                istride0,
+                                     const size_t                ostride0,
+                                     const size_t                idist,
+                                     const size_t                odist,
+                                     const real_type_t<Tcomplex> scale,
+                                     hipStream_t                 rocfft_stream)
 {
     const size_t block_size = 512;
     size_t       blocks     = ((half_N + 1) / 2 + block_size - 1) / block_size;
@@ -430,12 +460,15 @@ static void real_1d_pre_post_process(const size_t           half_N,
                                half_N,
                                idist1D,
                                odist1D,
+                               istride0,
+                               ostride0,
                                d_real,
                                idist,
                                d_complexRe,
                                d_complexIm,
                                odist,
-                               d_twiddles);
+                               d_twiddles,
+                               scale);
         else
             hipLaunchKernelGGL((real_post_process_kernel<Tcomplex, false>),
                                grid,
@@ -445,12 +478,15 @@ static void real_1d_pre_post_process(const size_t           half_N,
                                half_N,
                                idist1D,
                                odist1D,
+                               istride0,
+                               ostride0,
                                d_real,
                                idist,
                                d_complexRe,
                                d_complexIm,
                                odist,
-                               d_twiddles);
+                               d_twiddles,
+                               scale);
     }
     else
     {
@@ -463,12 +499,15 @@ static void real_1d_pre_post_process(const size_t           half_N,
                                half_N,
                                idist1D,
                                odist1D,
+                               istride0,
+                               ostride0,
                                d_complexRe,
                                d_complexIm,
                                idist,
                                d_real,
                                odist,
-                               d_twiddles);
+                               d_twiddles,
+                               scale);
         else
             hipLaunchKernelGGL((real_pre_process_kernel<Tcomplex, false>),
                                grid,
@@ -478,12 +517,15 @@ static void real_1d_pre_post_process(const size_t           half_N,
                                half_N,
                                idist1D,
                                odist1D,
+                               istride0,
+                               ostride0,
                                d_complexRe,
                                d_complexIm,
                                idist,
                                d_real,
                                odist,
-                               d_twiddles);
+                               d_twiddles,
+                               scale);
     }
 }
 
@@ -498,8 +540,11 @@ static void real_1d_pre_post_process(const size_t           half_N,
                                              high_dimension,                     \
                                              istride,                            \
                                              ostride,                            \
+                                             data->node->inStride[0],            \
+                                             data->node->outStride[0],           \
                                              idist,                              \
                                              odist,                              \
+                                             data->node->scale,                  \
                                              data->rocfft_stream)
 
 #define RUN_REAL_1D_PRE_POST_PLANAR(                                             \
@@ -513,8 +558,11 @@ static void real_1d_pre_post_process(const size_t           half_N,
                                              high_dimension,                     \
                                              istride,                            \
                                              ostride,                            \
+                                             data->node->inStride[0],            \
+                                             data->node->outStride[0],           \
                                              idist,                              \
                                              odist,                              \
+                                             data->node->scale,                  \
                                              data->rocfft_stream)
 
 template <bool R2C>
@@ -534,7 +582,7 @@ static void real_1d_pre_post(const void* data_p, void* back_p)
     void* bufIn1  = data->bufIn[1];
     void* bufOut1 = data->bufOut[1];
 
-    size_t batch = data->node->batch;
+    size_t batch = data->batch;
 
     const size_t high_dimension = std::accumulate(
         data->node->length.begin() + 1, data->node->length.end(), 1, std::multiplies<size_t>());
@@ -585,3 +633,115 @@ void c2r_1d_pre(const void* data_p, void* back_p)
 {
     real_1d_pre_post<false>(data_p, back_p);
 }
+
+// GPU kernel to pack strided real data into a contiguous complex array of
+// half the length (R2C), or to unpack it (C2R).  Each thread handles one
+// pair of real values.
+template <typename Tcomplex, bool R2C>
+__global__ static void real_pack_kernel(const size_t                half_N,
+                                        const size_t                idist1D,
+                                        const size_t                odist1D,
+                                        const size_t                istride0,
+                                        const size_t                ostride0,
+                                        real_type_t<Tcomplex>*      real0,
+                                        Tcomplex*                   complex0,
+                                        const size_t                idist,
+                                        const size_t                odist,
+                                        const real_type_t<Tcomplex> scale)
+{
+    const size_t idx = blockIdx.x * blockDim.x + threadIdx.x;
+
+    if(idx < half_N)
+    {
+        // blockIdx.y gives the multi-dimensional offset, stride is [i/o]dist1D.
+        // blockIdx.z gives the batch offset, stride is [i/o]dist.
+        const size_t ioffset = idist1D * blockIdx.y + idist * blockIdx.z;
+        const size_t ooffset = odist1D * blockIdx.y + odist * blockIdx.z;
+
+        if(R2C)
+        {
+            complex0[ooffset + idx * ostride0].x = scale * real0[ioffset + 2 * idx * istride0];
+            complex0[ooffset + idx * ostride0].y
+                = scale * real0[ioffset + (2 * idx + 1) * istride0];
+        }
+        else
+        {
+            const Tcomplex val = complex0[ioffset + idx * istride0];
+
+            real0[ooffset + 2 * idx * ostride0]       = scale * val.x;
+            real0[ooffset + (2 * idx + 1) * ostride0] = scale * val.y;
+        }
+    }
+}
+
+template <bool R2C>
+static void real_1d_pack(const void* data_p, void* back_p)
+{
+    DeviceCallIn* data = (DeviceCallIn*)data_p;
+
+    // the upper level provides N/2, the length of the complex transform
+    const size_t half_N = data->node->length[0];
+
+    const size_t idist = data->node->iDist;
+    const size_t odist = data->node->oDist;
+
+    const size_t batch = data->batch;
+
+    const size_t high_dimension = std::accumulate(
+        data->node->length.begin() + 1, data->node->length.end(), 1, std::multiplies<size_t>());
+    // Strides are actually distances between contiguous data vectors.
+    const size_t idist1D = high_dimension > 1 ? data->node->inStride[1] : 0;
+    const size_t odist1D = high_dimension > 1 ? data->node->outStride[1] : 0;
+
+    const size_t block_size = 512;
+    const size_t blocks     = (half_N + block_size - 1) / block_size;
+
+    dim3 grid(blocks, high_dimension, batch);
+    dim3 threads(block_size, 1, 1);
+
+    void* real    = R2C ? data->bufIn[0] : data->bufOut[0];
+    void* complex = R2C ? data->bufOut[0] : data->bufIn[0];
+
+    if(data->node->precision == rocfft_precision_single)
+        hipLaunchKernelGGL((real_pack_kernel<float2, R2C>),
+                           grid,
+                           threads,
+                           0,
+                           data->rocfft_stream,
+                           half_N,
+                           idist1D,
+                           odist1D,
+                           data->node->inStride[0],
+                           data->node->outStride[0],
+                           (float*)real,
+                           (float2*)complex,
+                           idist,
+                           odist,
+                           (float)data->node->scale);
+    else
+        hipLaunchKernelGGL((real_pack_kernel<double2, R2C>),
+                           grid,
+                           threads,
+                           0,
+                           data->rocfft_stream,
+                           half_N,
+                           idist1D,
+                           odist1D,
+                           data->node->inStride[0],
+                           data->node->outStride[0],
+                           (double*)real,
+                           (double2*)complex,
+                           idist,
+                           odist,
+                           (double)data->node->scale);
+}
+
+void r2c_1d_pack(const void* data_p, void* back_p)
+{
+    real_1d_pack<true>(data_p, back_p);
+}
+
+void c2r_1d_unpack(const void* data_p, void* back_p)
+{
+    real_1d_pack<false>(data_p, back_p);
+}
@@ -32,21 +32,25 @@
 /// @param[in]    A pointer storing batch_count of A matrix on the GPU.
 /// @param[inout] B pointer storing batch_count of B matrix on the GPU.
 /// @param[in]    count size_t number of matrices processed
+/// @param[in]    scale factor the stored elements are multiplied by
 template <typename T, typename TA, typename TB, int TRANSPOSE_DIM_X, int TRANSPOSE_DIM_Y>
-rocfft_status rocfft_transpose_outofplace_template(size_t      m,
-                                                   size_t      n,
-                                                   const TA*   A,
-                                                   TB*         B,
-                                                   void*       twiddles_large,
-                                                   size_t      count,
-                                                   size_t      dim,
-                                                   size_t*     lengths,
-                                                   size_t*     stride_in,
-                                                   size_t*     stride_out,
-                                                   int         twl,
-                                                   int         dir,
-                                                   int         scheme,
-                                                   hipStream_t rocfft_stream)
+rocfft_status rocfft_transpose_outofplace_template(size_t               m,
+                                                   size_t               n,
+                                                   const TA*            A,
+                                                   TB*                  B,
+                                                   void*                twiddles_large,
+                                                   size_t               count,
+                                                   size_t               dim,
+                                                   size_t*              lengths,
+                                                   size_t*              stride_in,
+                                                   size_t*              stride_out,
+                                                   int                  twl,
+                                                   int                  dir,
+                                                   int                  scheme,
+                                                   const size_t*        pfaIn,
+                                                   const size_t*        pfaOut,
+                                                   const real_type_t<T> scale,
+                                                   hipStream_t          rocfft_stream)
 {
 
     dim3 grid((n - 1) / TRANSPOSE_DIM_X + 1, ((m - 1) / TRANSPOSE_DIM_X + 1), count);
@@ -55,7 +59,28 @@ rocfft_status rocfft_transpose_outofplace_template(size_t      m,
     // working threads match problem sizes, no corner cases
     const bool noCorner = (n % TRANSPOSE_DIM_X == 0) && (m % TRANSPOSE_DIM_X == 0);
 
-    if(scheme == 0)
+    if(pfaIn[0] != 0)
+    {
+        // Good-Thomas transpose of a CS_L1D_PFA plan, no twiddles
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(transpose_kernel2_pfa<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y>),
+            dim3(grid),
+            dim3(threads),
+            0,
+            rocfft_stream,
+            A,
+            B,
+            dim,
+            lengths,
+            stride_in,
+            stride_out,
+            pfaIn[0],
+            pfaIn[1],
+            pfaOut[0],
+            pfaOut[1],
+            scale);
+    }
+    else if(scheme == 0)
     {
         // Create a map from the parameters to the templated function:
         std::map<
@@ -178,7 +203,8 @@ rocfft_status rocfft_transpose_outofplace_template(size_t      m,
                                dim,
                                lengths,
                                stride_in,
-                               stride_out);
+                               stride_out,
+                               scale);
         }
         catch(std::exception& e)
         {
@@ -207,7 +233,8 @@ rocfft_status rocfft_transpose_outofplace_template(size_t      m,
                 lengths,
                 stride_in,
                 stride_out,
-                scheme);
+                scheme,
+                scale);
         }
         else
         {
@@ -225,7 +252,8 @@ rocfft_status rocfft_transpose_outofplace_template(size_t      m,
                 lengths,
                 stride_in,
                 stride_out,
-                scheme);
+                scheme,
+                scale);
         }
     }
 
@@ -278,7 +306,7 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p)
 
     int dir = data->node->direction;
 
-    size_t count = data->node->batch;
+    size_t count = data->batch;
 
     size_t extraDimStart = 2;
     if(scheme != 0)
@@ -325,6 +353,9 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p)
                 twl,
                 dir,
                 scheme,
+                data->node->pfaIn,
+                data->node->pfaOut,
+                data->node->scale,
                 rocfft_stream);
 
             hipFree(d_in_planar);
@@ -357,6 +388,9 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p)
                 twl,
                 dir,
                 scheme,
+                data->node->pfaIn,
+                data->node->pfaOut,
+                data->node->scale,
                 rocfft_stream);
 
             hipFree(d_in_planar);
@@ -395,6 +429,9 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p)
                 twl,
                 dir,
                 scheme,
+                data->node->pfaIn,
+                data->node->pfaOut,
+                data->node->scale,
                 rocfft_stream);
 
             hipFree(d_out_planar);
@@ -428,6 +465,9 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p)
                 twl,
                 dir,
                 scheme,
+                data->node->pfaIn,
+                data->node->pfaOut,
+                data->node->scale,
                 rocfft_stream);
 
             hipFree(d_out_planar);
@@ -473,6 +513,9 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p)
                 twl,
                 dir,
                 scheme,
+                data->node->pfaIn,
+                data->node->pfaOut,
+                data->node->scale,
                 rocfft_stream);
 
             hipFree(d_in_planar);
@@ -514,6 +557,9 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p)
                 twl,
                 dir,
                 scheme,
+                data->node->pfaIn,
+                data->node->pfaOut,
+                data->node->scale,
                 rocfft_stream);
 
             hipFree(d_in_planar);
@@ -542,6 +588,9 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p)
                 twl,
                 dir,
                 scheme,
+                data->node->pfaIn,
+                data->node->pfaOut,
+                data->node->scale,
                 rocfft_stream);
         else
             rocfft_transpose_outofplace_template<cmplx_double, cmplx_double, cmplx_double, 32, 32>(
@@ -558,6 +607,90 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p)
                 twl,
                 dir,
                 scheme,
+                data->node->pfaIn,
+                data->node->pfaOut,
+                data->node->scale,
                 rocfft_stream);
     }
 }
+
+void rocfft_internal_transpose_inplace(const void* data_p, void* back_p)
+{
+    DeviceCallIn* data = (DeviceCallIn*)data_p;
+
+    // The matrices are contiguous, length[0] columns by length[1] rows.
+    const size_t cols  = data->node->length[0];
+    const size_t rows  = data->node->length[1];
+    const size_t N     = cols * rows;
+    size_t       count = data->batch;
+    for(size_t i = 2; i < data->node->length.size(); i++)
+        count *= data->node->length[i];
+
+    assert(data->node->inStride[1] == cols);
+    assert(data->node->outStride[1] == rows);
+    assert(data->node->inArrayType == rocfft_array_type_complex_interleaved);
+    assert(data->bufIn[0] == data->bufOut[0]);
+
+    hipStream_t rocfft_stream = data->rocfft_stream;
+
+    // a single element is only scaled
+    if(N == 0 || (N == 1 && data->node->scale == 1.0))
+        return;
+
+    if(cols == rows)
+    {
+        // double2 tiles of 32 x 32 fit twice in LDS
+        const size_t dim = cols;
+        dim3         grid((dim - 1) / 32 + 1, (dim - 1) / 32 + 1, count);
+        dim3         threads(32, 8, 1);
+
+        if(data->node->precision == rocfft_precision_single)
+            hipLaunchKernelGGL(HIP_KERNEL_NAME(transpose_inplace_square_kernel<float2, 32, 8>),
+                               grid,
+                               threads,
+                               0,
+                               rocfft_stream,
+                               (float2*)data->bufOut[0],
+                               dim,
+                               N,
+                               (float)data->node->scale);
+        else
+            hipLaunchKernelGGL(HIP_KERNEL_NAME(transpose_inplace_square_kernel<double2, 32, 8>),
+                               grid,
+                               threads,
+                               0,
+                               rocfft_stream,
+                               (double2*)data->bufOut[0],
+                               dim,
+                               N,
+                               (double)data->node->scale);
+    }
+    else
+    {
+        dim3 grid((N - 1) / 256 + 1, 1, count);
+        dim3 threads(256, 1, 1);
+
+        if(data->node->precision == rocfft_precision_single)
+            hipLaunchKernelGGL(HIP_KERNEL_NAME(transpose_inplace_cycle_kernel<float2>),
+                               grid,
+                               threads,
+                               0,
+                               rocfft_stream,
+                               (float2*)data->bufOut[0],
+                               rows,
+                               N,
+                               N,
+                               (float)data->node->scale);
+        else
+            hipLaunchKernelGGL(HIP_KERNEL_NAME(transpose_inplace_cycle_kernel<double2>),
+                               grid,
+                               threads,
+                               0,
+                               rocfft_stream,
+                               (double2*)data->bufOut[0],
+                               rows,
+                               N,
+                               N,
+                               (double)data->node->scale);
+    }
+}
@@ -0,0 +1,723 @@
+/******************************************************************************
+* Copyright (c) 2016 - present Advanced Micro Devices, Inc. All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*******************************************************************************/
+
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <complex>
+#include <cstring>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+
+#include "distributed.h"
+#include "logging.h"
+#include "plan.h"
+#include "rocfft.h"
+#include "transform.h"
+
+// Transport forwarding exchanges to a user function
+class CallbackTransport : public rocfft_transport_t
+{
+public:
+    CallbackTransport(size_t                         rank,
+                      size_t                         numRanks,
+                      rocfft_transport_exchange_func func,
+                      void*                          context)
+        : rocfft_transport_t(rank, numRanks)
+        , func(func)
+        , context(context)
+    {
+    }
+
+    rocfft_status Exchange(const std::vector<size_t>& group,
+                           const void*                send,
+                           void*                      recv,
+                           size_t                     bytesPerRank) override
+    {
+        return func(context, group.data(), group.size(), send, recv, bytesPerRank);
+    }
+
+private:
+    rocfft_transport_exchange_func func;
+    void*                          context;
+};
+
+// Transport between processes of one host.  The shared memory segment holds
+// a process-shared barrier and a mailbox for each (destination, source) pair
+// of ranks.  Every exchange is done in mailbox-sized pieces, each one written
+// by the senders and read by the receivers between two barriers, so all
+// ranks of the transport have to exchange the same number of bytes at the
+// same time, as the groups of a distributed plan do.
+class ShmTransport : public rocfft_transport_t
+{
+public:
+    ShmTransport(size_t rank, size_t numRanks, size_t slotSize)
+        : rocfft_transport_t(rank, numRanks)
+        , slotSize(slotSize)
+        , segmentSize(headerBytes + numRanks * numRanks * slotSize)
+    {
+    }
+
+    ~ShmTransport() override
+    {
+        // every Exchange ends with a barrier after the reads, so no peer is
+        // still reading our mailboxes and there is nothing to wait for
+        if(header != nullptr)
+            munmap(header, segmentSize);
+    }
+
+    // Create (rank 0) or open the segment and wait for all ranks to attach
+    rocfft_status Attach(const char* name)
+    {
+        int fd = -1;
+        if(rank == 0)
+        {
+            shm_unlink(name);
+            fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600);
+            if(fd < 0)
+                return rocfft_status_failure;
+            if(ftruncate(fd, segmentSize) != 0)
+            {
+                close(fd);
+                shm_unlink(name);
+                return rocfft_status_failure;
+            }
+        }
+        else
+        {
+            // wait for rank 0 to create the segment and set its size
+            const auto deadline = std::chrono::steady_clock::now() + attachTimeout;
+            while(true)
+            {
+                fd = shm_open(name, O_RDWR, 0);
+                struct stat st;
+                if(fd >= 0 && fstat(fd, &st) == 0 && size_t(st.st_size) == segmentSize)
+                    break;
+                if(fd >= 0)
+                    close(fd);
+                if(std::chrono::steady_clock::now() > deadline)
+                    return rocfft_status_failure;
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+
+        void* mem = mmap(nullptr, segmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+        if(mem == MAP_FAILED)
+        {
+            if(rank == 0)
+                shm_unlink(name);
+            return rocfft_status_failure;
+        }
+
+        Header* h = static_cast<Header*>(mem);
+        if(rank == 0)
+        {
+            pthread_barrierattr_t attr;
+            pthread_barrierattr_init(&attr);
+            pthread_barrierattr_setpshared(&attr, PTHREAD_PROCESS_SHARED);
+            pthread_barrier_init(&h->barrier, &attr, numRanks);
+            pthread_barrierattr_destroy(&attr);
+            h->ready.store(readyMagic, std::memory_order_release);
+        }
+        else
+        {
+            const auto deadline = std::chrono::steady_clock::now() + attachTimeout;
+            while(h->ready.load(std::memory_order_acquire) != readyMagic)
+            {
+                if(std::chrono::steady_clock::now() > deadline)
+                {
+                    munmap(mem, segmentSize);
+                    return rocfft_status_failure;
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+        header = h;
+
+        // everyone is mapped, the name is no longer needed
+        Barrier();
+        if(rank == 0)
+            shm_unlink(name);
+        return rocfft_status_success;
+    }
+
+    rocfft_status Exchange(const std::vector<size_t>& group,
+                           const void*                send,
+                           void*                      recv,
+                           size_t                     bytesPerRank) override
+    {
+        const char* sendBytes = static_cast<const char*>(send);
+        char*       recvBytes = static_cast<char*>(recv);
+        for(size_t offset = 0; offset < bytesPerRank; offset += slotSize)
+        {
+            const size_t piece = std::min(slotSize, bytesPerRank - offset);
+            for(size_t i = 0; i < group.size(); ++i)
+                memcpy(Slot(group[i], rank), sendBytes + i * bytesPerRank + offset, piece);
+            Barrier();
+            for(size_t i = 0; i < group.size(); ++i)
+                memcpy(recvBytes + i * bytesPerRank + offset, Slot(rank, group[i]), piece);
+            Barrier();
+        }
+        return rocfft_status_success;
+    }
+
+private:
+    struct Header
+    {
+        pthread_barrier_t   barrier;
+        std::atomic<size_t> ready;
+    };
+
+    static const size_t headerBytes = 4096;
+    static const size_t readyMagic  = 0x726f63666674; // "rocfft"
+    static constexpr std::chrono::seconds attachTimeout{60};
+
+    static_assert(sizeof(Header) <= headerBytes, "shared memory header too large");
+
+    size_t  slotSize;
+    size_t  segmentSize;
+    Header* header = nullptr;
+
+    char* Slot(size_t dst, size_t src)
+    {
+        return reinterpret_cast<char*>(header) + headerBytes
+               + (dst * numRanks + src) * slotSize;
+    }
+
+    void Barrier()
+    {
+        pthread_barrier_wait(&header->barrier);
+    }
+};
+
+constexpr std::chrono::seconds ShmTransport::attachTimeout;
+
+rocfft_status rocfft_transport_create(rocfft_transport*              transport,
+                                      size_t                         rank,
+                                      size_t                         number_of_ranks,
+                                      rocfft_transport_exchange_func exchange,
+                                      void*                          context)
+{
+    log_trace(__func__,
+              "rank",
+              rank,
+              "number_of_ranks",
+              number_of_ranks,
+              "exchange",
+              (void*)exchange,
+              "context",
+              context);
+    if(transport == nullptr || exchange == nullptr || rank >= number_of_ranks)
+        return rocfft_status_invalid_arg_value;
+
+    *transport = new CallbackTransport(rank, number_of_ranks, exchange, context);
+    return rocfft_status_success;
+}
+
+rocfft_status rocfft_transport_create_shared_memory(rocfft_transport* transport,
+                                                    const char*       name,
+                                                    size_t            rank,
+                                                    size_t            number_of_ranks,
+                                                    size_t            buffer_size)
+{
+    log_trace(__func__,
+              "name",
+              name,
+              "rank",
+              rank,
+              "number_of_ranks",
+              number_of_ranks,
+              "buffer_size",
+              buffer_size);
+    if(transport == nullptr || name == nullptr || rank >= number_of_ranks)
+        return rocfft_status_invalid_arg_value;
+
+    if(buffer_size == 0)
+        buffer_size = 1 << 20;
+    ShmTransport* shm = new ShmTransport(rank, number_of_ranks, buffer_size);
+
+    rocfft_status status = shm->Attach(name);
+    if(status != rocfft_status_success)
+    {
+        delete shm;
+        return status;
+    }
+    *transport = shm;
+    return rocfft_status_success;
+}
+
+rocfft_status rocfft_transport_destroy(rocfft_transport transport)
+{
+    log_trace(__func__, "transport", transport);
+    if(transport != nullptr)
+        delete transport;
+    return rocfft_status_success;
+}
+
+size_t DistBrick::Stride(size_t dim) const
+{
+    size_t stride = 1;
+    for(size_t i = 0; order[i] != dim; ++i)
+        stride *= count[order[i]];
+    return stride;
+}
+
+// Brick of rank r at a stage of a decomposition, p0 x p1 being the process
+// grid of pencils
+static DistBrick DecomposedBrick(const std::array<size_t, 3>& lengths,
+                                 rocfft_decomposition         decomposition,
+                                 size_t                       p0,
+                                 size_t                       p1,
+                                 size_t                       r,
+                                 size_t                       stage)
+{
+    DistBrick brick;
+    brick.start = {0, 0, 0};
+    brick.count = lengths;
+
+    auto split = [&](size_t dim, size_t parts, size_t part) {
+        brick.count[dim] = lengths[dim] / parts;
+        brick.start[dim] = part * brick.count[dim];
+    };
+
+    if(decomposition == rocfft_decomposition_slab)
+    {
+        // xy planes, then xz planes with z fastest
+        if(stage == 0)
+        {
+            split(2, p0, r);
+            brick.order = {0, 1, 2};
+        }
+        else
+        {
+            split(1, p0, r);
+            brick.order = {2, 0, 1};
+        }
+        return brick;
+    }
+
+    // x, then y, then z pencils, each stored with the full dimension fastest
+    const size_t r0 = r % p0;
+    const size_t r1 = r / p0;
+    switch(stage)
+    {
+    case 0:
+        split(1, p0, r0);
+        split(2, p1, r1);
+        brick.order = {0, 1, 2};
+        break;
+    case 1:
+        split(0, p0, r0);
+        split(2, p1, r1);
+        brick.order = {1, 0, 2};
+        break;
+    default:
+        split(0, p0, r0);
+        split(1, p1, r1);
+        brick.order = {2, 0, 1};
+        break;
+    }
+    return brick;
+}
+
+// Chunk k of the chunks a brick is cut into along its slowest dimension
+static DistBrick ChunkOf(const DistBrick& brick, size_t k, size_t chunks)
+{
+    DistBrick    chunk = brick;
+    const size_t dim   = brick.order[2];
+    chunk.count[dim]   = brick.count[dim] / chunks;
+    chunk.start[dim] += k * chunk.count[dim];
+    return chunk;
+}
+
+// Common part of two bricks, stored with dimension 0 fastest
+static DistBrick Intersect(const DistBrick& a, const DistBrick& b)
+{
+    DistBrick box;
+    box.order = {0, 1, 2};
+    for(size_t d = 0; d < 3; ++d)
+    {
+        const size_t begin = std::max(a.start[d], b.start[d]);
+        const size_t end   = std::min(a.start[d] + a.count[d], b.start[d] + b.count[d]);
+        box.start[d]       = begin;
+        box.count[d]       = end > begin ? end - begin : 0;
+    }
+    return box;
+}
+
+// Copy the elements of box from a brick to another
+template <typename T>
+static void CopyBox(const DistBrick& box,
+                    const DistBrick& src,
+                    const T*         srcData,
+                    const DistBrick& dst,
+                    T*               dstData)
+{
+    const size_t srcStride[3] = {src.Stride(0), src.Stride(1), src.Stride(2)};
+    const size_t dstStride[3] = {dst.Stride(0), dst.Stride(1), dst.Stride(2)};
+    for(size_t z = box.start[2]; z < box.start[2] + box.count[2]; ++z)
+    {
+        for(size_t y = box.start[1]; y < box.start[1] + box.count[1]; ++y)
+        {
+            const T* s = srcData + (box.start[0] - src.start[0]) * srcStride[0]
+                         + (y - src.start[1]) * srcStride[1] + (z - src.start[2]) * srcStride[2];
+            T* d = dstData + (box.start[0] - dst.start[0]) * dstStride[0]
+                   + (y - dst.start[1]) * dstStride[1] + (z - dst.start[2]) * dstStride[2];
+            for(size_t x = 0; x < box.count[0]; ++x)
+                d[x * dstStride[0]] = s[x * srcStride[0]];
+        }
+    }
+}
+
+static void CopyBox(const DistBrick& box,
+                    const DistBrick& src,
+                    const char*      srcData,
+                    const DistBrick& dst,
+                    char*            dstData,
+                    rocfft_precision precision)
+{
+    if(precision == rocfft_precision_single)
+        CopyBox(box,
+                src,
+                reinterpret_cast<const std::complex<float>*>(srcData),
+                dst,
+                reinterpret_cast<std::complex<float>*>(dstData));
+    else
+        CopyBox(box,
+                src,
+                reinterpret_cast<const std::complex<double>*>(srcData),
+                dst,
+                reinterpret_cast<std::complex<double>*>(dstData));
+}
+
+// Number of pieces an exchange is split into: the largest divisor of the
+// slowest dimension of the brick up to a limit
+static size_t ChunkCount(const DistBrick& brick)
+{
+    const size_t maxChunks = 8;
+    const size_t n         = brick.count[brick.order[2]];
+    for(size_t chunks = std::min(n, maxChunks); chunks > 1; --chunks)
+        if(n % chunks == 0)
+            return chunks;
+    return 1;
+}
+
+rocfft_status rocfft_distributed_plan_create(rocfft_distributed_plan* plan,
+                                             rocfft_transform_type    transform_type,
+                                             rocfft_precision         precision,
+                                             const size_t*            lengths,
+                                             rocfft_decomposition     decomposition,
+                                             const size_t*            grid,
+                                             rocfft_transport         transport)
+{
+    log_trace(__func__,
+              "transform_type",
+              transform_type,
+              "precision",
+              precision,
+              "decomposition",
+              decomposition,
+              "transport",
+              transport);
+    if(plan == nullptr || lengths == nullptr || transport == nullptr)
+        return rocfft_status_invalid_arg_value;
+    if(transform_type != rocfft_transform_type_complex_forward
+       && transform_type != rocfft_transform_type_complex_inverse)
+        return rocfft_status_invalid_arg_value;
+
+    const std::array<size_t, 3> len   = {lengths[0], lengths[1], lengths[2]};
+    const size_t                ranks = transport->numRanks;
+
+    size_t p0 = ranks, p1 = 1, numStages = 2;
+    if(decomposition == rocfft_decomposition_slab)
+    {
+        if(len[1] % ranks != 0 || len[2] % ranks != 0)
+            return rocfft_status_invalid_dimensions;
+    }
+    else
+    {
+        if(grid == nullptr || grid[0] * grid[1] != ranks)
+            return rocfft_status_invalid_arg_value;
+        p0        = grid[0];
+        p1        = grid[1];
+        numStages = 3;
+        if(len[0] % p0 != 0 || len[1] % p0 != 0 || len[1] % p1 != 0 || len[2] % p1 != 0)
+            return rocfft_status_invalid_dimensions;
+    }
+
+    rocfft_distributed_plan p = new rocfft_distributed_plan_t;
+    p->lengths                = len;
+    p->transformType          = transform_type;
+    p->precision              = precision;
+    p->transport              = transport;
+    p->elemSize = 2 * (precision == rocfft_precision_single ? sizeof(float) : sizeof(double));
+
+    const size_t rank = transport->rank;
+    p->stages.resize(numStages);
+    for(size_t s = 0; s < numStages; ++s)
+    {
+        DistStage& stage = p->stages[s];
+        stage.brick      = DecomposedBrick(len, decomposition, p0, p1, rank, s);
+        // slabs transform the two fastest dimensions in the first stage
+        stage.fftDims = (decomposition == rocfft_decomposition_slab && s == 0) ? 2 : 1;
+        const bool last = s + 1 == numStages;
+
+        if(!last)
+        {
+            stage.chunks = ChunkCount(stage.brick);
+
+            // ranks sharing the part of the data that is not redistributed
+            if(decomposition == rocfft_decomposition_slab)
+                for(size_t g = 0; g < ranks; ++g)
+                    stage.group.push_back(g);
+            else if(s == 0)
+                for(size_t i = 0; i < p0; ++i)
+                    stage.group.push_back((rank / p0) * p0 + i);
+            else
+                for(size_t j = 0; j < p1; ++j)
+                    stage.group.push_back(rank % p0 + j * p0);
+
+            for(auto g : stage.group)
+            {
+                stage.groupBricks.push_back(DecomposedBrick(len, decomposition, p0, p1, g, s));
+                stage.nextBricks.push_back(
+                    DecomposedBrick(len, decomposition, p0, p1, g, s + 1));
+            }
+        }
+
+        size_t fftLengths[2] = {stage.brick.count[stage.brick.order[0]],
+                                stage.brick.count[stage.brick.order[1]]};
+        const size_t fftSize = stage.fftDims == 2 ? fftLengths[0] * fftLengths[1] : fftLengths[0];
+        const size_t batch   = stage.brick.Size() / stage.chunks / fftSize;
+
+        // the data of stage s is in the input buffer for even s and in the
+        // output buffer for odd s; the last stage ends in the output buffer
+        const rocfft_result_placement placement = (last && s % 2 == 0)
+                                                      ? rocfft_placement_notinplace
+                                                      : rocfft_placement_inplace;
+        rocfft_status status = rocfft_plan_create(&stage.plan,
+                                                  placement,
+                                                  transform_type,
+                                                  precision,
+                                                  stage.fftDims,
+                                                  fftLengths,
+                                                  batch,
+                                                  nullptr);
+        if(status != rocfft_status_success)
+        {
+            rocfft_distributed_plan_destroy(p);
+            return status;
+        }
+
+        size_t workBufferSize = 0;
+        rocfft_plan_get_work_buffer_size(stage.plan, &workBufferSize);
+        p->workBufferSize = std::max(p->workBufferSize, workBufferSize);
+    }
+
+    *plan = p;
+    return rocfft_status_success;
+}
+
+rocfft_status rocfft_distributed_plan_get_layout(const rocfft_distributed_plan plan,
+                                                 size_t*                       in_start,
+                                                 size_t*                       in_count,
+                                                 size_t*                       in_strides,
+                                                 size_t*                       out_start,
+                                                 size_t*                       out_count,
+                                                 size_t*                       out_strides)
+{
+    log_trace(__func__, "plan", plan);
+    const DistBrick& in  = plan->stages.front().brick;
+    const DistBrick& out = plan->stages.back().brick;
+    for(size_t d = 0; d < 3; ++d)
+    {
+        in_start[d]    = in.start[d];
+        in_count[d]    = in.count[d];
+        in_strides[d]  = in.Stride(d);
+        out_start[d]   = out.start[d];
+        out_count[d]   = out.count[d];
+        out_strides[d] = out.Stride(d);
+    }
+    return rocfft_status_success;
+}
+
+rocfft_status rocfft_distributed_plan_get_work_buffer_size(const rocfft_distributed_plan plan,
+                                                           size_t* size_in_bytes)
+{
+    log_trace(__func__, "plan", plan);
+    *size_in_bytes = plan->workBufferSize;
+    return rocfft_status_success;
+}
+
+// Transform a stage in chunks and send each one to the next stage's layout
+// while the following chunk is transformed.  Device data is staged through
+// host memory.
+static rocfft_status ExchangeStage(rocfft_distributed_plan_t& plan,
+                                   DistStage&                 stage,
+                                   char*                      cur,
+                                   char*                      next,
+                                   rocfft_execution_info      info,
+                                   bool                       onHost)
+{
+    const size_t elemSize   = plan.elemSize;
+    const size_t chunkElems = stage.brick.Size() / stage.chunks;
+    const size_t blockElems = chunkElems / stage.group.size();
+    const size_t chunkBytes = chunkElems * elemSize;
+
+    const size_t me
+        = std::find(stage.group.begin(), stage.group.end(), plan.transport->rank)
+          - stage.group.begin();
+    const DistBrick& myNext = stage.nextBricks[me];
+
+    for(size_t i = 0; i < 2; ++i)
+    {
+        plan.send[i].resize(chunkBytes);
+        plan.recv[i].resize(chunkBytes);
+    }
+    if(!onHost)
+    {
+        plan.hostChunk.resize(chunkBytes);
+        plan.hostNext.resize(myNext.Size() * elemSize);
+    }
+    char* nextData = onHost ? next : plan.hostNext.data();
+
+    auto unpack = [&](size_t k) {
+        const char* recv = plan.recv[k % 2].data();
+        for(size_t i = 0; i < stage.group.size(); ++i)
+        {
+            DistBrick box = Intersect(ChunkOf(stage.groupBricks[i], k, stage.chunks), myNext);
+            assert(box.Size() == blockElems);
+            CopyBox(box, box, recv + i * blockElems * elemSize, myNext, nextData, plan.precision);
+        }
+    };
+
+    std::thread   exchange;
+    rocfft_status exchangeStatus = rocfft_status_success;
+    rocfft_status status         = rocfft_status_success;
+    for(size_t k = 0; k < stage.chunks; ++k)
+    {
+        char* chunkData = cur + k * chunkBytes;
+        void* buffer[1] = {chunkData};
+        status          = rocfft_execute(stage.plan, buffer, nullptr, info);
+        if(status != rocfft_status_success)
+            break;
+
+        const char* packFrom = chunkData;
+        if(!onHost)
+        {
+            if(hipStreamSynchronize(info ? info->rocfft_stream : 0) != hipSuccess
+               || hipMemcpy(plan.hostChunk.data(), chunkData, chunkBytes, hipMemcpyDeviceToHost)
+                      != hipSuccess)
+            {
+                status = rocfft_status_failure;
+                break;
+            }
+            packFrom = plan.hostChunk.data();
+        }
+
+        const DistBrick chunk = ChunkOf(stage.brick, k, stage.chunks);
+        char*           send  = plan.send[k % 2].data();
+        for(size_t i = 0; i < stage.group.size(); ++i)
+        {
+            DistBrick box = Intersect(chunk, stage.nextBricks[i]);
+            assert(box.Size() == blockElems);
+            CopyBox(box, chunk, packFrom, box, send + i * blockElems * elemSize, plan.precision);
+        }
+
+        if(exchange.joinable())
+        {
+            exchange.join();
+            if(exchangeStatus != rocfft_status_success)
+                return exchangeStatus;
+            unpack(k - 1);
+        }
+        exchange = std::thread([&plan, &stage, &exchangeStatus, send, k, blockElems, elemSize]() {
+            exchangeStatus = plan.transport->Exchange(
+                stage.group, send, plan.recv[k % 2].data(), blockElems * elemSize);
+        });
+    }
+
+    if(exchange.joinable())
+    {
+        exchange.join();
+        if(status != rocfft_status_success)
+            return status;
+        if(exchangeStatus != rocfft_status_success)
+            return exchangeStatus;
+        unpack(stage.chunks - 1);
+    }
+    if(status != rocfft_status_success)
+        return status;
+
+    if(!onHost
+       && hipMemcpy(next, plan.hostNext.data(), plan.hostNext.size(), hipMemcpyHostToDevice)
+              != hipSuccess)
+        return rocfft_status_failure;
+    return rocfft_status_success;
+}
+
+rocfft_status rocfft_distributed_execute(const rocfft_distributed_plan plan,
+                                         void*                         in_buffer,
+                                         void*                         out_buffer,
+                                         rocfft_execution_info         info)
+{
+    log_trace(
+        __func__, "plan", plan, "in_buffer", in_buffer, "out_buffer", out_buffer, "info", info);
+
+    const bool onHost
+        = (info ? info->backend : DefaultExecutionBackend()) == rocfft_execution_backend_host;
+
+    // stages alternate between the two buffers, the input one is overwritten
+    char* buffers[2] = {static_cast<char*>(in_buffer), static_cast<char*>(out_buffer)};
+    for(size_t s = 0; s + 1 < plan->stages.size(); ++s)
+    {
+        rocfft_status status = ExchangeStage(
+            *plan, plan->stages[s], buffers[s % 2], buffers[(s + 1) % 2], info, onHost);
+        if(status != rocfft_status_success)
+            return status;
+    }
+
+    const size_t last   = plan->stages.size() - 1;
+    void*        in[1]  = {buffers[last % 2]};
+    void*        out[1] = {out_buffer};
+    return rocfft_execute(plan->stages[last].plan, in, out, info);
+}
+
+rocfft_status rocfft_distributed_plan_destroy(rocfft_distributed_plan plan)
+{
+    log_trace(__func__, "plan", plan);
+    if(plan != nullptr)
+    {
+        for(auto& stage : plan->stages)
+            if(stage.plan != nullptr)
+                rocfft_plan_destroy(stage.plan);
+        delete plan;
+    }
+    return rocfft_status_success;
+}
@@ -477,19 +477,30 @@ hipfftResult
 
     batch 	    number of transforms
  */
-hipfftResult hipfftMakePlanMany(hipfftHandle plan,
-                                int          rank,
-                                int*         n,
-                                int*         inembed,
-                                int          istride,
-                                int          idist,
-                                int*         onembed,
-                                int          ostride,
-                                int          odist,
-                                hipfftType   type,
-                                int          batch,
-                                size_t*      workSize)
+// Shared by the 32-bit and 64-bit advanced-layout entry points; T is the
+// integer type of the caller's sizes.
+template <typename T>
+static hipfftResult hipfftMakePlanMany_internal(hipfftHandle plan,
+                                                int          rank,
+                                                T*           n,
+                                                T*           inembed,
+                                                T            istride,
+                                                T            idist,
+                                                T*           onembed,
+                                                T            ostride,
+                                                T            odist,
+                                                hipfftType   type,
+                                                T            batch,
+                                                size_t*      workSize)
 {
+    if(rank < 1 || rank > 3 || batch < 0 || istride < 0 || idist < 0 || ostride < 0 || odist < 0)
+        return HIPFFT_INVALID_VALUE;
+    for(int i = 0; i < rank; i++)
+    {
+        if(n[i] < 1)
+            return HIPFFT_INVALID_SIZE;
+    }
+
     size_t lengths[3];
     for(size_t i = 0; i < rank; i++)
         lengths[i] = n[rank - 1 - i];
@@ -585,6 +596,23 @@ hipfftResult hipfftMakePlanMany(hipfftHandle plan,
     return ret;
 }
 
+hipfftResult hipfftMakePlanMany(hipfftHandle plan,
+                                int          rank,
+                                int*         n,
+                                int*         inembed,
+                                int          istride,
+                                int          idist,
+                                int*         onembed,
+                                int          ostride,
+                                int          odist,
+                                hipfftType   type,
+                                int          batch,
+                                size_t*      workSize)
+{
+    return hipfftMakePlanMany_internal(
+        plan, rank, n, inembed, istride, idist, onembed, ostride, odist, type, batch, workSize);
+}
+
 hipfftResult hipfftMakePlanMany64(hipfftHandle   plan,
                                   int            rank,
                                   long long int* n,
@@ -598,7 +626,8 @@ hipfftResult hipfftMakePlanMany64(hipfftHandle   plan,
                                   long long int  batch,
                                   size_t*        workSize)
 {
-    return HIPFFT_NOT_IMPLEMENTED;
+    return hipfftMakePlanMany_internal(
+        plan, rank, n, inembed, istride, idist, onembed, ostride, odist, type, batch, workSize);
 }
 
 /*============================================================================================*/
@@ -797,7 +826,13 @@ hipfftResult hipfftGetSizeMany64(hipfftHandle   plan,
                                  long long int  batch,
                                  size_t*        workSize)
 {
-    return HIPFFT_NOT_IMPLEMENTED;
+    hipfftHandle p;
+    HIP_FFT_CHECK_AND_RETURN(hipfftCreate(&p));
+    HIP_FFT_CHECK_AND_RETURN(hipfftMakePlanMany64(
+        p, rank, n, inembed, istride, idist, onembed, ostride, odist, type, batch, workSize));
+    HIP_FFT_CHECK_AND_RETURN(hipfftDestroy(p));
+
+    return HIPFFT_SUCCESS;
 }
 
 /*============================================================================================*/
@@ -0,0 +1,1640 @@
+/******************************************************************************
+* Copyright (c) 2016 - present Advanced Micro Devices, Inc. All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*******************************************************************************/
+
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <complex>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+// non-temporal stores for large transpose outputs
+#if defined(__SSE2__) && defined(__x86_64__) && !defined(__HIP_DEVICE_COMPILE__)
+#include <emmintrin.h>
+#define HOST_STREAM_STORES
+#endif
+
+#include "host_function_pool.h"
+#include "host_kernels.h"
+#include "host_thread_pool.h"
+#include "kernel_launch.h"
+#include "plan.h"
+
+// Read and write access to a complex buffer, stored either interleaved
+// or planar, indexed in units of complex elements.  Written values are
+// multiplied by scale.
+template <typename T>
+struct HostComplexBuffer
+{
+    std::complex<T>* data;
+    T*               re;
+    T*               im;
+    T                scale;
+
+    HostComplexBuffer(void* const buf[2], const rocfft_array_type type, const double scale = 1.0)
+        : data(nullptr)
+        , re(nullptr)
+        , im(nullptr)
+        , scale(scale)
+    {
+        if(type == rocfft_array_type_complex_planar || type == rocfft_array_type_hermitian_planar)
+        {
+            re = static_cast<T*>(buf[0]);
+            im = static_cast<T*>(buf[1]);
+        }
+        else
+        {
+            data = static_cast<std::complex<T>*>(buf[0]);
+        }
+    }
+
+    std::complex<T> read(const size_t idx) const
+    {
+        return data ? data[idx] : std::complex<T>(re[idx], im[idx]);
+    }
+
+    void write(const size_t idx, const std::complex<T>& val)
+    {
+        if(data)
+        {
+            data[idx] = scale * val;
+        }
+        else
+        {
+            re[idx] = scale * val.real();
+            im[idx] = scale * val.imag();
+        }
+    }
+
+    // Write bypassing the caches; host_stream_fence() has to be called
+    // before the data is read by another thread.
+    void stream(const size_t idx, const std::complex<T>& val);
+};
+
+#if defined(HOST_STREAM_STORES)
+static inline void host_stream_store(float* p, const float val)
+{
+    int bits;
+    memcpy(&bits, &val, sizeof(bits));
+    _mm_stream_si32(reinterpret_cast<int*>(p), bits);
+}
+
+static inline void host_stream_store(double* p, const double val)
+{
+    long long bits;
+    memcpy(&bits, &val, sizeof(bits));
+    _mm_stream_si64(reinterpret_cast<long long*>(p), bits);
+}
+
+static inline void host_stream_fence()
+{
+    _mm_sfence();
+}
+#else
+template <typename T>
+static inline void host_stream_store(T* p, const T val)
+{
+    *p = val;
+}
+
+static inline void host_stream_fence() {}
+#endif
+
+template <typename T>
+void HostComplexBuffer<T>::stream(const size_t idx, const std::complex<T>& val)
+{
+    T* const p_re = data ? reinterpret_cast<T*>(data + idx) : re + idx;
+    T* const p_im = data ? p_re + 1 : im + idx;
+    host_stream_store(p_re, scale * val.real());
+    host_stream_store(p_im, scale * val.imag());
+}
+
+// Number of 1D vectors of a launch, i.e. the product of the lengths of its
+// node from firstDim on, times the batch members of the launch.
+static size_t host_row_count(const DeviceCallIn* data, const size_t firstDim)
+{
+    size_t count = data->batch;
+    for(size_t d = firstDim; d < data->node->length.size(); ++d)
+        count *= data->node->length[d];
+    return count;
+}
+
+// Input and output offsets of the row-th 1D vector of a node.  Rows run
+// over the dimensions from firstDim on, and then over the batch.
+static void host_row_offsets(const TreeNode& node,
+                             const size_t    firstDim,
+                             size_t          row,
+                             size_t&         iOffset,
+                             size_t&         oOffset)
+{
+    iOffset = 0;
+    oOffset = 0;
+    for(size_t d = firstDim; d < node.length.size(); ++d)
+    {
+        const size_t idx = row % node.length[d];
+        row /= node.length[d];
+        iOffset += idx * node.inStride[d];
+        oOffset += idx * node.outStride[d];
+    }
+    iOffset += row * node.iDist;
+    oOffset += row * node.oDist;
+}
+
+// Run func(begin, end) over ranges of the rows [0, rows) of a leaf on the
+// host threads.  rowSize is the number of elements of a row; small leaves
+// are kept on fewer threads.
+template <typename F>
+static void host_parallel_rows(const DeviceCallIn* data,
+                               const size_t        rows,
+                               const size_t        rowSize,
+                               const F&            func)
+{
+    const size_t minElementsPerThread = 16384;
+
+    size_t threads
+        = data->hostThreads ? data->hostThreads : HostThreadPool::DefaultThreadCount();
+    threads = std::min(threads, std::max<size_t>(1, rows * rowSize / minElementsPerThread));
+
+    HostThreadPool::GetPool().ParallelFor(rows, threads, func);
+}
+
+// Table of exp(-2 pi i k / N), k = 0, ..., N - 1, computed once per length.
+template <typename T>
+static const std::vector<std::complex<T>>& host_twiddles(const size_t N)
+{
+    static std::mutex                                     mtx;
+    static std::map<size_t, std::vector<std::complex<T>>> tables;
+
+    std::lock_guard<std::mutex> lck(mtx);
+
+    auto& table = tables[N];
+    if(table.empty())
+    {
+        const double TWO_PI = -6.283185307179586476925286766559;
+
+        table.resize(N);
+        for(size_t k = 0; k < N; ++k)
+            table[k] = std::complex<T>(cos(TWO_PI * k / N), sin(TWO_PI * k / N));
+    }
+    return table;
+}
+
+// exp(dir * 2 pi i u / N) from a table of length N
+template <typename T>
+static inline std::complex<T>
+    host_twiddle(const std::vector<std::complex<T>>& table, const size_t u, const int dir)
+{
+    const std::complex<T> w = table[u % table.size()];
+    return (dir == -1) ? w : std::conj(w);
+}
+
+static std::vector<size_t> host_factors(size_t N)
+{
+    std::vector<size_t> factors;
+    while(N % 4 == 0)
+    {
+        factors.push_back(4);
+        N /= 4;
+    }
+    for(size_t p = 2; p * p <= N; ++p)
+    {
+        while(N % p == 0)
+        {
+            factors.push_back(p);
+            N /= p;
+        }
+    }
+    if(N > 1)
+        factors.push_back(N);
+    return factors;
+}
+
+// Mixed-radix Stockham autosort FFT of length N.  Both x and y are
+// overwritten; the result ends up in whichever of the two is returned.
+template <typename T>
+static std::complex<T>* host_fft(std::complex<T>*           x,
+                                 std::complex<T>*           y,
+                                 const size_t               N,
+                                 const std::vector<size_t>& factors,
+                                 const int                  dir)
+{
+    const auto& table = host_twiddles<T>(N);
+
+    std::vector<std::complex<T>> a;
+
+    size_t n = N;
+    size_t s = 1;
+    for(const auto p : factors)
+    {
+        const size_t m = n / p;
+        a.resize(p);
+
+        for(size_t q = 0; q < m; ++q)
+        {
+            for(size_t r = 0; r < s; ++r)
+            {
+                for(size_t k = 0; k < p; ++k)
+                    a[k] = x[r + s * (q + m * k)];
+
+                for(size_t j = 0; j < p; ++j)
+                {
+                    std::complex<T> sum = a[0];
+                    for(size_t k = 1; k < p; ++k)
+                        sum += a[k] * host_twiddle(table, ((j * k) % p) * (N / p), dir);
+                    y[r + s * (p * q + j)] = sum * host_twiddle(table, q * j * s, dir);
+                }
+            }
+        }
+
+        n = m;
+        s *= p;
+        std::swap(x, y);
+    }
+
+    return x;
+}
+
+template <typename T>
+static HostFnCall<T> host_generated_function(const size_t N, const int dir);
+
+template <>
+HostFnCall<float> host_generated_function(const size_t N, const int dir)
+{
+    return host_function_pool::get_function_single(std::make_pair(N, dir));
+}
+
+template <>
+HostFnCall<double> host_generated_function(const size_t N, const int dir)
+{
+    return host_function_pool::get_function_double(std::make_pair(N, dir));
+}
+
+// 1D transforms of one length: the generated straight-line kernel for the
+// length if there is one, host_fft otherwise.  The work vectors belong to
+// one thread.
+template <typename T>
+struct HostLineFFT
+{
+    const size_t              N;
+    const int                 dir;
+    const std::vector<size_t> factors;
+    const HostFnCall<T>       kernel;
+    const T*                  tw;
+
+    HostLineFFT(const size_t N, const int dir)
+        : N(N)
+        , dir(dir)
+        , factors(host_factors(N))
+        , kernel(host_generated_function<T>(N, dir))
+        , tw(kernel ? reinterpret_cast<const T*>(host_twiddles<T>(N).data()) : nullptr)
+    {
+    }
+
+    struct Work
+    {
+        std::vector<std::complex<T>> x, y;
+        std::vector<T>               re, im, tre, tim;
+
+        explicit Work(const size_t N)
+            : x(N)
+            , y(N)
+            , re(N)
+            , im(N)
+            , tre(N)
+            , tim(N)
+        {
+        }
+    };
+
+    // Transform the line loaded into w.x; returns where the result is
+    std::complex<T>* operator()(Work& w) const
+    {
+        if(!kernel)
+            return host_fft(w.x.data(), w.y.data(), N, factors, dir);
+
+        for(size_t i = 0; i < N; ++i)
+        {
+            w.re[i] = w.x[i].real();
+            w.im[i] = w.x[i].imag();
+        }
+
+        kernel(w.re.data(), w.im.data(), w.tre.data(), w.tim.data(), tw);
+
+        for(size_t i = 0; i < N; ++i)
+            w.x[i] = std::complex<T>(w.re[i], w.im[i]);
+        return w.x.data();
+    }
+};
+
+template <typename T>
+static void host_stockham_pr(DeviceCallIn* data)
+{
+    const TreeNode& node = *data->node;
+
+    const size_t         N = node.length[0];
+    const HostLineFFT<T> fft(N, node.direction);
+
+    // CS_KERNEL_STOCKHAM_BLOCK_CC multiplies by the large 1D twiddles
+    // after the column transform.
+    const bool  twl   = (node.scheme == CS_KERNEL_STOCKHAM_BLOCK_CC) && (node.large1D != 0);
+    const auto* table = twl ? &host_twiddles<T>(node.large1D) : nullptr;
+
+    HostComplexBuffer<T> in(data->bufIn, node.inArrayType);
+    HostComplexBuffer<T> out(data->bufOut, node.outArrayType, node.scale);
+
+    const size_t rows = host_row_count(data, 1);
+    host_parallel_rows(data, rows, N, [&](const size_t begin, const size_t end) {
+        typename HostLineFFT<T>::Work work(N);
+
+        for(size_t row = begin; row < end; ++row)
+        {
+            size_t iOffset, oOffset;
+            host_row_offsets(node, 1, row, iOffset, oOffset);
+
+            for(size_t i = 0; i < N; ++i)
+                work.x[i] = in.read(iOffset + i * node.inStride[0]);
+
+            std::complex<T>* res = fft(work);
+
+            if(twl)
+            {
+                const size_t col = row % node.length[1];
+                for(size_t k = 0; k < N; ++k)
+                    res[k] *= host_twiddle(*table, k * col, node.direction);
+            }
+
+            for(size_t i = 0; i < N; ++i)
+                out.write(oOffset + i * node.outStride[0], res[i]);
+        }
+    });
+}
+
+// CS_KERNEL_2D_SINGLE and CS_KERNEL_3D_SINGLE: every transform is gathered
+// into a contiguous tile, transformed along each dimension in turn and
+// scattered to the output.
+template <typename T>
+static void host_single_pr(DeviceCallIn* data)
+{
+    const TreeNode& node = *data->node;
+
+    const size_t dim   = (node.scheme == CS_KERNEL_3D_SINGLE) ? 3 : 2;
+    size_t       elems = 1;
+    size_t       maxN  = 1;
+
+    std::vector<HostLineFFT<T>> ffts;
+    ffts.reserve(dim);
+    for(size_t d = 0; d < dim; ++d)
+    {
+        ffts.emplace_back(node.length[d], node.direction);
+        elems *= node.length[d];
+        maxN = std::max(maxN, node.length[d]);
+    }
+
+    HostComplexBuffer<T> in(data->bufIn, node.inArrayType);
+    HostComplexBuffer<T> out(data->bufOut, node.outArrayType, node.scale);
+
+    const size_t count = host_row_count(data, dim);
+    host_parallel_rows(data, count, elems, [&](const size_t begin, const size_t end) {
+        std::vector<std::complex<T>>  tile(elems);
+        typename HostLineFFT<T>::Work work(maxN);
+
+        for(size_t t = begin; t < end; ++t)
+        {
+            size_t iOffset, oOffset;
+            host_row_offsets(node, dim, t, iOffset, oOffset);
+
+            for(size_t e = 0; e < elems; ++e)
+            {
+                size_t idx = e;
+                size_t pos = iOffset;
+                for(size_t d = 0; d < dim; ++d)
+                {
+                    pos += (idx % node.length[d]) * node.inStride[d];
+                    idx /= node.length[d];
+                }
+                tile[e] = in.read(pos);
+            }
+
+            size_t stride = 1;
+            for(const auto& fft : ffts)
+            {
+                const size_t N = fft.N;
+                for(size_t line = 0; line < elems / N; ++line)
+                {
+                    const size_t base = (line % stride) + (line / stride) * stride * N;
+                    for(size_t i = 0; i < N; ++i)
+                        work.x[i] = tile[base + i * stride];
+
+                    const std::complex<T>* res = fft(work);
+                    for(size_t i = 0; i < N; ++i)
+                        tile[base + i * stride] = res[i];
+                }
+                stride *= N;
+            }
+
+            for(size_t e = 0; e < elems; ++e)
+            {
+                size_t idx = e;
+                size_t pos = oOffset;
+                for(size_t d = 0; d < dim; ++d)
+                {
+                    pos += (idx % node.length[d]) * node.outStride[d];
+                    idx /= node.length[d];
+                }
+                out.write(pos, tile[e]);
+            }
+        }
+    });
+}
+
+// Cache sizes of the host in bytes, used to pick the transpose tiles
+struct HostCacheSizes
+{
+    size_t l1; // L1 data cache
+    size_t l2;
+    size_t llc; // last level cache
+};
+
+#if defined(__linux__)
+// Size of the data or unified cache of the given level as reported by
+// sysfs, or 0 if it is not found.
+static size_t host_sysfs_cache_size(const int level)
+{
+    for(int index = 0;; ++index)
+    {
+        const std::string dir
+            = "/sys/devices/system/cpu/cpu0/cache/index" + std::to_string(index) + "/";
+
+        std::ifstream levelFile(dir + "level"), typeFile(dir + "type"), sizeFile(dir + "size");
+
+        int         cacheLevel;
+        std::string cacheType, cacheSize;
+        if(!(levelFile >> cacheLevel) || !(typeFile >> cacheType) || !(sizeFile >> cacheSize))
+            return 0;
+        if(cacheLevel != level || cacheType == "Instruction")
+            continue;
+
+        // e.g. "48K"
+        size_t bytes = std::stoul(cacheSize);
+        if(cacheSize.back() == 'K')
+            bytes *= 1024;
+        else if(cacheSize.back() == 'M')
+            bytes *= 1024 * 1024;
+        return bytes;
+    }
+}
+#endif
+
+static const HostCacheSizes& host_cache_sizes()
+{
+    static const HostCacheSizes sizes = []() {
+        HostCacheSizes s = {0, 0, 0};
+        size_t         l3 = 0;
+#if defined(__linux__)
+#if defined(_SC_LEVEL1_DCACHE_SIZE)
+        s.l1 = std::max<long>(sysconf(_SC_LEVEL1_DCACHE_SIZE), 0);
+        s.l2 = std::max<long>(sysconf(_SC_LEVEL2_CACHE_SIZE), 0);
+        l3   = std::max<long>(sysconf(_SC_LEVEL3_CACHE_SIZE), 0);
+#endif
+        if(s.l1 == 0)
+            s.l1 = host_sysfs_cache_size(1);
+        if(s.l2 == 0)
+            s.l2 = host_sysfs_cache_size(2);
+        if(l3 == 0)
+            l3 = host_sysfs_cache_size(3);
+#endif
+        // conservative defaults for what could not be found
+        if(s.l1 == 0)
+            s.l1 = 32 * 1024;
+        if(s.l2 == 0)
+            s.l2 = 256 * 1024;
+        s.llc = std::max(s.l2, l3);
+        return s;
+    }();
+    return sizes;
+}
+
+// Largest power of 2 edge of a square tile such that the input and the
+// output tile of elements of elemSize bytes fit in cacheSize bytes.
+static size_t host_tile_size(const size_t cacheSize, const size_t elemSize)
+{
+    size_t tile = 4;
+    while(2 * (2 * tile) * (2 * tile) * elemSize <= cacheSize)
+        tile *= 2;
+    return tile;
+}
+
+// One plane of a transpose: element (i0, ib) moves from
+// iOffset + i0 * is0 + ib * isb to oOffset + i0 * os0 + ib * osb, optionally
+// multiplied by the large 1D twiddle exp(dir 2 pi i i0 ib / large1D).
+// A Good-Thomas transpose of an n0 x nb plane instead moves it from linear
+// index (pfaIn[0] i0 + pfaIn[1] ib) mod n0 nb of the input, whose
+// dimension 0 has n0 elements, to linear index
+// (pfaOut[0] i0 + pfaOut[1] ib) mod n0 nb of the output, whose dimension
+// 0 has nb elements.
+template <typename T>
+struct HostTransposePlane
+{
+    HostComplexBuffer<T>*               in;
+    HostComplexBuffer<T>*               out;
+    size_t                              is0, isb, os0, osb;
+    size_t                              iOffset, oOffset;
+    const std::vector<std::complex<T>>* table;
+    int                                 dir;
+    size_t                              tile; // L1 tile edge
+    bool                                stream; // non-temporal stores
+    bool                                pfa;
+    size_t                              n0, nb;
+    size_t                              pfaIn[2], pfaOut[2];
+};
+
+// Cache-oblivious transpose of the block [i0, i0 + n0) x [ib, ib + nb):
+// the longer side is halved until the block fits an L1 tile.
+template <typename T>
+static void host_transpose_block(
+    const HostTransposePlane<T>& p, size_t i0, size_t n0, size_t ib, size_t nb)
+{
+    if(n0 > p.tile || nb > p.tile)
+    {
+        if(n0 >= nb)
+        {
+            host_transpose_block(p, i0, n0 / 2, ib, nb);
+            host_transpose_block(p, i0 + n0 / 2, n0 - n0 / 2, ib, nb);
+        }
+        else
+        {
+            host_transpose_block(p, i0, n0, ib, nb / 2);
+            host_transpose_block(p, i0, n0, ib + nb / 2, nb - nb / 2);
+        }
+        return;
+    }
+
+    if(p.pfa)
+    {
+        // Walk the linear indices li = i0 + n0 * i1 of the input and
+        // lo = o0 + nb * o1 of the output, which step by pfaIn[1] and
+        // pfaOut[1] modulo n0 * nb along ib, without dividing.
+        const size_t N   = p.n0 * p.nb;
+        const size_t si0 = p.pfaIn[1] % p.n0, si1 = p.pfaIn[1] / p.n0;
+        const size_t so0 = p.pfaOut[1] % p.nb, so1 = p.pfaOut[1] / p.nb;
+        for(size_t a = i0; a < i0 + n0; ++a)
+        {
+            const size_t li = (p.pfaIn[0] * a + p.pfaIn[1] * ib) % N;
+            const size_t lo = (p.pfaOut[0] * a + p.pfaOut[1] * ib) % N;
+            size_t       j0 = li % p.n0, j1 = li / p.n0;
+            size_t       k0 = lo % p.nb, k1 = lo / p.nb;
+            for(size_t b = ib; b < ib + nb; ++b)
+            {
+                p.out->write(p.oOffset + k0 * p.osb + k1 * p.os0,
+                             p.in->read(p.iOffset + j0 * p.is0 + j1 * p.isb));
+
+                j0 += si0;
+                j1 += si1 + ((j0 >= p.n0) ? 1 : 0);
+                j0 -= (j0 >= p.n0) ? p.n0 : 0;
+                j1 -= (j1 >= p.nb) ? p.nb : 0;
+                k0 += so0;
+                k1 += so1 + ((k0 >= p.nb) ? 1 : 0);
+                k0 -= (k0 >= p.nb) ? p.nb : 0;
+                k1 -= (k1 >= p.n0) ? p.n0 : 0;
+            }
+        }
+        return;
+    }
+
+    // the output is usually contiguous along ib
+    for(size_t a = i0; a < i0 + n0; ++a)
+    {
+        for(size_t b = ib; b < ib + nb; ++b)
+        {
+            std::complex<T> val = p.in->read(p.iOffset + a * p.is0 + b * p.isb);
+            if(p.table)
+                val *= host_twiddle(*p.table, a * b, p.dir);
+
+            const size_t oIdx = p.oOffset + a * p.os0 + b * p.osb;
+            if(p.stream)
+                p.out->stream(oIdx, val);
+            else
+                p.out->write(oIdx, val);
+        }
+    }
+}
+
+// Transposes move input dimension 0 to output dimension perm[0] and input
+// dimension b (perm[b] == 0) to output dimension 0.  The transpose runs
+// as a 2D blocked copy over dimensions 0 and b for every plane of the
+// remaining dimensions and the batch.  The planes are cut into L2 sized
+// blocks that are spread over the host threads, and every block is
+// transposed recursively down to L1 tiles.
+template <typename T>
+static void host_transpose_pr(DeviceCallIn* data)
+{
+    const TreeNode& node = *data->node;
+
+    // Output dimension of each of the transposed input dimensions.
+    size_t perm[3] = {1, 0, 2};
+    size_t tdims   = 2;
+    if(node.scheme == CS_KERNEL_TRANSPOSE_XY_Z)
+    {
+        perm[0] = 1;
+        perm[1] = 2;
+        perm[2] = 0;
+        tdims   = 3;
+    }
+    else if(node.scheme == CS_KERNEL_TRANSPOSE_Z_XY)
+    {
+        perm[0] = 2;
+        perm[1] = 0;
+        perm[2] = 1;
+        tdims   = 3;
+    }
+    const size_t b = (perm[1] == 0) ? 1 : 2;
+
+    const bool  twl   = (node.scheme == CS_KERNEL_TRANSPOSE) && (node.large1D != 0);
+    const auto* table = twl ? &host_twiddles<T>(node.large1D) : nullptr;
+
+    HostComplexBuffer<T> in(data->bufIn, node.inArrayType);
+    HostComplexBuffer<T> out(data->bufOut, node.outArrayType, node.scale);
+
+    const size_t n0     = node.length[0];
+    const size_t nb     = node.length[b];
+    const size_t planes = host_row_count(data, 1) / nb;
+
+    const auto&  cache    = host_cache_sizes();
+    const size_t elemSize = sizeof(std::complex<T>);
+    const size_t l2Tile   = host_tile_size(cache.l2, elemSize);
+
+    const size_t blocks0 = (n0 + l2Tile - 1) / l2Tile;
+    const size_t blocksb = (nb + l2Tile - 1) / l2Tile;
+    const size_t blocks  = blocks0 * blocksb;
+
+    HostTransposePlane<T> plane;
+    plane.in     = &in;
+    plane.out    = &out;
+    plane.is0    = node.inStride[0];
+    plane.isb    = node.inStride[b];
+    plane.os0    = node.outStride[perm[0]];
+    plane.osb    = node.outStride[0];
+    plane.table  = table;
+    plane.dir    = node.direction;
+    plane.tile   = host_tile_size(cache.l1, elemSize);
+    plane.stream = planes * n0 * nb * elemSize > cache.llc;
+    plane.pfa    = (node.pfaIn[0] != 0);
+    plane.n0     = n0;
+    plane.nb     = nb;
+    std::copy(node.pfaIn, node.pfaIn + 2, plane.pfaIn);
+    std::copy(node.pfaOut, node.pfaOut + 2, plane.pfaOut);
+
+    host_parallel_rows(
+        data, planes * blocks, l2Tile * l2Tile, [&](const size_t begin, const size_t end) {
+            HostTransposePlane<T> p = plane;
+            for(size_t item = begin; item < end; ++item)
+            {
+                size_t r     = item / blocks;
+                size_t block = item % blocks;
+
+                p.iOffset = 0;
+                p.oOffset = 0;
+                for(size_t d = 1; d < node.length.size(); ++d)
+                {
+                    if(d == b)
+                        continue;
+                    const size_t idx = r % node.length[d];
+                    r /= node.length[d];
+                    p.iOffset += idx * node.inStride[d];
+                    p.oOffset += idx * node.outStride[d < tdims ? perm[d] : d];
+                }
+                p.iOffset += r * node.iDist;
+                p.oOffset += r * node.oDist;
+
+                const size_t i0 = (block / blocksb) * l2Tile;
+                const size_t ib = (block % blocksb) * l2Tile;
+                host_transpose_block(
+                    p, i0, std::min(l2Tile, n0 - i0), ib, std::min(l2Tile, nb - ib));
+            }
+            if(plane.stream)
+                host_stream_fence();
+        });
+}
+
+// In-place transpose of contiguous length[1] x length[0] matrices, one for
+// every index of the higher dimensions and the batch.  Square matrices swap
+// elements across the diagonal.  Otherwise the element at p moves to
+// p * length[1] mod (N - 1), N = length[0] * length[1], and the permutation
+// is followed along its cycles; each cycle is moved by the thread owning its
+// smallest index.
+template <typename T>
+static void host_transpose_inplace_pr(DeviceCallIn* data)
+{
+    const TreeNode& node = *data->node;
+
+    assert(data->bufIn[0] == data->bufOut[0]);
+    std::complex<T>* buf   = static_cast<std::complex<T>*>(data->bufOut[0]);
+    const T          scale = node.scale;
+
+    const size_t cols     = node.length[0];
+    const size_t rows     = node.length[1];
+    const size_t N        = cols * rows;
+    const size_t matrices = host_row_count(data, 2);
+
+    if(cols == rows)
+    {
+        host_parallel_rows(
+            data, matrices * rows, cols, [&](const size_t begin, const size_t end) {
+                for(size_t item = begin; item < end; ++item)
+                {
+                    size_t offset, unused;
+                    host_row_offsets(node, 2, item / rows, offset, unused);
+                    std::complex<T>* a = buf + offset;
+
+                    const size_t i = item % rows;
+                    a[i * cols + i] *= scale;
+                    for(size_t j = i + 1; j < cols; ++j)
+                    {
+                        const std::complex<T> x = a[i * cols + j];
+                        a[i * cols + j]         = scale * a[j * cols + i];
+                        a[j * cols + i]         = scale * x;
+                    }
+                }
+            });
+        return;
+    }
+
+    host_parallel_rows(data, matrices * N, 1, [&](const size_t begin, const size_t end) {
+        for(size_t item = begin; item < end; ++item)
+        {
+            const size_t start = item % N;
+            const bool   fixed = (start == 0 || start == N - 1);
+
+            size_t p = fixed ? start : (start * rows) % (N - 1);
+            while(p > start)
+                p = (p * rows) % (N - 1);
+            if(p != start)
+                continue;
+
+            size_t offset, unused;
+            host_row_offsets(node, 2, item / N, offset, unused);
+            std::complex<T>* a = buf + offset;
+
+            if(fixed)
+            {
+                a[start] *= scale;
+                continue;
+            }
+
+            std::complex<T> carry = a[start];
+            p                     = start;
+            do
+            {
+                p                           = (p * rows) % (N - 1);
+                const std::complex<T> moved = a[p];
+                a[p]                        = scale * carry;
+                carry                       = moved;
+            } while(p != start);
+        }
+    });
+}
+
+template <typename T>
+static void host_real2complex_pr(DeviceCallIn* data)
+{
+    const TreeNode& node = *data->node;
+
+    const T*             in = static_cast<const T*>(data->bufIn[0]);
+    HostComplexBuffer<T> out(data->bufOut, node.outArrayType, node.scale);
+
+    const size_t rows = host_row_count(data, 1);
+    host_parallel_rows(data, rows, node.length[0], [&](const size_t begin, const size_t end) {
+        for(size_t row = begin; row < end; ++row)
+        {
+            size_t iOffset, oOffset;
+            host_row_offsets(node, 1, row, iOffset, oOffset);
+
+            for(size_t i = 0; i < node.length[0]; ++i)
+                out.write(oOffset + i * node.outStride[0],
+                          std::complex<T>(in[iOffset + i * node.inStride[0]], 0));
+        }
+    });
+}
+
+template <typename T>
+static void host_complex2hermitian_pr(DeviceCallIn* data)
+{
+    const TreeNode& node = *data->node;
+
+    HostComplexBuffer<T> in(data->bufIn, node.inArrayType);
+    HostComplexBuffer<T> out(data->bufOut, node.outArrayType, node.scale);
+
+    const size_t hermitian_size = node.length[0] / 2 + 1;
+
+    const size_t rows = host_row_count(data, 1);
+    host_parallel_rows(data, rows, hermitian_size, [&](const size_t begin, const size_t end) {
+        for(size_t row = begin; row < end; ++row)
+        {
+            size_t iOffset, oOffset;
+            host_row_offsets(node, 1, row, iOffset, oOffset);
+
+            for(size_t i = 0; i < hermitian_size; ++i)
+                out.write(oOffset + i * node.outStride[0], in.read(iOffset + i * node.inStride[0]));
+        }
+    });
+}
+
+template <typename T>
+static void host_complex2real_pr(DeviceCallIn* data)
+{
+    const TreeNode& node = *data->node;
+
+    HostComplexBuffer<T> in(data->bufIn, node.inArrayType);
+    T*                   out   = static_cast<T*>(data->bufOut[0]);
+    const T              scale = node.scale;
+
+    const size_t rows = host_row_count(data, 1);
+    host_parallel_rows(data, rows, node.length[0], [&](const size_t begin, const size_t end) {
+        for(size_t row = begin; row < end; ++row)
+        {
+            size_t iOffset, oOffset;
+            host_row_offsets(node, 1, row, iOffset, oOffset);
+
+            for(size_t i = 0; i < node.length[0]; ++i)
+                out[oOffset + i * node.outStride[0]]
+                    = scale * in.read(iOffset + i * node.inStride[0]).real();
+        }
+    });
+}
+
+// Expand a Hermitian-symmetric array into the full complex array:
+// every input element is copied straight, and its conjugate is written
+// at the mirrored position in all dimensions.
+template <typename T>
+static void host_hermitian2complex_pr(DeviceCallIn* data)
+{
+    const TreeNode& node = *data->node;
+
+    HostComplexBuffer<T> in(data->bufIn, node.inArrayType);
+    HostComplexBuffer<T> out(data->bufOut, node.outArrayType, node.scale);
+
+    const size_t dim_0          = node.length[0];
+    const size_t hermitian_size = dim_0 / 2 + 1;
+
+    const size_t rows = host_row_count(data, 1);
+    host_parallel_rows(data, rows, dim_0, [&](const size_t begin, const size_t end) {
+        for(size_t row = begin; row < end; ++row)
+        {
+            size_t r        = row;
+            size_t iOffset  = 0;
+            size_t osOffset = 0; // straight copy
+            size_t ocOffset = 0; // conjugate copy
+            for(size_t d = 1; d < node.length.size(); ++d)
+            {
+                const size_t idx = r % node.length[d];
+                r /= node.length[d];
+                iOffset += idx * node.inStride[d];
+                osOffset += idx * node.outStride[d];
+                ocOffset += (idx == 0 ? 0 : node.length[d] - idx) * node.outStride[d];
+            }
+            iOffset += r * node.iDist;
+            osOffset += r * node.oDist;
+            ocOffset += r * node.oDist;
+
+            for(size_t i = 0; i < hermitian_size; ++i)
+            {
+                const std::complex<T> val = in.read(iOffset + i * node.inStride[0]);
+                out.write(osOffset + i * node.outStride[0], val);
+                if((i != 0) && (2 * i != dim_0))
+                    out.write(ocOffset + (dim_0 - i) * node.outStride[0], std::conj(val));
+            }
+        }
+    });
+}
+
+// Row of a node holding the frequencies opposite to the ones of the given
+// row, i.e. the row index mirrored in every dimension from 1 on; the batch
+// index is kept.
+static size_t host_mirror_row(const TreeNode& node, size_t row)
+{
+    size_t mirror = 0, scale = 1;
+    for(size_t d = 1; d < node.length.size(); ++d)
+    {
+        const size_t idx = row % node.length[d];
+        row /= node.length[d];
+        mirror += (idx == 0 ? 0 : node.length[d] - idx) * scale;
+        scale *= node.length[d];
+    }
+    return mirror + row * scale;
+}
+
+// Real transforms run in pairs: batch members 2p and 2p + 1 are the real
+// and imaginary parts of the p-th complex transform.  The last member of an
+// odd batch is paired with zeros.
+template <typename T>
+static void host_pair_real2complex_pr(DeviceCallIn* data)
+{
+    const TreeNode& node = *data->node;
+
+    const T*         in    = static_cast<const T*>(data->bufIn[0]);
+    std::complex<T>* out   = static_cast<std::complex<T>*>(data->bufOut[0]);
+    const T          scale = node.scale;
+
+    const size_t memberRows = host_row_count(data, 1) / data->batch;
+    const size_t pairs      = (data->batch + 1) / 2;
+
+    host_parallel_rows(
+        data, pairs * memberRows, node.length[0], [&](const size_t begin, const size_t end) {
+            for(size_t row = begin; row < end; ++row)
+            {
+                const size_t p = row / memberRows;
+                const size_t r = row % memberRows;
+
+                size_t reOffset, imOffset, oOffset, unused;
+                host_row_offsets(node, 1, r + 2 * p * memberRows, reOffset, unused);
+                host_row_offsets(node, 1, r + p * memberRows, unused, oOffset);
+                const bool hasIm = 2 * p + 1 < data->batch;
+                if(hasIm)
+                    host_row_offsets(node, 1, r + (2 * p + 1) * memberRows, imOffset, unused);
+
+                for(size_t i = 0; i < node.length[0]; ++i)
+                    out[oOffset + i * node.outStride[0]]
+                        = scale
+                          * std::complex<T>(in[reOffset + i * node.inStride[0]],
+                                            hasIm ? in[imOffset + i * node.inStride[0]] : 0);
+            }
+        });
+}
+
+// Separate the transform Z of a pair into the Hermitian halves of the
+// transforms of its members: A[k] = (Z[k] + conj(Z[-k])) / 2 and
+// B[k] = (Z[k] - conj(Z[-k])) / 2i.
+template <typename T>
+static void host_pair_complex2hermitian_pr(DeviceCallIn* data)
+{
+    const TreeNode& node = *data->node;
+
+    const std::complex<T>* in = static_cast<const std::complex<T>*>(data->bufIn[0]);
+    HostComplexBuffer<T>   out(data->bufOut, node.outArrayType, node.scale);
+
+    const size_t dim_0          = node.length[0];
+    const size_t hermitian_size = dim_0 / 2 + 1;
+
+    const size_t memberRows = host_row_count(data, 1) / data->batch;
+    const size_t pairs      = (data->batch + 1) / 2;
+
+    const size_t is = node.inStride[0];
+    const size_t os = node.outStride[0];
+
+    host_parallel_rows(
+        data, pairs * memberRows, hermitian_size, [&](const size_t begin, const size_t end) {
+            for(size_t row = begin; row < end; ++row)
+            {
+                const size_t p = row / memberRows;
+                const size_t r = row % memberRows;
+
+                size_t iOffset, imOffset, aOffset, bOffset, unused;
+                host_row_offsets(node, 1, r + p * memberRows, iOffset, unused);
+                host_row_offsets(
+                    node, 1, host_mirror_row(node, r + p * memberRows), imOffset, unused);
+                host_row_offsets(node, 1, r + 2 * p * memberRows, unused, aOffset);
+                const bool hasB = 2 * p + 1 < data->batch;
+                if(hasB)
+                    host_row_offsets(node, 1, r + (2 * p + 1) * memberRows, unused, bOffset);
+
+                for(size_t k = 0; k < hermitian_size; ++k)
+                {
+                    const std::complex<T> z  = in[iOffset + k * is];
+                    const std::complex<T> zm
+                        = std::conj(in[imOffset + (k == 0 ? 0 : dim_0 - k) * is]);
+                    out.write(aOffset + k * os, (T)0.5 * (z + zm));
+                    if(hasB)
+                    {
+                        const std::complex<T> d = z - zm;
+                        out.write(bOffset + k * os,
+                                  std::complex<T>((T)0.5 * d.imag(), (T)-0.5 * d.real()));
+                    }
+                }
+            }
+        });
+}
+
+// Assemble the full transform Z = A + iB of a pair from the Hermitian
+// halves of its members.  Elements stored for both k and -k are replaced by
+// their Hermitian part, as taking the real part of the embedded transform
+// would do.
+template <typename T>
+static void host_pair_hermitian2complex_pr(DeviceCallIn* data)
+{
+    const TreeNode& node = *data->node;
+
+    HostComplexBuffer<T> in(data->bufIn, node.inArrayType);
+    std::complex<T>*     out   = static_cast<std::complex<T>*>(data->bufOut[0]);
+    const T              scale = node.scale;
+
+    const size_t dim_0          = node.length[0];
+    const size_t hermitian_size = dim_0 / 2 + 1;
+
+    const size_t memberRows = host_row_count(data, 1) / data->batch;
+    const size_t pairs      = (data->batch + 1) / 2;
+
+    const size_t is = node.inStride[0];
+    const size_t os = node.outStride[0];
+
+    host_parallel_rows(data, pairs * memberRows, dim_0, [&](const size_t begin, const size_t end) {
+        for(size_t row = begin; row < end; ++row)
+        {
+            const size_t p = row / memberRows;
+            const size_t r = row % memberRows;
+
+            size_t oOffset, unused;
+            host_row_offsets(node, 1, r + p * memberRows, unused, oOffset);
+
+            // element k of the full transform of member m
+            auto full = [&](const size_t m, const size_t k) {
+                size_t offset, mOffset;
+                host_row_offsets(node, 1, r + m * memberRows, offset, unused);
+                host_row_offsets(
+                    node, 1, host_mirror_row(node, r + m * memberRows), mOffset, unused);
+                if(k == 0 || 2 * k == dim_0)
+                    return (T)0.5
+                           * (in.read(offset + k * is) + std::conj(in.read(mOffset + k * is)));
+                else if(k < hermitian_size)
+                    return in.read(offset + k * is);
+                else
+                    return std::conj(in.read(mOffset + (dim_0 - k) * is));
+            };
+
+            const bool hasB = 2 * p + 1 < data->batch;
+            for(size_t k = 0; k < dim_0; ++k)
+            {
+                const std::complex<T> a = full(2 * p, k);
+                const std::complex<T> b = hasB ? full(2 * p + 1, k) : std::complex<T>(0);
+                out[oOffset + k * os]
+                    = scale * std::complex<T>(a.real() - b.imag(), a.imag() + b.real());
+            }
+        }
+    });
+}
+
+// Split the inverse transform of a pair into its real and imaginary parts,
+// the two real outputs.
+template <typename T>
+static void host_pair_complex2real_pr(DeviceCallIn* data)
+{
+    const TreeNode& node = *data->node;
+
+    const std::complex<T>* in    = static_cast<const std::complex<T>*>(data->bufIn[0]);
+    T*                     out   = static_cast<T*>(data->bufOut[0]);
+    const T                scale = node.scale;
+
+    const size_t memberRows = host_row_count(data, 1) / data->batch;
+    const size_t pairs      = (data->batch + 1) / 2;
+
+    host_parallel_rows(
+        data, pairs * memberRows, node.length[0], [&](const size_t begin, const size_t end) {
+            for(size_t row = begin; row < end; ++row)
+            {
+                const size_t p = row / memberRows;
+                const size_t r = row % memberRows;
+
+                size_t iOffset, reOffset, imOffset, unused;
+                host_row_offsets(node, 1, r + p * memberRows, iOffset, unused);
+                host_row_offsets(node, 1, r + 2 * p * memberRows, unused, reOffset);
+                const bool hasIm = 2 * p + 1 < data->batch;
+                if(hasIm)
+                    host_row_offsets(node, 1, r + (2 * p + 1) * memberRows, unused, imOffset);
+
+                for(size_t i = 0; i < node.length[0]; ++i)
+                {
+                    const std::complex<T> z = scale * in[iOffset + i * node.inStride[0]];
+                    out[reOffset + i * node.outStride[0]] = z.real();
+                    if(hasIm)
+                        out[imOffset + i * node.outStride[0]] = z.imag();
+                }
+            }
+        });
+}
+
+// 1D real post-process (R2C) and pre-process (C2R), operating on the
+// half-length complex transform of the real data.
+template <typename T, bool R2C>
+static void host_real_1d_pre_post_pr(DeviceCallIn* data)
+{
+    const TreeNode& node = *data->node;
+
+    HostComplexBuffer<T> in(data->bufIn, node.inArrayType);
+    HostComplexBuffer<T> out(data->bufOut, node.outArrayType, node.scale);
+
+    const size_t half_N    = node.length[0];
+    const size_t quarter_N = (half_N + 1) / 2;
+    const bool   Ndiv4     = half_N % 2 == 0;
+
+    const auto& table = host_twiddles<T>(2 * half_N);
+
+    const size_t is = node.inStride[0];
+    const size_t os = node.outStride[0];
+
+    const size_t rows = host_row_count(data, 1);
+    host_parallel_rows(data, rows, half_N, [&](const size_t begin, const size_t end) {
+        for(size_t row = begin; row < end; ++row)
+        {
+            size_t iOffset, oOffset;
+            host_row_offsets(node, 1, row, iOffset, oOffset);
+
+            for(size_t idx_p = 0; idx_p < quarter_N; ++idx_p)
+            {
+                const size_t idx_q = half_N - idx_p;
+
+                // NB: for R2C, the input has only half_N elements.
+                const std::complex<T> p = in.read(iOffset + idx_p * is);
+                const std::complex<T> q
+                    = (R2C && idx_p == 0) ? p : in.read(iOffset + idx_q * is);
+
+                if(idx_p == 0)
+                {
+                    if(R2C)
+                    {
+                        out.write(oOffset + half_N * os, std::complex<T>(p.real() - p.imag(), 0));
+                        out.write(oOffset, std::complex<T>(p.real() + p.imag(), 0));
+                        if(Ndiv4)
+                            out.write(oOffset + quarter_N * os,
+                                      std::conj(in.read(iOffset + quarter_N * is)));
+                    }
+                    else
+                    {
+                        // NB: multi-dimensional transforms may have non-zero
+                        // imaginary part at index 0 or at the Nyquist frequency.
+                        out.write(oOffset,
+                                  std::complex<T>(p.real() - p.imag() + q.real() + q.imag(),
+                                                  p.real() + p.imag() - q.real() + q.imag()));
+                        if(Ndiv4)
+                            out.write(oOffset + quarter_N * os,
+                                      (T)2.0 * std::conj(in.read(iOffset + quarter_N * is)));
+                    }
+                }
+                else
+                {
+                    const T twr = table[idx_p].real();
+                    const T twi = table[idx_p].imag();
+
+                    if(R2C)
+                    {
+                        const std::complex<T> u = (T)0.5 * (p + q);
+                        const std::complex<T> v = (T)0.5 * (p - q);
+
+                        out.write(oOffset + idx_p * os,
+                                  std::complex<T>(u.real() + v.real() * twi + u.imag() * twr,
+                                                  v.imag() + u.imag() * twi - v.real() * twr));
+                        out.write(oOffset + idx_q * os,
+                                  std::complex<T>(u.real() - v.real() * twi - u.imag() * twr,
+                                                  -v.imag() + u.imag() * twi - v.real() * twr));
+                    }
+                    else
+                    {
+                        const std::complex<T> u = p + q;
+                        const std::complex<T> v = p - q;
+
+                        out.write(oOffset + idx_p * os,
+                                  std::complex<T>(u.real() + v.real() * twi - u.imag() * twr,
+                                                  v.imag() + u.imag() * twi + v.real() * twr));
+                        out.write(oOffset + idx_q * os,
+                                  std::complex<T>(u.real() - v.real() * twi + u.imag() * twr,
+                                                  -v.imag() + u.imag() * twi + v.real() * twr));
+                    }
+                }
+            }
+        }
+    });
+}
+
+// Pack the pairs of consecutive elements of strided real data into a
+// contiguous complex array of half the length (R2C), or unpack them (C2R).
+template <typename T, bool R2C>
+static void host_real_1d_pack_pr(DeviceCallIn* data)
+{
+    const TreeNode& node = *data->node;
+
+    const size_t half_N = node.length[0];
+    const size_t is     = node.inStride[0];
+    const size_t os     = node.outStride[0];
+    const T      scale  = node.scale;
+
+    const size_t rows = host_row_count(data, 1);
+    host_parallel_rows(data, rows, half_N, [&](const size_t begin, const size_t end) {
+        for(size_t row = begin; row < end; ++row)
+        {
+            size_t iOffset, oOffset;
+            host_row_offsets(node, 1, row, iOffset, oOffset);
+
+            if(R2C)
+            {
+                const T*         in  = static_cast<const T*>(data->bufIn[0]) + iOffset;
+                std::complex<T>* out = static_cast<std::complex<T>*>(data->bufOut[0]) + oOffset;
+                for(size_t i = 0; i < half_N; ++i)
+                    out[i * os] = scale * std::complex<T>(in[2 * i * is], in[(2 * i + 1) * is]);
+            }
+            else
+            {
+                const std::complex<T>* in
+                    = static_cast<const std::complex<T>*>(data->bufIn[0]) + iOffset;
+                T* out = static_cast<T*>(data->bufOut[0]) + oOffset;
+                for(size_t i = 0; i < half_N; ++i)
+                {
+                    out[2 * i * os]       = scale * in[i * is].real();
+                    out[(2 * i + 1) * os] = scale * in[i * is].imag();
+                }
+            }
+        }
+    });
+}
+
+std::vector<std::complex<double>>
+    host_bluestein_chirp(const size_t N, const size_t M, const int direction)
+{
+    std::vector<std::complex<double>> table(2 * M);
+
+    // exp(-direction * pi i t^2 / N), wrapped around so that the
+    // convolution with the padded data is circular
+    for(size_t t = 0; t < N; ++t)
+    {
+        const double theta = -direction * M_PI * double((t * t) % (2 * N)) / N;
+        table[t]           = std::polar(1.0, theta);
+        if(t > 0)
+            table[M - t] = table[t];
+    }
+
+    std::vector<std::complex<double>> x(table.begin(), table.begin() + M), y(M);
+    const auto* fft = host_fft(x.data(), y.data(), M, host_factors(M), direction);
+    std::copy(fft, fft + M, table.begin() + M);
+    return table;
+}
+
+// Bluestein pointwise multiplications by the chirp (pad and result) and
+// by its FFT, all using the plan's chirp table
+template <typename T>
+static void host_mul_pr(DeviceCallIn* data)
+{
+    const TreeNode& node = *data->node;
+
+    const size_t N = node.parent->length[0];
+    const size_t M = node.lengthBlue;
+
+    assert(node.hostChirp);
+    const auto& chirp = *node.hostChirp;
+
+    HostComplexBuffer<T> in(data->bufIn, node.inArrayType);
+    HostComplexBuffer<T> out(data->bufOut, node.outArrayType, node.scale);
+
+    const size_t is = node.inStride[0];
+    const size_t os = node.outStride[0];
+
+    const size_t rows = host_row_count(data, 1);
+    host_parallel_rows(data, rows, M, [&](const size_t begin, const size_t end) {
+        for(size_t row = begin; row < end; ++row)
+        {
+            size_t iOffset, oOffset;
+            host_row_offsets(node, 1, row, iOffset, oOffset);
+
+            if(node.scheme == CS_KERNEL_FFT_MUL)
+            {
+                for(size_t t = 0; t < M; ++t)
+                {
+                    const size_t oIdx = oOffset + t * os;
+                    out.write(oIdx, std::complex<T>(chirp[M + t]) * out.read(oIdx));
+                }
+            }
+            else if(node.scheme == CS_KERNEL_PAD_MUL)
+            {
+                for(size_t t = 0; t < M; ++t)
+                {
+                    std::complex<T> val = 0;
+                    if(t < N)
+                        val = in.read(iOffset + t * is) * std::complex<T>(std::conj(chirp[t]));
+                    out.write(oOffset + t * os, val);
+                }
+            }
+            else
+            {
+                const T MI = 1.0 / (T)M;
+                for(size_t t = 0; t < N; ++t)
+                    out.write(oOffset + t * os,
+                              MI * in.read(iOffset + t * is)
+                                  * std::complex<T>(std::conj(chirp[t])));
+            }
+        }
+    });
+}
+
+std::vector<std::complex<double>>
+    host_rader_kernel(const size_t N, const size_t g, const int direction)
+{
+    // exp(direction * 2 pi i g^-m / N), scaled so that the inverse FFT
+    // of the convolution needs no normalization
+    const size_t ginv = PowMod(g, N - 2, N);
+
+    std::vector<std::complex<double>> x(N - 1), y(N - 1);
+    for(size_t m = 0, gm = 1; m < N - 1; ++m, gm = gm * ginv % N)
+        x[m] = std::polar(1.0 / (N - 1), direction * 2 * M_PI * double(gm) / N);
+
+    const auto* fft = host_fft(x.data(), y.data(), N - 1, host_factors(N - 1), direction);
+    return std::vector<std::complex<double>>(fft, fft + N - 1);
+}
+
+// Rader permutations and pointwise multiplication by the FFT of the kernel.
+// Each length N row of the temp buffer holds the N-1 permuted inputs
+// followed by x[0], which the multiplication replaces by X[0].
+template <typename T>
+static void host_rader_pr(DeviceCallIn* data)
+{
+    const TreeNode& node = *data->node;
+
+    const size_t N    = node.length[0];
+    const size_t g    = node.raderRoot;
+    const size_t ginv = PowMod(g, N - 2, N);
+
+    HostComplexBuffer<T> in(data->bufIn, node.inArrayType);
+    HostComplexBuffer<T> out(data->bufOut, node.outArrayType, node.scale);
+
+    const size_t is = node.inStride[0];
+    const size_t os = node.outStride[0];
+
+    const size_t rows = host_row_count(data, 1);
+    host_parallel_rows(data, rows, N, [&](const size_t begin, const size_t end) {
+        for(size_t row = begin; row < end; ++row)
+        {
+            size_t iOffset, oOffset;
+            host_row_offsets(node, 1, row, iOffset, oOffset);
+
+            if(node.scheme == CS_KERNEL_RADER_PERMUTE)
+            {
+                for(size_t p = 0, gp = 1; p < N - 1; ++p, gp = gp * g % N)
+                    out.write(oOffset + p * os, in.read(iOffset + gp * is));
+                out.write(oOffset + (N - 1) * os, in.read(iOffset));
+            }
+            else if(node.scheme == CS_KERNEL_RADER_MUL)
+            {
+                const auto& kernel = *node.hostChirp;
+
+                const std::complex<T> x0 = in.read(iOffset + (N - 1) * is);
+                const std::complex<T> A0 = in.read(iOffset);
+                for(size_t q = 0; q < N - 1; ++q)
+                {
+                    const std::complex<T> val
+                        = in.read(iOffset + q * is) * std::complex<T>(kernel[q]);
+                    out.write(oOffset + q * os, (q == 0) ? val + x0 : val);
+                }
+                out.write(oOffset + (N - 1) * os, x0 + A0);
+            }
+            else
+            {
+                for(size_t q = 0, gq = 1; q < N - 1; ++q, gq = gq * ginv % N)
+                    out.write(oOffset + gq * os, in.read(iOffset + q * is));
+                out.write(oOffset, in.read(iOffset + (N - 1) * is));
+            }
+        }
+    });
+}
+
+void host_stockham(const void* data_p, void* back_p)
+{
+    DeviceCallIn* data = (DeviceCallIn*)data_p;
+    if(data->node->precision == rocfft_precision_single)
+        host_stockham_pr<float>(data);
+    else
+        host_stockham_pr<double>(data);
+}
+
+void host_single(const void* data_p, void* back_p)
+{
+    DeviceCallIn* data = (DeviceCallIn*)data_p;
+    if(data->node->precision == rocfft_precision_single)
+        host_single_pr<float>(data);
+    else
+        host_single_pr<double>(data);
+}
+
+void host_transpose(const void* data_p, void* back_p)
+{
+    DeviceCallIn* data = (DeviceCallIn*)data_p;
+    if(data->node->precision == rocfft_precision_single)
+        host_transpose_pr<float>(data);
+    else
+        host_transpose_pr<double>(data);
+}
+
+void host_transpose_inplace(const void* data_p, void* back_p)
+{
+    DeviceCallIn* data = (DeviceCallIn*)data_p;
+    if(data->node->precision == rocfft_precision_single)
+        host_transpose_inplace_pr<float>(data);
+    else
+        host_transpose_inplace_pr<double>(data);
+}
+
+void host_real2complex(const void* data_p, void* back_p)
+{
+    DeviceCallIn* data = (DeviceCallIn*)data_p;
+    if(data->node->precision == rocfft_precision_single)
+        host_real2complex_pr<float>(data);
+    else
+        host_real2complex_pr<double>(data);
+}
+
+void host_complex2hermitian(const void* data_p, void* back_p)
+{
+    DeviceCallIn* data = (DeviceCallIn*)data_p;
+    if(data->node->precision == rocfft_precision_single)
+        host_complex2hermitian_pr<float>(data);
+    else
+        host_complex2hermitian_pr<double>(data);
+}
+
+void host_complex2real(const void* data_p, void* back_p)
+{
+    DeviceCallIn* data = (DeviceCallIn*)data_p;
+    if(data->node->precision == rocfft_precision_single)
+        host_complex2real_pr<float>(data);
+    else
+        host_complex2real_pr<double>(data);
+}
+
+void host_hermitian2complex(const void* data_p, void* back_p)
+{
+    DeviceCallIn* data = (DeviceCallIn*)data_p;
+    if(data->node->precision == rocfft_precision_single)
+        host_hermitian2complex_pr<float>(data);
+    else
+        host_hermitian2complex_pr<double>(data);
+}
+
+void host_pair_real2complex(const void* data_p, void* back_p)
+{
+    DeviceCallIn* data = (DeviceCallIn*)data_p;
+    if(data->node->precision == rocfft_precision_single)
+        host_pair_real2complex_pr<float>(data);
+    else
+        host_pair_real2complex_pr<double>(data);
+}
+
+void host_pair_complex2hermitian(const void* data_p, void* back_p)
+{
+    DeviceCallIn* data = (DeviceCallIn*)data_p;
+    if(data->node->precision == rocfft_precision_single)
+        host_pair_complex2hermitian_pr<float>(data);
+    else
+        host_pair_complex2hermitian_pr<double>(data);
+}
+
+void host_pair_hermitian2complex(const void* data_p, void* back_p)
+{
+    DeviceCallIn* data = (DeviceCallIn*)data_p;
+    if(data->node->precision == rocfft_precision_single)
+        host_pair_hermitian2complex_pr<float>(data);
+    else
+        host_pair_hermitian2complex_pr<double>(data);
+}
+
+void host_pair_complex2real(const void* data_p, void* back_p)
+{
+    DeviceCallIn* data = (DeviceCallIn*)data_p;
+    if(data->node->precision == rocfft_precision_single)
+        host_pair_complex2real_pr<float>(data);
+    else
+        host_pair_complex2real_pr<double>(data);
+}
+
+void host_r2c_1d_post(const void* data_p, void* back_p)
+{
+    DeviceCallIn* data = (DeviceCallIn*)data_p;
+    if(data->node->precision == rocfft_precision_single)
+        host_real_1d_pre_post_pr<float, true>(data);
+    else
+        host_real_1d_pre_post_pr<double, true>(data);
+}
+
+void host_c2r_1d_pre(const void* data_p, void* back_p)
+{
+    DeviceCallIn* data = (DeviceCallIn*)data_p;
+    if(data->node->precision == rocfft_precision_single)
+        host_real_1d_pre_post_pr<float, false>(data);
+    else
+        host_real_1d_pre_post_pr<double, false>(data);
+}
+
+void host_r2c_1d_pack(const void* data_p, void* back_p)
+{
+    DeviceCallIn* data = (DeviceCallIn*)data_p;
+    if(data->node->precision == rocfft_precision_single)
+        host_real_1d_pack_pr<float, true>(data);
+    else
+        host_real_1d_pack_pr<double, true>(data);
+}
+
+void host_c2r_1d_unpack(const void* data_p, void* back_p)
+{
+    DeviceCallIn* data = (DeviceCallIn*)data_p;
+    if(data->node->precision == rocfft_precision_single)
+        host_real_1d_pack_pr<float, false>(data);
+    else
+        host_real_1d_pack_pr<double, false>(data);
+}
+
+void host_mul(const void* data_p, void* back_p)
+{
+    DeviceCallIn* data = (DeviceCallIn*)data_p;
+    if(data->node->precision == rocfft_precision_single)
+        host_mul_pr<float>(data);
+    else
+        host_mul_pr<double>(data);
+}
+
+void host_rader(const void* data_p, void* back_p)
+{
+    DeviceCallIn* data = (DeviceCallIn*)data_p;
+    if(data->node->precision == rocfft_precision_single)
+        host_rader_pr<float>(data);
+    else
+        host_rader_pr<double>(data);
+}
+
+DevFnCall host_function(const ComputeScheme scheme)
+{
+    switch(scheme)
+    {
+    case CS_KERNEL_STOCKHAM:
+    case CS_KERNEL_STOCKHAM_BLOCK_CC:
+    case CS_KERNEL_STOCKHAM_BLOCK_RC:
+    case CS_KERNEL_2D_STOCKHAM_BLOCK_CC:
+    case CS_KERNEL_3D_STOCKHAM_BLOCK_CC:
+        return &host_stockham;
+    case CS_KERNEL_2D_SINGLE:
+    case CS_KERNEL_3D_SINGLE:
+        return &host_single;
+    case CS_KERNEL_TRANSPOSE:
+    case CS_KERNEL_TRANSPOSE_XY_Z:
+    case CS_KERNEL_TRANSPOSE_Z_XY:
+        return &host_transpose;
+    case CS_KERNEL_TRANSPOSE_INPLACE:
+        return &host_transpose_inplace;
+    case CS_KERNEL_COPY_R_TO_CMPLX:
+        return &host_real2complex;
+    case CS_KERNEL_COPY_CMPLX_TO_R:
+        return &host_complex2real;
+    case CS_KERNEL_COPY_HERM_TO_CMPLX:
+        return &host_hermitian2complex;
+    case CS_KERNEL_COPY_CMPLX_TO_HERM:
+        return &host_complex2hermitian;
+    case CS_KERNEL_PAIR_R_TO_CMPLX:
+        return &host_pair_real2complex;
+    case CS_KERNEL_PAIR_CMPLX_TO_HERM:
+        return &host_pair_complex2hermitian;
+    case CS_KERNEL_PAIR_HERM_TO_CMPLX:
+        return &host_pair_hermitian2complex;
+    case CS_KERNEL_PAIR_CMPLX_TO_R:
+        return &host_pair_complex2real;
+    case CS_KERNEL_R_TO_CMPLX:
+        return &host_r2c_1d_post;
+    case CS_KERNEL_CMPLX_TO_R:
+        return &host_c2r_1d_pre;
+    case CS_KERNEL_PACK_R_TO_CMPLX:
+        return &host_r2c_1d_pack;
+    case CS_KERNEL_UNPACK_CMPLX_TO_R:
+        return &host_c2r_1d_unpack;
+    case CS_KERNEL_PAD_MUL:
+    case CS_KERNEL_FFT_MUL:
+    case CS_KERNEL_RES_MUL:
+        return &host_mul;
+    case CS_KERNEL_RADER_PERMUTE:
+    case CS_KERNEL_RADER_MUL:
+    case CS_KERNEL_RADER_UNPERMUTE:
+        return &host_rader;
+    default:
+        return nullptr;
+    }
+}
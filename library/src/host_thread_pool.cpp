@@ -0,0 +1,189 @@
+/******************************************************************************
+* Copyright (c) 2016 - present Advanced Micro Devices, Inc. All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*******************************************************************************/
+
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "host_thread_pool.h"
+
+size_t HostThreadPool::DefaultThreadCount()
+{
+    static const size_t count = []() -> size_t {
+        const char* str_threads = getenv("ROCFFT_HOST_THREADS");
+        if(str_threads)
+        {
+            const long n = strtol(str_threads, nullptr, 10);
+            if(n > 0)
+                return n;
+        }
+        const size_t hw = std::thread::hardware_concurrency();
+        return hw ? hw : 1;
+    }();
+    return count;
+}
+
+HostThreadPool::~HostThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lck(mtx);
+        quit = true;
+    }
+    cvStart.notify_all();
+    for(auto& w : workers)
+        w.join();
+}
+
+void HostThreadPool::ParallelFor(size_t count, size_t numThreads, const RangeFn& func)
+{
+    if(numThreads == 0)
+        numThreads = DefaultThreadCount();
+    numThreads = std::min(numThreads, count);
+    if(numThreads <= 1)
+    {
+        if(count)
+            func(0, count);
+        return;
+    }
+
+    std::lock_guard<std::mutex> jobLck(jobMtx);
+
+    Job j;
+    j.func       = &func;
+    j.numThreads = numThreads;
+    // small enough grains to balance the load, large enough to amortize
+    // the locking
+    j.grain  = std::max<size_t>(1, count / (numThreads * 16));
+    j.active = numThreads - 1;
+    for(size_t t = 0; t < numThreads; ++t)
+    {
+        j.shares.emplace_back(new Share);
+        j.shares[t]->begin = count * t / numThreads;
+        j.shares[t]->end   = count * (t + 1) / numThreads;
+    }
+
+    {
+        std::lock_guard<std::mutex> lck(mtx);
+        while(workers.size() < numThreads - 1)
+            workers.emplace_back(&HostThreadPool::WorkerLoop, this, workers.size() + 1);
+        job = &j;
+        ++generation;
+    }
+    cvStart.notify_all();
+
+    Run(j, 0);
+
+    std::unique_lock<std::mutex> lck(mtx);
+    cvDone.wait(lck, [&j]() { return j.active == 0; });
+    job = nullptr;
+}
+
+void HostThreadPool::WorkerLoop(size_t id)
+{
+    size_t seen = 0;
+    while(true)
+    {
+        Job* j = nullptr;
+        {
+            std::unique_lock<std::mutex> lck(mtx);
+            cvStart.wait(lck, [this, &seen]() { return quit || generation != seen; });
+            if(quit)
+                return;
+            seen = generation;
+            // decide under the lock whether to take part: ParallelFor only
+            // waits for the participants, so the job of a late worker
+            // outside them may already be gone
+            if(job && (id < job->numThreads))
+                j = job;
+        }
+
+        if(j)
+        {
+            Run(*j, id);
+            // j may be gone as soon as active drops to 0
+            if(--j->active == 0)
+            {
+                std::lock_guard<std::mutex> lck(mtx);
+                cvDone.notify_all();
+            }
+        }
+    }
+}
+
+void HostThreadPool::Run(Job& job, size_t id)
+{
+    size_t begin, end;
+    while(Take(job, id, begin, end))
+        (*job.func)(begin, end);
+}
+
+bool HostThreadPool::Take(Job& job, size_t id, size_t& begin, size_t& end)
+{
+    while(true)
+    {
+        {
+            Share&                      own = *job.shares[id];
+            std::lock_guard<std::mutex> lck(own.mtx);
+            if(own.begin < own.end)
+            {
+                begin     = own.begin;
+                end       = std::min(own.end, begin + job.grain);
+                own.begin = end;
+                return true;
+            }
+        }
+
+        // own share is empty: steal the back half of the largest share
+        size_t victim = id;
+        size_t most   = 0;
+        for(size_t t = 0; t < job.numThreads; ++t)
+        {
+            if(t == id)
+                continue;
+            Share&                      other = *job.shares[t];
+            std::lock_guard<std::mutex> lck(other.mtx);
+            if(other.end - other.begin > most)
+            {
+                most   = other.end - other.begin;
+                victim = t;
+            }
+        }
+        if(most == 0)
+            return false;
+
+        size_t stolenBegin, stolenEnd;
+        {
+            Share&                      other = *job.shares[victim];
+            std::lock_guard<std::mutex> lck(other.mtx);
+            if(other.end <= other.begin)
+                continue;
+            stolenEnd   = other.end;
+            stolenBegin = other.end - (other.end - other.begin + 1) / 2;
+            other.end   = stolenBegin;
+        }
+
+        Share&                      own = *job.shares[id];
+        std::lock_guard<std::mutex> lck(own.mtx);
+        own.begin = stolenBegin;
+        own.end   = stolenEnd;
+    }
+}
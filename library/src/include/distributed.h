@@ -0,0 +1,107 @@
+/******************************************************************************
+* Copyright (c) 2016 - present Advanced Micro Devices, Inc. All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*******************************************************************************/
+
+
+#ifndef DISTRIBUTED_H
+#define DISTRIBUTED_H
+
+#include <array>
+#include <vector>
+
+#include "rocfft.h"
+
+// Moves data between the ranks of a distributed plan
+struct rocfft_transport_t
+{
+    size_t rank;
+    size_t numRanks;
+
+    rocfft_transport_t(size_t rank, size_t numRanks)
+        : rank(rank)
+        , numRanks(numRanks)
+    {
+    }
+    virtual ~rocfft_transport_t() = default;
+
+    // Exchange bytesPerRank bytes with each member of group, which lists
+    // ranks in ascending order including this one: block i of send goes to
+    // group[i] and block i of recv comes from group[i].
+    virtual rocfft_status Exchange(const std::vector<size_t>& group,
+                                   const void*                send,
+                                   void*                      recv,
+                                   size_t                     bytesPerRank)
+        = 0;
+};
+
+// Part of the global 3D array held by one rank at one stage of a distributed
+// transform, stored densely with dimension order[0] fastest and order[2]
+// slowest.
+struct DistBrick
+{
+    std::array<size_t, 3> start;
+    std::array<size_t, 3> count;
+    std::array<size_t, 3> order;
+
+    size_t Stride(size_t dim) const;
+    size_t Size() const
+    {
+        return count[0] * count[1] * count[2];
+    }
+};
+
+// Local transform of the fftDims fastest dimensions of a brick, followed by
+// an exchange into the brick of the next stage unless it is the last one.
+// The exchange is split into chunks along the slowest dimension so that the
+// transform of one chunk runs while the previous one is in flight.
+struct DistStage
+{
+    DistBrick brick;
+    size_t    fftDims = 1;
+    size_t    chunks  = 1;
+    // transforms one chunk in-place, or for the last stage the whole brick
+    // into the output buffer
+    rocfft_plan plan = nullptr;
+
+    std::vector<size_t>    group; // ranks taking part in the exchange
+    std::vector<DistBrick> groupBricks; // brick of each member at this stage
+    std::vector<DistBrick> nextBricks; // brick of each member at the next stage
+};
+
+struct rocfft_distributed_plan_t
+{
+    std::array<size_t, 3> lengths;
+    rocfft_transform_type transformType;
+    rocfft_precision      precision;
+    rocfft_transport      transport;
+    size_t                elemSize; // bytes of a complex element
+
+    std::vector<DistStage> stages;
+    size_t                 workBufferSize = 0;
+
+    // host staging buffers of the exchanges, sized on first use
+    std::vector<char> hostChunk;
+    std::vector<char> hostNext;
+    std::vector<char> send[2];
+    std::vector<char> recv[2];
+};
+
+#endif // DISTRIBUTED_H
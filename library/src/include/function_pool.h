@@ -24,7 +24,9 @@
 #define FUNCTION_POOL_H
 
 #include "tree_node.h"
+#include <map>
 #include <unordered_map>
+#include <vector>
 
 struct SimpleHash
 {
@@ -47,6 +49,12 @@ class function_pool
     std::unordered_map<Key, DevFnCall, SimpleHash> function_map_single;
     std::unordered_map<Key, DevFnCall, SimpleHash> function_map_double;
 
+    // fused CS_KERNEL_2D_SINGLE and CS_KERNEL_3D_SINGLE kernels, keyed by
+    // the lengths of their dimensions
+    using ShapeKey = std::vector<size_t>;
+    std::map<ShapeKey, DevFnCall> shape_map_single;
+    std::map<ShapeKey, DevFnCall> shape_map_double;
+
     function_pool();
 
 public:
@@ -77,6 +85,18 @@ public:
         return func_pool.function_map_double.at(mykey);
     }
 
+    static DevFnCall get_shape_function_single(const ShapeKey& shape)
+    {
+        function_pool& func_pool = get_function_pool();
+        return func_pool.shape_map_single.at(shape);
+    }
+
+    static DevFnCall get_shape_function_double(const ShapeKey& shape)
+    {
+        function_pool& func_pool = get_function_pool();
+        return func_pool.shape_map_double.at(shape);
+    }
+
     static void verify_no_null_functions()
     {
         function_pool& func_pool = get_function_pool();
@@ -100,6 +120,24 @@ public:
                 std::cout << "null ptr registered in function_map_double" << std::endl;
             }
         }
+
+        for(auto it = func_pool.shape_map_single.begin(); it != func_pool.shape_map_single.end();
+            ++it)
+        {
+            if(it->second == nullptr)
+            {
+                std::cout << "null ptr registered in shape_map_single" << std::endl;
+            }
+        }
+
+        for(auto it = func_pool.shape_map_double.begin(); it != func_pool.shape_map_double.end();
+            ++it)
+        {
+            if(it->second == nullptr)
+            {
+                std::cout << "null ptr registered in shape_map_double" << std::endl;
+            }
+        }
     }
 };
 
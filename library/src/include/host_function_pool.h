@@ -0,0 +1,74 @@
+/******************************************************************************
+* Copyright (c) 2016 - present Advanced Micro Devices, Inc. All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*******************************************************************************/
+
+
+#ifndef HOST_FUNCTION_POOL_H
+#define HOST_FUNCTION_POOL_H
+
+#include <cstddef>
+#include <map>
+#include <utility>
+
+// Generated host Stockham kernel: transforms the split real/imag vector
+// (re, im) in place, using (tre, tim) as scratch.  tw holds the interleaved
+// twiddles exp(-2 pi i k / N), k = 0, ..., N - 1.
+template <typename T>
+using HostFnCall = void (*)(T* re, T* im, T* tre, T* tim, const T* tw);
+
+class host_function_pool
+{
+    using Key = std::pair<size_t, int>; // length, direction
+    std::map<Key, HostFnCall<float>>  function_map_single;
+    std::map<Key, HostFnCall<double>> function_map_double;
+
+    host_function_pool();
+
+public:
+    host_function_pool(const host_function_pool&) = delete;
+    host_function_pool& operator=(const host_function_pool&) = delete;
+
+    static host_function_pool& get_function_pool()
+    {
+        static host_function_pool func_pool;
+        return func_pool;
+    }
+
+    ~host_function_pool() {}
+
+    // unlike function_pool, lengths without a generated kernel are not an
+    // error: the host backend falls back to its generic implementation
+    static HostFnCall<float> get_function_single(Key mykey)
+    {
+        host_function_pool& func_pool = get_function_pool();
+        auto                it        = func_pool.function_map_single.find(mykey);
+        return (it == func_pool.function_map_single.end()) ? nullptr : it->second;
+    }
+
+    static HostFnCall<double> get_function_double(Key mykey)
+    {
+        host_function_pool& func_pool = get_function_pool();
+        auto                it        = func_pool.function_map_double.find(mykey);
+        return (it == func_pool.function_map_double.end()) ? nullptr : it->second;
+    }
+};
+
+#endif // HOST_FUNCTION_POOL_H
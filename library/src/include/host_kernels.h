@@ -0,0 +1,86 @@
+/******************************************************************************
+* Copyright (c) 2016 - present Advanced Micro Devices, Inc. All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*******************************************************************************/
+
+
+#ifndef HOST_KERNELS_H
+#define HOST_KERNELS_H
+
+#include "tree_node.h"
+#include <complex>
+#include <vector>
+
+// Host implementations of the leaf nodes of a plan.  They take the
+// same DeviceCallIn/DeviceCallOut arguments as the device launchers,
+// but the buffers in DeviceCallIn are host pointers and no device
+// side data (twiddles, kernel arguments) is touched.
+
+void host_stockham(const void* data, void* back);
+
+void host_single(const void* data, void* back);
+
+void host_transpose(const void* data, void* back);
+
+void host_transpose_inplace(const void* data, void* back);
+
+void host_real2complex(const void* data, void* back);
+
+void host_complex2hermitian(const void* data, void* back);
+
+void host_complex2real(const void* data, void* back);
+
+void host_hermitian2complex(const void* data, void* back);
+
+void host_pair_real2complex(const void* data, void* back);
+
+void host_pair_complex2hermitian(const void* data, void* back);
+
+void host_pair_hermitian2complex(const void* data, void* back);
+
+void host_pair_complex2real(const void* data, void* back);
+
+void host_r2c_1d_post(const void* data, void* back);
+
+void host_c2r_1d_pre(const void* data, void* back);
+
+void host_r2c_1d_pack(const void* data, void* back);
+
+void host_c2r_1d_unpack(const void* data, void* back);
+
+void host_mul(const void* data, void* back);
+
+void host_rader(const void* data, void* back);
+
+// The Bluestein chirp of a length N transform padded to M, followed by its
+// FFT, in double precision.  host_chirp_create keeps one per (N, M,
+// direction) for the plans using it.
+std::vector<std::complex<double>> host_bluestein_chirp(size_t N, size_t M, int direction);
+
+// The FFT of the Rader kernel of a prime length N transform with primitive
+// root g, scaled by 1 / (N - 1), in double precision.  host_rader_create
+// keeps one per (N, g, direction).
+std::vector<std::complex<double>> host_rader_kernel(size_t N, size_t g, int direction);
+
+// Return the host function for a leaf compute scheme, or nullptr if
+// the scheme is not a leaf.
+DevFnCall host_function(const ComputeScheme scheme);
+
+#endif // HOST_KERNELS_H
@@ -0,0 +1,98 @@
+/******************************************************************************
+* Copyright (c) 2016 - present Advanced Micro Devices, Inc. All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*******************************************************************************/
+
+
+#ifndef HOST_THREAD_POOL_H
+#define HOST_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Work-stealing pool of host threads used by the host backend.  A job is a
+// range of independent items (rows of a leaf node); every participating
+// thread starts on its own contiguous share of the range, takes grains from
+// the front of it, and once it runs dry steals the back half of the largest
+// remaining share of another thread.  ParallelFor returns when all items are
+// done, so consecutive calls are separated by a barrier.
+class HostThreadPool
+{
+public:
+    using RangeFn = std::function<void(size_t begin, size_t end)>;
+
+    HostThreadPool(const HostThreadPool&) = delete;
+    HostThreadPool& operator=(const HostThreadPool&) = delete;
+    ~HostThreadPool();
+
+    static HostThreadPool& GetPool()
+    {
+        static HostThreadPool pool;
+        return pool;
+    }
+
+    // Number of threads used when none is set in the execution info, taken
+    // from the environment variable ROCFFT_HOST_THREADS or the hardware.
+    static size_t DefaultThreadCount();
+
+    // Run func over [0, count) on up to numThreads threads, the calling
+    // thread included; 0 threads means DefaultThreadCount().
+    void ParallelFor(size_t count, size_t numThreads, const RangeFn& func);
+
+private:
+    // Remaining part [begin, end) of the share of one thread
+    struct Share
+    {
+        std::mutex mtx;
+        size_t     begin = 0;
+        size_t     end   = 0;
+    };
+
+    struct Job
+    {
+        const RangeFn*                      func       = nullptr;
+        size_t                              numThreads = 0;
+        size_t                              grain      = 1;
+        std::vector<std::unique_ptr<Share>> shares;
+        std::atomic<size_t>                 active{0}; // participating workers still running
+    };
+
+    HostThreadPool() = default;
+
+    void WorkerLoop(size_t id);
+    void Run(Job& job, size_t id);
+    bool Take(Job& job, size_t id, size_t& begin, size_t& end);
+
+    std::mutex               jobMtx; // serializes ParallelFor calls
+    std::mutex               mtx;
+    std::condition_variable  cvStart;
+    std::condition_variable  cvDone;
+    std::vector<std::thread> workers;
+    Job*                     job        = nullptr;
+    size_t                   generation = 0;
+    bool                     quit       = false;
+};
+
+#endif // HOST_THREAD_POOL_H
@@ -29,6 +29,8 @@
 
 #define KERN_ARGS_ARRAY_WIDTH 16
 
+// Device copy of the lengths, strides and distances of a node, or nullptr if
+// it cannot be allocated on the device
 size_t* kargs_create(std::vector<size_t> length,
                      std::vector<size_t> inStride,
                      std::vector<size_t> outStride,
@@ -42,6 +42,8 @@ struct DeviceCallIn
 
     hipStream_t rocfft_stream;
     GridParam   gridParam;
+    size_t      hostThreads; // number of threads used by the host backend
+    size_t      batch; // batch members of this launch, part of node->batch if split
 };
 
 struct DeviceCallOut
@@ -77,8 +79,27 @@ bcc - block column column
 */
 
 void rocfft_internal_mul(const void* data_p, void* back_p);
-void rocfft_internal_chirp(const void* data_p, void* back_p);
+void rocfft_internal_rader(const void* data_p, void* back_p);
+
+// Plan-time table kernels: the chirp of a length N Bluestein transform padded
+// to M, from the large twiddles of length 2N, and the kernel of a length N
+// Rader transform with primitive root g, both written to the start of the
+// given device buffer
+void rocfft_internal_chirp(size_t           N,
+                           size_t           M,
+                           int              dir,
+                           rocfft_precision precision,
+                           void*            chirp,
+                           void*            twiddles_large,
+                           hipStream_t      rocfft_stream);
+void rocfft_internal_rader_kernel(size_t           N,
+                                  size_t           g,
+                                  int              dir,
+                                  rocfft_precision precision,
+                                  void*            kernel,
+                                  hipStream_t      rocfft_stream);
 void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
+void rocfft_internal_transpose_inplace(const void* data_p, void* back_p);
 }
 
 /*
@@ -126,7 +147,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                            data->node->length.size(),                              \
                                            data->node->devKernArg,                                 \
                                            data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,     \
-                                           data->node->batch,                                      \
+                                           data->batch,                                            \
+                                           (real_type_t<PRECISION>)data->node->scale,              \
                                            (PRECISION*)data->bufIn[0]);                            \
                     }                                                                              \
                     else if((data->node->inArrayType == rocfft_array_type_complex_planar           \
@@ -144,7 +166,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                            data->node->length.size(),                              \
                                            data->node->devKernArg,                                 \
                                            data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,     \
-                                           data->node->batch,                                      \
+                                           data->batch,                                            \
+                                           (real_type_t<PRECISION>)data->node->scale,              \
                                            (real_type_t<PRECISION>*)data->bufIn[0],                \
                                            (real_type_t<PRECISION>*)data->bufIn[1]);               \
                     }                                                                              \
@@ -166,7 +189,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                            data->node->length.size(),                              \
                                            data->node->devKernArg,                                 \
                                            data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,     \
-                                           data->node->batch,                                      \
+                                           data->batch,                                            \
+                                           (real_type_t<PRECISION>)data->node->scale,              \
                                            (PRECISION*)data->bufIn[0]);                            \
                     }                                                                              \
                     else if((data->node->inArrayType == rocfft_array_type_complex_planar           \
@@ -184,7 +208,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                            data->node->length.size(),                              \
                                            data->node->devKernArg,                                 \
                                            data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,     \
-                                           data->node->batch,                                      \
+                                           data->batch,                                            \
+                                           (real_type_t<PRECISION>)data->node->scale,              \
                                            (real_type_t<PRECISION>*)data->bufIn[0],                \
                                            (real_type_t<PRECISION>*)data->bufIn[1]);               \
                     }                                                                              \
@@ -210,7 +235,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->length.size(),                                             \
                             data->node->devKernArg,                                                \
                             data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,                    \
-                            data->node->batch,                                                     \
+                            data->batch,                                                           \
+                            (real_type_t<PRECISION>)data->node->scale,                             \
                             (PRECISION*)data->bufIn[0]);                                           \
                     }                                                                              \
                     else if((data->node->inArrayType == rocfft_array_type_complex_planar           \
@@ -229,7 +255,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->length.size(),                                             \
                             data->node->devKernArg,                                                \
                             data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,                    \
-                            data->node->batch,                                                     \
+                            data->batch,                                                           \
+                            (real_type_t<PRECISION>)data->node->scale,                             \
                             (real_type_t<PRECISION>*)data->bufIn[0],                               \
                             (real_type_t<PRECISION>*)data->bufIn[1]);                              \
                     }                                                                              \
@@ -252,7 +279,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->length.size(),                                             \
                             data->node->devKernArg,                                                \
                             data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,                    \
-                            data->node->batch,                                                     \
+                            data->batch,                                                           \
+                            (real_type_t<PRECISION>)data->node->scale,                             \
                             (PRECISION*)data->bufIn[0]);                                           \
                     }                                                                              \
                     else if((data->node->inArrayType == rocfft_array_type_complex_planar           \
@@ -271,7 +299,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->length.size(),                                             \
                             data->node->devKernArg,                                                \
                             data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,                    \
-                            data->node->batch,                                                     \
+                            data->batch,                                                           \
+                            (real_type_t<PRECISION>)data->node->scale,                             \
                             (real_type_t<PRECISION>*)data->bufIn[0],                               \
                             (real_type_t<PRECISION>*)data->bufIn[1]);                              \
                     }                                                                              \
@@ -300,7 +329,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                            data->node->devKernArg,                                 \
                                            data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,     \
                                            data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,     \
-                                           data->node->batch,                                      \
+                                           data->batch,                                            \
+                                           (real_type_t<PRECISION>)data->node->scale,              \
                                            (PRECISION*)data->bufIn[0],                             \
                                            (PRECISION*)data->bufOut[0]);                           \
                     }                                                                              \
@@ -321,7 +351,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                            data->node->devKernArg,                                 \
                                            data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,     \
                                            data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,     \
-                                           data->node->batch,                                      \
+                                           data->batch,                                            \
+                                           (real_type_t<PRECISION>)data->node->scale,              \
                                            (PRECISION*)data->bufIn[0],                             \
                                            (real_type_t<PRECISION>*)data->bufOut[0],               \
                                            (real_type_t<PRECISION>*)data->bufOut[1]);              \
@@ -342,7 +373,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                            data->node->devKernArg,                                 \
                                            data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,     \
                                            data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,     \
-                                           data->node->batch,                                      \
+                                           data->batch,                                            \
+                                           (real_type_t<PRECISION>)data->node->scale,              \
                                            (real_type_t<PRECISION>*)data->bufIn[0],                \
                                            (real_type_t<PRECISION>*)data->bufIn[1],                \
                                            (PRECISION*)data->bufOut[0]);                           \
@@ -363,7 +395,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                            data->node->devKernArg,                                 \
                                            data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,     \
                                            data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,     \
-                                           data->node->batch,                                      \
+                                           data->batch,                                            \
+                                           (real_type_t<PRECISION>)data->node->scale,              \
                                            (real_type_t<PRECISION>*)data->bufIn[0],                \
                                            (real_type_t<PRECISION>*)data->bufIn[1],                \
                                            (real_type_t<PRECISION>*)data->bufOut[0],               \
@@ -388,7 +421,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                            data->node->devKernArg,                                 \
                                            data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,     \
                                            data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,     \
-                                           data->node->batch,                                      \
+                                           data->batch,                                            \
+                                           (real_type_t<PRECISION>)data->node->scale,              \
                                            (PRECISION*)data->bufIn[0],                             \
                                            (PRECISION*)data->bufOut[0]);                           \
                     }                                                                              \
@@ -409,7 +443,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                            data->node->devKernArg,                                 \
                                            data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,     \
                                            data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,     \
-                                           data->node->batch,                                      \
+                                           data->batch,                                            \
+                                           (real_type_t<PRECISION>)data->node->scale,              \
                                            (PRECISION*)data->bufIn[0],                             \
                                            (real_type_t<PRECISION>*)data->bufOut[0],               \
                                            (real_type_t<PRECISION>*)data->bufOut[1]);              \
@@ -430,7 +465,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                            data->node->devKernArg,                                 \
                                            data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,     \
                                            data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,     \
-                                           data->node->batch,                                      \
+                                           data->batch,                                            \
+                                           (real_type_t<PRECISION>)data->node->scale,              \
                                            (real_type_t<PRECISION>*)data->bufIn[0],                \
                                            (real_type_t<PRECISION>*)data->bufIn[1],                \
                                            (PRECISION*)data->bufOut[0]);                           \
@@ -451,7 +487,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                            data->node->devKernArg,                                 \
                                            data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,     \
                                            data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,     \
-                                           data->node->batch,                                      \
+                                           data->batch,                                            \
+                                           (real_type_t<PRECISION>)data->node->scale,              \
                                            (real_type_t<PRECISION>*)data->bufIn[0],                \
                                            (real_type_t<PRECISION>*)data->bufIn[1],                \
                                            (real_type_t<PRECISION>*)data->bufOut[0],               \
@@ -480,7 +517,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->devKernArg,                                                \
                             data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,                    \
                             data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,                    \
-                            data->node->batch,                                                     \
+                            data->batch,                                                           \
+                            (real_type_t<PRECISION>)data->node->scale,                             \
                             (PRECISION*)data->bufIn[0],                                            \
                             (PRECISION*)data->bufOut[0]);                                          \
                     }                                                                              \
@@ -502,7 +540,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->devKernArg,                                                \
                             data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,                    \
                             data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,                    \
-                            data->node->batch,                                                     \
+                            data->batch,                                                           \
+                            (real_type_t<PRECISION>)data->node->scale,                             \
                             (PRECISION*)data->bufIn[0],                                            \
                             (real_type_t<PRECISION>*)data->bufOut[0],                              \
                             (real_type_t<PRECISION>*)data->bufOut[1]);                             \
@@ -524,7 +563,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->devKernArg,                                                \
                             data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,                    \
                             data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,                    \
-                            data->node->batch,                                                     \
+                            data->batch,                                                           \
+                            (real_type_t<PRECISION>)data->node->scale,                             \
                             (real_type_t<PRECISION>*)data->bufIn[0],                               \
                             (real_type_t<PRECISION>*)data->bufIn[1],                               \
                             (PRECISION*)data->bufOut[0]);                                          \
@@ -546,7 +586,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->devKernArg,                                                \
                             data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,                    \
                             data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,                    \
-                            data->node->batch,                                                     \
+                            data->batch,                                                           \
+                            (real_type_t<PRECISION>)data->node->scale,                             \
                             (real_type_t<PRECISION>*)data->bufIn[0],                               \
                             (real_type_t<PRECISION>*)data->bufIn[1],                               \
                             (real_type_t<PRECISION>*)data->bufOut[0],                              \
@@ -572,7 +613,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->devKernArg,                                                \
                             data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,                    \
                             data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,                    \
-                            data->node->batch,                                                     \
+                            data->batch,                                                           \
+                            (real_type_t<PRECISION>)data->node->scale,                             \
                             (PRECISION*)data->bufIn[0],                                            \
                             (PRECISION*)data->bufOut[0]);                                          \
                     }                                                                              \
@@ -594,7 +636,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->devKernArg,                                                \
                             data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,                    \
                             data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,                    \
-                            data->node->batch,                                                     \
+                            data->batch,                                                           \
+                            (real_type_t<PRECISION>)data->node->scale,                             \
                             (PRECISION*)data->bufIn[0],                                            \
                             (real_type_t<PRECISION>*)data->bufOut[0],                              \
                             (real_type_t<PRECISION>*)data->bufOut[1]);                             \
@@ -616,7 +659,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->devKernArg,                                                \
                             data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,                    \
                             data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,                    \
-                            data->node->batch,                                                     \
+                            data->batch,                                                           \
+                            (real_type_t<PRECISION>)data->node->scale,                             \
                             (real_type_t<PRECISION>*)data->bufIn[0],                               \
                             (real_type_t<PRECISION>*)data->bufIn[1],                               \
                             (PRECISION*)data->bufOut[0]);                                          \
@@ -638,7 +682,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->devKernArg,                                                \
                             data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,                    \
                             data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,                    \
-                            data->node->batch,                                                     \
+                            data->batch,                                                           \
+                            (real_type_t<PRECISION>)data->node->scale,                             \
                             (real_type_t<PRECISION>*)data->bufIn[0],                               \
                             (real_type_t<PRECISION>*)data->bufIn[1],                               \
                             (real_type_t<PRECISION>*)data->bufOut[0],                              \
@@ -672,7 +717,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                    data->node->devKernArg,                                       \
                                    data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,           \
                                    data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,           \
-                                   data->node->batch,                                            \
+                                   data->batch,                                                  \
+                                   (real_type_t<PRECISION>)data->node->scale,                    \
                                    (PRECISION*)data->bufIn[0],                                   \
                                    (PRECISION*)data->bufOut[0]);                                 \
             }                                                                                    \
@@ -692,7 +738,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                    data->node->devKernArg,                                       \
                                    data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,           \
                                    data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,           \
-                                   data->node->batch,                                            \
+                                   data->batch,                                                  \
+                                   (real_type_t<PRECISION>)data->node->scale,                    \
                                    (PRECISION*)data->bufIn[0],                                   \
                                    (real_type_t<PRECISION>*)data->bufOut[0],                     \
                                    (real_type_t<PRECISION>*)data->bufOut[1]);                    \
@@ -713,7 +760,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                    data->node->devKernArg,                                       \
                                    data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,           \
                                    data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,           \
-                                   data->node->batch,                                            \
+                                   data->batch,                                                  \
+                                   (real_type_t<PRECISION>)data->node->scale,                    \
                                    (real_type_t<PRECISION>*)data->bufIn[0],                      \
                                    (real_type_t<PRECISION>*)data->bufIn[1],                      \
                                    (PRECISION*)data->bufOut[0]);                                 \
@@ -734,7 +782,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                    data->node->devKernArg,                                       \
                                    data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,           \
                                    data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,           \
-                                   data->node->batch,                                            \
+                                   data->batch,                                                  \
+                                   (real_type_t<PRECISION>)data->node->scale,                    \
                                    (real_type_t<PRECISION>*)data->bufIn[0],                      \
                                    (real_type_t<PRECISION>*)data->bufIn[1],                      \
                                    (real_type_t<PRECISION>*)data->bufOut[0],                     \
@@ -759,7 +808,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                    data->node->devKernArg,                                       \
                                    data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,           \
                                    data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,           \
-                                   data->node->batch,                                            \
+                                   data->batch,                                                  \
+                                   (real_type_t<PRECISION>)data->node->scale,                    \
                                    (PRECISION*)data->bufIn[0],                                   \
                                    (PRECISION*)data->bufOut[0]);                                 \
             }                                                                                    \
@@ -779,7 +829,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                    data->node->devKernArg,                                       \
                                    data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,           \
                                    data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,           \
-                                   data->node->batch,                                            \
+                                   data->batch,                                                  \
+                                   (real_type_t<PRECISION>)data->node->scale,                    \
                                    (PRECISION*)data->bufIn[0],                                   \
                                    (real_type_t<PRECISION>*)data->bufOut[0],                     \
                                    (real_type_t<PRECISION>*)data->bufOut[1]);                    \
@@ -800,7 +851,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                    data->node->devKernArg,                                       \
                                    data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,           \
                                    data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,           \
-                                   data->node->batch,                                            \
+                                   data->batch,                                                  \
+                                   (real_type_t<PRECISION>)data->node->scale,                    \
                                    (real_type_t<PRECISION>*)data->bufIn[0],                      \
                                    (real_type_t<PRECISION>*)data->bufIn[1],                      \
                                    (PRECISION*)data->bufOut[0]);                                 \
@@ -821,7 +873,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                    data->node->devKernArg,                                       \
                                    data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,           \
                                    data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,           \
-                                   data->node->batch,                                            \
+                                   data->batch,                                                  \
+                                   (real_type_t<PRECISION>)data->node->scale,                    \
                                    (real_type_t<PRECISION>*)data->bufIn[0],                      \
                                    (real_type_t<PRECISION>*)data->bufIn[1],                      \
                                    (real_type_t<PRECISION>*)data->bufOut[0],                     \
@@ -852,7 +905,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                    data->node->devKernArg,                                       \
                                    data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,           \
                                    data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,           \
-                                   data->node->batch,                                            \
+                                   data->batch,                                                  \
+                                   (real_type_t<PRECISION>)data->node->scale,                    \
                                    (PRECISION*)data->bufIn[0],                                   \
                                    (PRECISION*)data->bufOut[0]);                                 \
             }                                                                                    \
@@ -871,7 +925,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                    data->node->devKernArg,                                       \
                                    data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,           \
                                    data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,           \
-                                   data->node->batch,                                            \
+                                   data->batch,                                                  \
+                                   (real_type_t<PRECISION>)data->node->scale,                    \
                                    (PRECISION*)data->bufIn[0],                                   \
                                    (real_type_t<PRECISION>*)data->bufOut[0],                     \
                                    (real_type_t<PRECISION>*)data->bufOut[1]);                    \
@@ -891,7 +946,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                    data->node->devKernArg,                                       \
                                    data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,           \
                                    data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,           \
-                                   data->node->batch,                                            \
+                                   data->batch,                                                  \
+                                   (real_type_t<PRECISION>)data->node->scale,                    \
                                    (real_type_t<PRECISION>*)data->bufIn[0],                      \
                                    (real_type_t<PRECISION>*)data->bufIn[1],                      \
                                    (PRECISION*)data->bufOut[0]);                                 \
@@ -911,7 +967,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                    data->node->devKernArg,                                       \
                                    data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,           \
                                    data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,           \
-                                   data->node->batch,                                            \
+                                   data->batch,                                                  \
+                                   (real_type_t<PRECISION>)data->node->scale,                    \
                                    (real_type_t<PRECISION>*)data->bufIn[0],                      \
                                    (real_type_t<PRECISION>*)data->bufIn[1],                      \
                                    (real_type_t<PRECISION>*)data->bufOut[0],                     \
@@ -935,7 +992,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                    data->node->devKernArg,                                       \
                                    data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,           \
                                    data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,           \
-                                   data->node->batch,                                            \
+                                   data->batch,                                                  \
+                                   (real_type_t<PRECISION>)data->node->scale,                    \
                                    (PRECISION*)data->bufIn[0],                                   \
                                    (PRECISION*)data->bufOut[0]);                                 \
             }                                                                                    \
@@ -954,7 +1012,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                    data->node->devKernArg,                                       \
                                    data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,           \
                                    data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,           \
-                                   data->node->batch,                                            \
+                                   data->batch,                                                  \
+                                   (real_type_t<PRECISION>)data->node->scale,                    \
                                    (PRECISION*)data->bufIn[0],                                   \
                                    (real_type_t<PRECISION>*)data->bufOut[0],                     \
                                    (real_type_t<PRECISION>*)data->bufOut[1]);                    \
@@ -974,7 +1033,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                    data->node->devKernArg,                                       \
                                    data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,           \
                                    data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,           \
-                                   data->node->batch,                                            \
+                                   data->batch,                                                  \
+                                   (real_type_t<PRECISION>)data->node->scale,                    \
                                    (real_type_t<PRECISION>*)data->bufIn[0],                      \
                                    (real_type_t<PRECISION>*)data->bufIn[1],                      \
                                    (PRECISION*)data->bufOut[0]);                                 \
@@ -994,7 +1054,166 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                    data->node->devKernArg,                                       \
                                    data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,           \
                                    data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,           \
-                                   data->node->batch,                                            \
+                                   data->batch,                                                  \
+                                   (real_type_t<PRECISION>)data->node->scale,                    \
+                                   (real_type_t<PRECISION>*)data->bufIn[0],                      \
+                                   (real_type_t<PRECISION>*)data->bufIn[1],                      \
+                                   (real_type_t<PRECISION>*)data->bufOut[0],                     \
+                                   (real_type_t<PRECISION>*)data->bufOut[1]);                    \
+            }                                                                                    \
+        }                                                                                        \
+    }
+
+// The fused CS_KERNEL_2D_SINGLE and CS_KERNEL_3D_SINGLE kernels take any
+// strides and read all of their input before writing, so one kernel covers
+// both placements
+#define POWX_SINGLE_GENERATOR(FUNCTION_NAME, FWD_KERN_NAME, BACK_KERN_NAME, PRECISION)           \
+    void FUNCTION_NAME(const void* data_p, void* back_p)                                         \
+    {                                                                                            \
+        DeviceCallIn* data          = (DeviceCallIn*)data_p;                                     \
+        hipStream_t   rocfft_stream = data->rocfft_stream;                                       \
+        const bool    inPlanar                                                                   \
+            = (data->node->inArrayType == rocfft_array_type_complex_planar)                      \
+              || (data->node->inArrayType == rocfft_array_type_hermitian_planar);                \
+        const bool    outPlanar                                                                  \
+            = (data->node->outArrayType == rocfft_array_type_complex_planar)                     \
+              || (data->node->outArrayType == rocfft_array_type_hermitian_planar);               \
+        if(data->node->direction == -1)                                                          \
+        {                                                                                        \
+            if(!inPlanar && !outPlanar)                                                          \
+            {                                                                                    \
+                hipLaunchKernelGGL(HIP_KERNEL_NAME(FWD_KERN_NAME<PRECISION>),                    \
+                                   dim3(data->gridParam.b_x),                                    \
+                                   dim3(data->gridParam.tpb_x),                                  \
+                                   0,                                                            \
+                                   rocfft_stream,                                                \
+                                   (PRECISION*)data->node->twiddles,                             \
+                                   data->node->length.size(),                                    \
+                                   data->node->devKernArg,                                       \
+                                   data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,           \
+                                   data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,           \
+                                   (real_type_t<PRECISION>)data->node->scale,                    \
+                                   (PRECISION*)data->bufIn[0],                                   \
+                                   (PRECISION*)data->bufOut[0]);                                 \
+            }                                                                                    \
+            else if(!inPlanar && outPlanar)                                                      \
+            {                                                                                    \
+                hipLaunchKernelGGL(HIP_KERNEL_NAME(FWD_KERN_NAME<PRECISION>),                    \
+                                   dim3(data->gridParam.b_x),                                    \
+                                   dim3(data->gridParam.tpb_x),                                  \
+                                   0,                                                            \
+                                   rocfft_stream,                                                \
+                                   (PRECISION*)data->node->twiddles,                             \
+                                   data->node->length.size(),                                    \
+                                   data->node->devKernArg,                                       \
+                                   data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,           \
+                                   data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,           \
+                                   (real_type_t<PRECISION>)data->node->scale,                    \
+                                   (PRECISION*)data->bufIn[0],                                   \
+                                   (real_type_t<PRECISION>*)data->bufOut[0],                     \
+                                   (real_type_t<PRECISION>*)data->bufOut[1]);                    \
+            }                                                                                    \
+            else if(inPlanar && !outPlanar)                                                      \
+            {                                                                                    \
+                hipLaunchKernelGGL(HIP_KERNEL_NAME(FWD_KERN_NAME<PRECISION>),                    \
+                                   dim3(data->gridParam.b_x),                                    \
+                                   dim3(data->gridParam.tpb_x),                                  \
+                                   0,                                                            \
+                                   rocfft_stream,                                                \
+                                   (PRECISION*)data->node->twiddles,                             \
+                                   data->node->length.size(),                                    \
+                                   data->node->devKernArg,                                       \
+                                   data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,           \
+                                   data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,           \
+                                   (real_type_t<PRECISION>)data->node->scale,                    \
+                                   (real_type_t<PRECISION>*)data->bufIn[0],                      \
+                                   (real_type_t<PRECISION>*)data->bufIn[1],                      \
+                                   (PRECISION*)data->bufOut[0]);                                 \
+            }                                                                                    \
+            else if(inPlanar && outPlanar)                                                       \
+            {                                                                                    \
+                hipLaunchKernelGGL(HIP_KERNEL_NAME(FWD_KERN_NAME<PRECISION>),                    \
+                                   dim3(data->gridParam.b_x),                                    \
+                                   dim3(data->gridParam.tpb_x),                                  \
+                                   0,                                                            \
+                                   rocfft_stream,                                                \
+                                   (PRECISION*)data->node->twiddles,                             \
+                                   data->node->length.size(),                                    \
+                                   data->node->devKernArg,                                       \
+                                   data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,           \
+                                   data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,           \
+                                   (real_type_t<PRECISION>)data->node->scale,                    \
+                                   (real_type_t<PRECISION>*)data->bufIn[0],                      \
+                                   (real_type_t<PRECISION>*)data->bufIn[1],                      \
+                                   (real_type_t<PRECISION>*)data->bufOut[0],                     \
+                                   (real_type_t<PRECISION>*)data->bufOut[1]);                    \
+            }                                                                                    \
+        }                                                                                        \
+        else                                                                                     \
+        {                                                                                        \
+            if(!inPlanar && !outPlanar)                                                          \
+            {                                                                                    \
+                hipLaunchKernelGGL(HIP_KERNEL_NAME(BACK_KERN_NAME<PRECISION>),                   \
+                                   dim3(data->gridParam.b_x),                                    \
+                                   dim3(data->gridParam.tpb_x),                                  \
+                                   0,                                                            \
+                                   rocfft_stream,                                                \
+                                   (PRECISION*)data->node->twiddles,                             \
+                                   data->node->length.size(),                                    \
+                                   data->node->devKernArg,                                       \
+                                   data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,           \
+                                   data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,           \
+                                   (real_type_t<PRECISION>)data->node->scale,                    \
+                                   (PRECISION*)data->bufIn[0],                                   \
+                                   (PRECISION*)data->bufOut[0]);                                 \
+            }                                                                                    \
+            else if(!inPlanar && outPlanar)                                                      \
+            {                                                                                    \
+                hipLaunchKernelGGL(HIP_KERNEL_NAME(BACK_KERN_NAME<PRECISION>),                   \
+                                   dim3(data->gridParam.b_x),                                    \
+                                   dim3(data->gridParam.tpb_x),                                  \
+                                   0,                                                            \
+                                   rocfft_stream,                                                \
+                                   (PRECISION*)data->node->twiddles,                             \
+                                   data->node->length.size(),                                    \
+                                   data->node->devKernArg,                                       \
+                                   data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,           \
+                                   data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,           \
+                                   (real_type_t<PRECISION>)data->node->scale,                    \
+                                   (PRECISION*)data->bufIn[0],                                   \
+                                   (real_type_t<PRECISION>*)data->bufOut[0],                     \
+                                   (real_type_t<PRECISION>*)data->bufOut[1]);                    \
+            }                                                                                    \
+            else if(inPlanar && !outPlanar)                                                      \
+            {                                                                                    \
+                hipLaunchKernelGGL(HIP_KERNEL_NAME(BACK_KERN_NAME<PRECISION>),                   \
+                                   dim3(data->gridParam.b_x),                                    \
+                                   dim3(data->gridParam.tpb_x),                                  \
+                                   0,                                                            \
+                                   rocfft_stream,                                                \
+                                   (PRECISION*)data->node->twiddles,                             \
+                                   data->node->length.size(),                                    \
+                                   data->node->devKernArg,                                       \
+                                   data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,           \
+                                   data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,           \
+                                   (real_type_t<PRECISION>)data->node->scale,                    \
+                                   (real_type_t<PRECISION>*)data->bufIn[0],                      \
+                                   (real_type_t<PRECISION>*)data->bufIn[1],                      \
+                                   (PRECISION*)data->bufOut[0]);                                 \
+            }                                                                                    \
+            else if(inPlanar && outPlanar)                                                       \
+            {                                                                                    \
+                hipLaunchKernelGGL(HIP_KERNEL_NAME(BACK_KERN_NAME<PRECISION>),                   \
+                                   dim3(data->gridParam.b_x),                                    \
+                                   dim3(data->gridParam.tpb_x),                                  \
+                                   0,                                                            \
+                                   rocfft_stream,                                                \
+                                   (PRECISION*)data->node->twiddles,                             \
+                                   data->node->length.size(),                                    \
+                                   data->node->devKernArg,                                       \
+                                   data->node->devKernArg + 1 * KERN_ARGS_ARRAY_WIDTH,           \
+                                   data->node->devKernArg + 2 * KERN_ARGS_ARRAY_WIDTH,           \
+                                   (real_type_t<PRECISION>)data->node->scale,                    \
                                    (real_type_t<PRECISION>*)data->bufIn[0],                      \
                                    (real_type_t<PRECISION>*)data->bufIn[1],                      \
                                    (real_type_t<PRECISION>*)data->bufOut[0],                     \
@@ -21,12 +21,17 @@
 #ifndef PLAN_H
 #define PLAN_H
 
+#include <algorithm>
 #include <array>
 #include <cstring>
 #include <vector>
 
 #include "tree_node.h"
 
+// Backend used when none is set in the execution info or the plan
+// description, taken from the environment variable ROCFFT_EXECUTION_BACKEND.
+rocfft_execution_backend DefaultExecutionBackend();
+
 static inline bool IsPo2(size_t u)
 {
     return (u != 0) && (0 == (u & (u - 1)));
@@ -35,16 +40,30 @@ static inline bool IsPo2(size_t u)
 std::string PrintScheme(ComputeScheme cs);
 std::string PrintArrayType(const rocfft_array_type x);
 
+// Lengths with generated Stockham kernels: 2,3,5,7-smooth, or a power of 2
+// times a power of 11 or of 13
 inline bool SupportedLength(size_t len)
 {
     size_t p = len;
     while(!(p % 2))
         p /= 2;
+
+    // 11 and 13 only combine with powers of 2
+    for(const size_t rad : {11, 13})
+    {
+        size_t q = p;
+        while(!(q % rad))
+            q /= rad;
+        if(q == 1)
+            return true;
+    }
+
     while(!(p % 3))
         p /= 3;
     while(!(p % 5))
         p /= 5;
-    // while(!(p%7)) p /= 7;
+    while(!(p % 7))
+        p /= 7;
 
     if(p == 1)
         return true;
@@ -52,12 +71,96 @@ inline bool SupportedLength(size_t len)
         return false;
 }
 
+// Bluestein convolution length: the smallest 2,3,5-smooth length that holds
+// the 2 * len - 1 point linear convolution of a length len transform
 inline size_t FindBlue(size_t len)
 {
-    size_t p = 1;
-    while(p < len)
-        p <<= 1;
-    return 2 * p;
+    const size_t minLen = 2 * len - 1;
+
+    size_t best = 1;
+    while(best < minLen)
+        best <<= 1;
+
+    for(size_t p5 = 1; p5 < best; p5 *= 5)
+    {
+        for(size_t p35 = p5; p35 < best; p35 *= 3)
+        {
+            // smallest power of 2 taking p35 up to minLen
+            size_t p = p35;
+            while(p < minLen)
+                p <<= 1;
+            best = std::min(best, p);
+        }
+    }
+    return best;
+}
+
+// Rader's algorithm computes a prime length len transform with a cyclic
+// convolution of length len - 1, so it applies when that length is smooth
+inline bool RaderLength(size_t len)
+{
+    if(len < 7 || SupportedLength(len) || !SupportedLength(len - 1))
+        return false;
+    for(size_t d = 2; d * d <= len; ++d)
+    {
+        if(len % d == 0)
+            return false;
+    }
+    return true;
+}
+
+inline size_t PowMod(size_t base, size_t exp, size_t mod)
+{
+    size_t result = 1;
+    base %= mod;
+    for(; exp; exp >>= 1)
+    {
+        if(exp & 1)
+            result = result * base % mod;
+        base = base * base % mod;
+    }
+    return result;
+}
+
+// Inverse of a modulo m, for coprime a and m
+inline size_t InverseMod(size_t a, size_t m)
+{
+    // extended Euclid, tracking the coefficients of a modulo m
+    size_t r0 = m, r1 = a % m;
+    size_t t0 = 0, t1 = 1;
+    while(r1 != 0)
+    {
+        const size_t q = r0 / r1;
+        const size_t r = r0 - q * r1;
+        const size_t t = (t0 + (m - q % m) * t1) % m;
+        r0             = r1;
+        r1             = r;
+        t0             = t1;
+        t1             = t;
+    }
+    assert(r0 == 1);
+    return t0 % m;
+}
+
+// Smallest primitive root modulo a Rader length: g generates the
+// multiplicative group if g^((len - 1) / p) != 1 for every prime p dividing
+// len - 1, which are at most 13
+inline size_t RaderRoot(size_t len)
+{
+    const size_t order = len - 1;
+    for(size_t g = 2; g < len; ++g)
+    {
+        bool generates = true;
+        for(size_t p : {2, 3, 5, 7, 11, 13})
+        {
+            if(order % p == 0 && PowMod(g, order / p, len) == 1)
+                generates = false;
+        }
+        if(generates)
+            return g;
+    }
+    assert(false);
+    return 0;
 }
 
 struct rocfft_plan_description_t
@@ -76,6 +179,10 @@ struct rocfft_plan_description_t
 
     double scale;
 
+    double                   timeLimit; // seconds rocfft_plan_mode_measure may take, 0 for no limit
+    rocfft_plan_mode         planMode;
+    rocfft_execution_backend backend; // backend the decompositions are chosen for
+
     rocfft_plan_description_t()
     {
         inArrayType  = rocfft_array_type_complex_interleaved;
@@ -91,6 +198,10 @@ struct rocfft_plan_description_t
         outOffset.fill(0);
 
         scale = 1.0;
+
+        timeLimit = 0.0;
+        planMode  = rocfft_plan_mode_estimate;
+        backend   = DefaultExecutionBackend();
     }
 };
 
@@ -132,6 +243,30 @@ struct rocfft_plan_t
     }
 };
 
+// Build the tree and execution sequence of a plan, following and recording
+// the 1D decisions if given
+void CreateExecPlan(const rocfft_plan_t& plan,
+                    ExecPlan&            execPlan,
+                    PlanDecisions*       decisions = nullptr);
+
 void PlanPowX(ExecPlan& execPlan);
 
+// Create the device tables of a plan that are missing; false if the device
+// cannot hold them
+bool CreateDeviceTables(ExecPlan& execPlan);
+
+// Create the host tables of a plan that are missing, for the host backend;
+// false if they do not fit in host memory
+bool CreateHostTables(ExecPlan& execPlan);
+
+// Transform the len elements of the device table in into out, forward for
+// direction -1 and backward otherwise, with a batch-1 plan built outside the
+// repo, and wait for the result; false if the device cannot run it.  Used
+// to compute the chirp and Rader kernel tables when a plan is created.
+bool TransformTable(void* in, void* out, size_t len, int direction, rocfft_precision precision);
+
+// Cap the batch members of each kernel launch of a plan at maxBatch, or at
+// the nearest even count for the pair kernels
+void LimitLaunchBatch(ExecPlan& execPlan, size_t maxBatch);
+
 #endif // PLAN_H
@@ -0,0 +1,128 @@
+/******************************************************************************
+* Copyright (c) 2016 - present Advanced Micro Devices, Inc. All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*******************************************************************************/
+
+#ifndef PLAN_COST_H
+#define PLAN_COST_H
+
+#include <vector>
+
+#include "rocfft.h"
+#include "tree_node.h"
+
+// Parameters of the cost model used to choose between decompositions of a
+// transform.  Costs are in arbitrary units; only their ratios matter.
+struct PlanCostModel
+{
+    double passCost; // one radix pass over one element
+    double byteCost; // one byte read or written by a kernel
+    double launchCost; // fixed cost of each kernel
+    double blockFactor; // traffic factor of the column (block compute) kernels
+    double transposeFactor; // traffic factor of the transposes
+    size_t transposeTile; // transposes move whole tiles of this size
+    double gatherFactor; // traffic factor of the index mapped side of a PFA transpose
+};
+
+// Model parameters of an execution backend
+const PlanCostModel& GetPlanCostModel(rocfft_execution_backend backend);
+
+// One way to compute a 1D transform: a single CS_KERNEL_STOCKHAM kernel,
+// a CS_L1D_TRTRT/CC/CRT scheme splitting the length into
+// divLength0 * divLength1, CS_L1D_PFA for a split into coprime lengths,
+// CS_BLUESTEIN padded to lengthBlue, or CS_RADER for a prime length
+struct Plan1DCandidate
+{
+    ComputeScheme scheme;
+    size_t        divLength0;
+    size_t        divLength1;
+    size_t        lengthBlue;
+    double        cost;
+};
+
+// All decompositions of count transforms of the given length that the
+// kernels can compute, cheapest first
+std::vector<Plan1DCandidate> EnumeratePlan1D(size_t               length,
+                                             size_t               count,
+                                             rocfft_precision     precision,
+                                             const PlanCostModel& model);
+
+// Scheme of count 2D or 3D transforms of the first dim lengths: the fused
+// single kernel, row transforms followed by a block column kernel (RC), or
+// row transforms and transposes (RTRT), whichever is cheapest.  The block
+// column kernel needs adjacent columns to be adjacent in memory.
+ComputeScheme ChoosePlanMultiDim(const std::vector<size_t>& length,
+                                 size_t                     dim,
+                                 size_t                     count,
+                                 bool                       unitColumns,
+                                 rocfft_precision           precision,
+                                 const PlanCostModel&       model);
+
+// Whether count real transforms of the first dim lengths are cheaper in
+// pairs of batch members, as the real and imaginary parts of half as many
+// complex transforms, than through the half-length complex transform of an
+// even length or the full-length embedding of an odd one.  realAsComplex
+// tells if the real data of an even length can be viewed as complex in place.
+bool ChooseRealPairs(const std::vector<size_t>& length,
+                     size_t                     dim,
+                     size_t                     count,
+                     bool                       realAsComplex,
+                     rocfft_precision           precision,
+                     const PlanCostModel&       model);
+
+// Decomposition chosen for a 1D transform of the given length
+struct Plan1DDecision
+{
+    size_t        length;
+    ComputeScheme scheme;
+    size_t        divLength0;
+    size_t        divLength1;
+    size_t        lengthBlue;
+
+    Plan1DDecision() = default;
+    Plan1DDecision(const size_t length, const Plan1DCandidate& c)
+        : length(length)
+        , scheme(c.scheme)
+        , divLength0(c.divLength0)
+        , divLength1(c.divLength1)
+        , lengthBlue(c.lengthBlue)
+    {
+    }
+
+    bool Is(const Plan1DCandidate& c) const
+    {
+        return (scheme == c.scheme) && (divLength0 == c.divLength0)
+               && (divLength1 == c.divLength1) && (lengthBlue == c.lengthBlue);
+    }
+};
+
+// Decisions taken while one plan tree is built, in the order build_1D runs.
+// A forced decision is followed when it matches the length being built and
+// is one of its candidates; otherwise the cheapest candidate is taken.
+struct PlanDecisions
+{
+    std::vector<Plan1DDecision>               forced;
+    std::vector<Plan1DDecision>               made;
+    std::vector<std::vector<Plan1DCandidate>> alternatives; // candidates of each decision
+
+    Plan1DCandidate Choose(size_t length, const std::vector<Plan1DCandidate>& candidates);
+};
+
+#endif // PLAN_COST_H
@@ -50,6 +50,10 @@ DLL_PUBLIC rocfft_status rocfft_plan_allocate(rocfft_plan* plan);
 DLL_PUBLIC rocfft_status rocfft_repo_get_unique_plan_count(size_t* count);
 DLL_PUBLIC rocfft_status rocfft_repo_get_total_plan_count(size_t* count);
 
+// split the kernels of a plan into launches of at most max_batch batch
+// members, as large batches are split to fit the device grid
+DLL_PUBLIC rocfft_status rocfft_plan_set_max_launch_batch(rocfft_plan plan, size_t max_batch);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
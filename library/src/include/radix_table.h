@@ -52,8 +52,29 @@ inline size_t Large1DThreshold(rocfft_precision precision)
 }
 
 #define LARGE_1D_THRESHOLD 4096
+
+// Largest 2D or 3D transform computed by one CS_KERNEL_2D_SINGLE or
+// CS_KERNEL_3D_SINGLE workgroup, which keeps it in LDS next to the scratch
+// space of the radix passes
+#define SINGLE_KERNEL_MAX_ELEMS 1024
 #define MAX_WORK_GROUP_SIZE 1024
 
+// Shapes of the generated CS_KERNEL_2D_SINGLE and CS_KERNEL_3D_SINGLE
+// kernels: the first dim lengths are powers of two from 4 to 256 (so each
+// has at least two radix passes) of at most SINGLE_KERNEL_MAX_ELEMS
+// elements in all
+inline bool SingleKernelShape(const std::vector<size_t>& length, const size_t dim)
+{
+    size_t elems = 1;
+    for(size_t d = 0; d < dim; d++)
+    {
+        if((length[d] < 4) || (length[d] > 256) || (length[d] & (length[d] - 1)))
+            return false;
+        elems *= length[d];
+    }
+    return elems <= SINGLE_KERNEL_MAX_ELEMS;
+}
+
 /* radix table: tell the FFT algorithms for size <= 4096 ; required by twiddle,
  * passes, and kernel*/
 struct SpecRecord
@@ -145,8 +166,9 @@ inline void DetermineSizes(const size_t& length, size_t& workGroupSize, size_t&
     size_t baseRadix[]   = {13, 11, 7, 5, 3, 2}; // list only supported primes
     size_t baseRadixSize = sizeof(baseRadix) / sizeof(baseRadix[0]);
 
-    size_t                   l = length;
-    std::map<size_t, size_t> primeFactorsExpanded;
+    // indexed by prime
+    size_t l                        = length;
+    size_t primeFactorsExpanded[14] = {};
     for(size_t r = 0; r < baseRadixSize; r++)
     {
         size_t rad = baseRadix[r];
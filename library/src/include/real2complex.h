@@ -32,8 +32,20 @@ void complex2real(const void* data, void* back);
 
 void hermitian2complex(const void* data, void* back);
 
+void pair_real2complex(const void* data, void* back);
+
+void pair_complex2hermitian(const void* data, void* back);
+
+void pair_hermitian2complex(const void* data, void* back);
+
+void pair_complex2real(const void* data, void* back);
+
 void r2c_1d_post(const void* data, void* back);
 
 void c2r_1d_pre(const void* data, void* back);
 
+void r2c_1d_pack(const void* data, void* back);
+
+void c2r_1d_unpack(const void* data, void* back);
+
 #endif // REAL_TO_COMPLEX_H
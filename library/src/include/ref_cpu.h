@@ -215,10 +215,6 @@ class RefLibOp
         // TODO: what about strides, etc?
         switch(data->node->scheme)
         {
-        case CS_KERNEL_CHIRP:
-            insize  = 2 * data->node->lengthBlue;
-            outsize = insize;
-            break;
         case CS_KERNEL_FFT_MUL:
         case CS_KERNEL_PAD_MUL:
         case CS_KERNEL_RES_MUL:
@@ -737,13 +733,6 @@ class RefLibOp
             }
         }
         break;
-        case CS_KERNEL_CHIRP:
-        {
-            size_t N = data->node->length[0];
-            size_t M = data->node->lengthBlue;
-            chirp(N, M, data->node->direction, (local_fftwf_complex*)fftwout.data);
-        }
-        break;
         case CS_KERNEL_PAD_MUL:
         {
             std::complex<float>* in = (std::complex<float>*)fftwin.data;
@@ -793,7 +782,7 @@ class RefLibOp
             size_t               M  = data->node->lengthBlue;
             size_t               N  = data->node->parent->length[0];
 
-            CopyInputVector(data_p, M * 2 * 2 * sizeof(float));
+            CopyInputVector(data_p);
 
             fftwbuf chirp_mem(M * 2, sizeof(std::complex<float>));
 
@@ -827,7 +816,7 @@ class RefLibOp
             size_t               M  = data->node->lengthBlue;
             size_t               N  = data->node->length[0];
 
-            CopyInputVector(data_p, M * 2 * 2 * sizeof(float));
+            CopyInputVector(data_p);
 
             fftwbuf chirp_mem(M * 2, sizeof(std::complex<float>));
 
@@ -882,14 +871,6 @@ public:
 
         switch(data->node->scheme)
         {
-        case CS_KERNEL_CHIRP:
-            out_size *= 2;
-            break;
-        case CS_KERNEL_FFT_MUL:
-        case CS_KERNEL_PAD_MUL:
-            // TODO: document
-            bufOut = ((char*)bufOut + 2 * 2 * sizeof(float) * data->node->lengthBlue);
-            break;
         case CS_KERNEL_COPY_CMPLX_TO_R:
         case CS_KERNEL_COPY_HERM_TO_CMPLX:
         case CS_KERNEL_STOCKHAM_BLOCK_RC:
@@ -928,18 +909,6 @@ public:
                        data->node->outStride);
         }
         break;
-        case CS_KERNEL_CHIRP:
-        {
-            std::vector<size_t> length_chirp;
-            length_chirp.push_back(data->node->lengthBlue);
-            CopyVector((local_fftwf_complex*)libout.data,
-                       (local_fftwf_complex*)tmp_mem.data,
-                       2 * data->node->batch,
-                       data->node->oDist,
-                       length_chirp,
-                       data->node->outStride);
-        }
-        break;
         case CS_KERNEL_PAD_MUL:
         {
             std::vector<size_t> length_ot;
@@ -61,6 +61,9 @@ public:
     static void   CreatePlan(rocfft_plan plan);
     static void   GetPlan(rocfft_plan plan, ExecPlan& execPlan);
     static void   DeletePlan(rocfft_plan plan);
+    static void   LimitLaunchBatch(rocfft_plan plan, size_t maxBatch);
+    static bool   CreateDeviceTables(rocfft_plan plan);
+    static bool   CreateHostTables(rocfft_plan plan);
     static size_t GetUniquePlanCount();
     static size_t GetTotalPlanCount();
 };
@@ -23,16 +23,22 @@
 #ifndef TRANSFORM_H
 #define TRANSFORM_H
 
+#include "plan.h"
+#include "rocfft.h"
 #include "rocfft_hip.h"
 
 struct rocfft_execution_info_t
 {
-    void*       workBuffer;
-    size_t      workBufferSize;
-    hipStream_t rocfft_stream = 0; // by default it is stream 0
+    void*                    workBuffer;
+    size_t                   workBufferSize;
+    hipStream_t              rocfft_stream = 0; // by default it is stream 0
+    rocfft_execution_backend backend;
+    size_t                   hostThreads; // 0 means HostThreadPool::DefaultThreadCount()
     rocfft_execution_info_t()
         : workBuffer(nullptr)
         , workBufferSize(0)
+        , backend(DefaultExecutionBackend())
+        , hostThreads(0)
     {
     }
 };
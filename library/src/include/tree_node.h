@@ -21,9 +21,14 @@
 #ifndef TREE_NODE_H
 #define TREE_NODE_H
 
+#include <algorithm>
+#include <cassert>
 #include <cstring>
+#include <initializer_list>
 #include <iostream>
-#include <map>
+#include <memory>
+#include <string>
+#include <type_traits>
 #include <vector>
 
 #include "kargs.h"
@@ -48,6 +53,7 @@ enum ComputeScheme
     CS_KERNEL_TRANSPOSE,
     CS_KERNEL_TRANSPOSE_XY_Z,
     CS_KERNEL_TRANSPOSE_Z_XY,
+    CS_KERNEL_TRANSPOSE_INPLACE,
 
     CS_REAL_TRANSFORM_USING_CMPLX,
     CS_KERNEL_COPY_R_TO_CMPLX,
@@ -55,21 +61,34 @@ enum ComputeScheme
     CS_KERNEL_COPY_HERM_TO_CMPLX,
     CS_KERNEL_COPY_CMPLX_TO_R,
 
+    CS_REAL_TRANSFORM_PAIR,
+    CS_KERNEL_PAIR_R_TO_CMPLX,
+    CS_KERNEL_PAIR_CMPLX_TO_HERM,
+    CS_KERNEL_PAIR_HERM_TO_CMPLX,
+    CS_KERNEL_PAIR_CMPLX_TO_R,
+
     CS_REAL_TRANSFORM_EVEN,
     CS_KERNEL_R_TO_CMPLX,
     CS_KERNEL_CMPLX_TO_R,
+    CS_KERNEL_PACK_R_TO_CMPLX,
+    CS_KERNEL_UNPACK_CMPLX_TO_R,
     CS_REAL_2D_EVEN,
     CS_REAL_3D_EVEN,
 
     CS_BLUESTEIN,
-    CS_KERNEL_CHIRP,
     CS_KERNEL_PAD_MUL,
     CS_KERNEL_FFT_MUL,
     CS_KERNEL_RES_MUL,
 
+    CS_RADER,
+    CS_KERNEL_RADER_PERMUTE,
+    CS_KERNEL_RADER_MUL,
+    CS_KERNEL_RADER_UNPERMUTE,
+
     CS_L1D_TRTRT,
     CS_L1D_CC,
     CS_L1D_CRT,
+    CS_L1D_PFA,
 
     CS_2D_STRAIGHT,
     CS_2D_RTRT,
@@ -84,6 +103,113 @@ enum ComputeScheme
     CS_KERNEL_3D_SINGLE
 };
 
+struct PlanDecisions;
+class TreeNodeArena;
+
+// Fixed-capacity vector stored inline in a TreeNode, so that building a
+// plan tree does not allocate per-node lengths, strides and children.
+template <typename T, size_t N>
+class NodeVector
+{
+    T      data_[N];
+    size_t size_;
+
+public:
+    NodeVector()
+        : size_(0)
+    {
+    }
+
+    NodeVector(std::initializer_list<T> init)
+        : size_(0)
+    {
+        *this = init;
+    }
+
+    NodeVector& operator=(std::initializer_list<T> init)
+    {
+        assert(init.size() <= N);
+        size_ = 0;
+        for(const auto& x : init)
+            data_[size_++] = x;
+        return *this;
+    }
+
+    NodeVector& operator=(const std::vector<T>& v)
+    {
+        assert(v.size() <= N);
+        size_ = v.size();
+        std::copy(v.begin(), v.end(), data_);
+        return *this;
+    }
+
+    operator std::vector<T>() const
+    {
+        return std::vector<T>(begin(), end());
+    }
+
+    void push_back(const T& x)
+    {
+        assert(size_ < N);
+        data_[size_++] = x;
+    }
+
+    void clear()
+    {
+        size_ = 0;
+    }
+
+    size_t size() const
+    {
+        return size_;
+    }
+
+    bool empty() const
+    {
+        return size_ == 0;
+    }
+
+    T& operator[](size_t i)
+    {
+        return data_[i];
+    }
+
+    const T& operator[](size_t i) const
+    {
+        return data_[i];
+    }
+
+    T& back()
+    {
+        return data_[size_ - 1];
+    }
+
+    const T& back() const
+    {
+        return data_[size_ - 1];
+    }
+
+    T* begin()
+    {
+        return data_;
+    }
+
+    T* end()
+    {
+        return data_ + size_;
+    }
+
+    const T* begin() const
+    {
+        return data_;
+    }
+
+    const T* end() const
+    {
+        return data_ + size_;
+    }
+};
+
 enum TransTileDir
 {
     TTD_IP_HOR,
@@ -92,58 +218,47 @@ enum TransTileDir
 
 class TreeNode
 {
+    friend class TreeNodeArena;
+
 private:
     // disallow public creation
-    TreeNode(TreeNode* p)
-        : parent(p)
+    TreeNode(TreeNode* p, TreeNodeArena* a)
+        : iDist(0)
+        , oDist(0)
+        , scale(1.0)
+        , inArrayType(rocfft_array_type_unset)
+        , outArrayType(rocfft_array_type_unset)
+        , large1D(0)
+        , parent(p)
+        , arena(a)
         , scheme(CS_NONE)
         , obIn(OB_UNINIT)
         , obOut(OB_UNINIT)
-        , large1D(0)
+        , transTileDir(TTD_IP_HOR)
         , lengthBlue(0)
+        , raderRoot(0)
+        , pfaIn{0, 0}
+        , pfaOut{0, 0}
         , iOffset(0)
         , oOffset(0)
-        , iDist(0)
-        , oDist(0)
-        , transTileDir(TTD_IP_HOR)
+        , inOffset{0, 0}
+        , outOffset{0, 0}
         , twiddles(nullptr)
         , twiddles_large(nullptr)
+        , chirp(nullptr)
         , devKernArg(nullptr)
-        , inArrayType(rocfft_array_type_unset)
-        , outArrayType(rocfft_array_type_unset)
+        , hostChirp(nullptr)
+        , decisions(nullptr)
     {
         if(p != nullptr)
         {
             precision = p->precision;
             batch     = p->batch;
             direction = p->direction;
+            backend   = p->backend;
         }
-
-        Pow2Lengths1Single.insert(std::make_pair(8192, 64));
-        Pow2Lengths1Single.insert(std::make_pair(16384, 64));
-        Pow2Lengths1Single.insert(std::make_pair(32768, 128));
-        Pow2Lengths1Single.insert(std::make_pair(65536, 256));
-        Pow2Lengths1Single.insert(std::make_pair(131072, 64));
-        Pow2Lengths1Single.insert(std::make_pair(262144, 64));
-
-        Pow2Lengths1Double.insert(std::make_pair(4096, 64));
-        Pow2Lengths1Double.insert(std::make_pair(8192, 64));
-        Pow2Lengths1Double.insert(std::make_pair(16384, 64));
-        Pow2Lengths1Double.insert(std::make_pair(32768, 128));
-        Pow2Lengths1Double.insert(std::make_pair(65536, 64));
-        Pow2Lengths1Double.insert(std::make_pair(131072, 64));
     }
 
-    // Maps from length[0] to divLength1 for 1D transforms in
-    // single and double precision for power-of-two transfor sizes
-    // using blocks.
-    std::map<size_t, size_t> Pow2Lengths1Single;
-    std::map<size_t, size_t> Pow2Lengths1Double;
-
-    // Compute divLength1 from Length[0] for non-power-of-two 1D
-    // transform sizes
-    size_t div1DNoPo2(const size_t length0);
-
 public:
     size_t batch;
 
@@ -152,24 +267,34 @@ public:
     size_t dimension;
 
     // length of the FFT in each dimension, internal value
-    std::vector<size_t> length;
+    NodeVector<size_t, 8> length;
 
     // stride of the FFT in each dimension
-    std::vector<size_t> inStride, outStride;
+    NodeVector<size_t, 8> inStride, outStride;
 
     // distance between consecutive batch members
     size_t iDist, oDist;
 
+    // factor the results are multiplied by as they are stored; only the last
+    // kernel of the plan has a scale other than 1
+    double scale;
+
     int                     direction;
     rocfft_result_placement placement;
     rocfft_precision        precision;
     rocfft_array_type       inArrayType, outArrayType;
 
+    // backend whose cost model chooses the decompositions
+    rocfft_execution_backend backend;
+
     // extra twiddle multiplication for large 1D
     size_t large1D;
 
-    TreeNode*              parent;
-    std::vector<TreeNode*> childNodes;
+    TreeNode*                parent;
+    NodeVector<TreeNode*, 8> childNodes;
+
+    // storage shared by every node of the tree, owned by the root
+    TreeNodeArena* arena;
 
     ComputeScheme   scheme;
     OperatingBuffer obIn, obOut;
@@ -177,25 +302,45 @@ public:
     TransTileDir transTileDir;
 
     size_t lengthBlue;
+    size_t raderRoot; // primitive root modulo the prime length of a Rader node
+
+    // Good-Thomas index maps of the transposes of a CS_L1D_PFA node: element
+    // (i0, i1) is read from linear index (pfaIn[0] * i0 + pfaIn[1] * i1) mod N
+    // of the input and written to (pfaOut[0] * i0 + pfaOut[1] * i1) mod N of
+    // the output, N = length[0] * length[1].  All 0 for plain transposes.
+    size_t pfaIn[2], pfaOut[2];
+    // offsets of a Bluestein node's data in the OB_TEMP_BLUESTEIN buffer
     size_t iOffset, oOffset;
+    // offsets of the data in the user buffers, in elements of the array
+    // types, one per planar component; only set on the root
+    size_t inOffset[2], outOffset[2];
 
     // these are device pointers
     void*   twiddles;
     void*   twiddles_large;
+    void*   chirp; // Bluestein chirp or Rader kernel FFT, shared between plans
     size_t* devKernArg;
 
+    // host copy of chirp for the host backend, shared between plans
+    const HostChirpTable* hostChirp;
+
+    // decisions followed by build_1D, set on the root while the tree is built
+    PlanDecisions* decisions;
+
 public:
     TreeNode(const TreeNode&) = delete; // disallow copy constructor
     TreeNode& operator=(const TreeNode&) = delete; // disallow assignment operator
 
-    // create node (user level) using this function
-    static TreeNode* CreateNode(TreeNode* parentNode = nullptr)
-    {
-        return new TreeNode(parentNode);
-    }
+    // create node (user level) using this function; a node without a parent
+    // starts a new tree with its own arena
+    static TreeNode* CreateNode(TreeNode* parentNode = nullptr);
+
+    // destroy node by calling this function; the memory of the tree is
+    // released when its root is destroyed
+    static void DeleteNode(TreeNode* node);
 
-    // destroy node by calling this function
-    static void DeleteNode(TreeNode* node)
+    // release the device resources held by the node and its children
+    static void ReleaseNode(TreeNode* node)
     {
         if(!node)
             return;
@@ -203,7 +348,7 @@ public:
         for(auto children_p = node->childNodes.begin(); children_p != node->childNodes.end();
             children_p++)
         {
-            DeleteNode(*children_p); // recursively delete allocated nodes
+            ReleaseNode(*children_p); // recursively release child nodes
         }
 
         if(node->twiddles)
@@ -218,22 +363,36 @@ public:
             node->twiddles_large = nullptr;
         }
 
+        if(node->chirp)
+        {
+            chirp_delete(node->chirp);
+            node->chirp = nullptr;
+        }
+
+        if(node->hostChirp)
+        {
+            host_chirp_delete(node->hostChirp);
+            node->hostChirp = nullptr;
+        }
+
         if(node->devKernArg)
         {
             kargs_delete(node->devKernArg);
             node->devKernArg = nullptr;
         }
-
-        delete node;
-        node = NULL;
     }
 
     // Main tree builder:
     void RecursiveBuildTree();
 
+    // Tree builder for contiguous in-place complex transforms, which
+    // transposes in place instead of through a temporary buffer:
+    void RecursiveBuildTreeLogicB();
+
     // Real-complex and complex-real node builders:
     void build_real();
     void build_real_embed();
+    void build_real_pair();
     void build_real_even_1D();
     void build_real_even_2D();
     void build_real_even_3D();
@@ -241,9 +400,14 @@ public:
     // 1D node builders:
     void build_1D();
     void build_1DBluestein();
+    void build_1DRader();
     void build_1DCS_L1D_TRTRT(const size_t divLength0, const size_t divLength1);
     void build_1DCS_L1D_CC(const size_t divLength0, const size_t divLength1);
     void build_1DCS_L1D_CRT(const size_t divLength0, const size_t divLength1);
+    void build_1DCS_L1D_PFA(const size_t divLength0, const size_t divLength1);
+
+    // Choose the scheme of a 2D or 3D node:
+    void build_multi_dim();
 
     // 2D node builder:
     void build_CS_2D_RTRT();
@@ -270,6 +434,9 @@ public:
     void assign_buffers_CS_BLUESTEIN(OperatingBuffer& flipIn,
                                      OperatingBuffer& flipOut,
                                      OperatingBuffer& obOutBuf);
+    void assign_buffers_CS_RADER(OperatingBuffer& flipIn,
+                                 OperatingBuffer& flipOut,
+                                 OperatingBuffer& obOutBuf);
     void assign_buffers_CS_L1D_TRTRT(OperatingBuffer& flipIn,
                                      OperatingBuffer& flipOut,
                                      OperatingBuffer& obOutBuf);
@@ -298,26 +465,90 @@ public:
     void assign_params_CS_L1D_CC();
     void assign_params_CS_L1D_CRT();
     void assign_params_CS_BLUESTEIN();
+    void assign_params_CS_RADER();
     void assign_params_CS_L1D_TRTRT();
     void assign_params_CS_2D_RTRT();
     void assign_params_CS_2D_RC_STRAIGHT();
     void assign_params_CS_3D_RTRT();
     void assign_params_CS_3D_RC_STRAIGHT();
+    void assign_params_CS_RTRT_INPLACE();
 
     // Determine work memory requirements:
     void TraverseTreeCollectLeafsLogicA(std::vector<TreeNode*>& seq,
                                         size_t&                 tmpBufSize,
                                         size_t&                 cmplxForRealSize,
-                                        size_t&                 blueSize,
-                                        size_t&                 chirpSize);
+                                        size_t&                 blueSize);
 
     // Output plan information for debug purposes:
     void Print(std::ostream& os = std::cout, int indent = 0) const;
+};
+
+// Per-plan storage for tree nodes.  Nodes are constructed in fixed-size
+// blocks, so building a tree costs one allocation per block rather than one
+// per node, and the whole tree is freed at once.
+class TreeNodeArena
+{
+    static const size_t blockNodes = 32;
+
+    typedef typename std::aligned_storage<sizeof(TreeNode), alignof(TreeNode)>::type NodeStorage;
+
+    struct Block
+    {
+        NodeStorage nodes[blockNodes];
+    };
+
+    Block                               first;
+    std::vector<std::unique_ptr<Block>> blocks;
+    size_t                              used;
+
+public:
+    TreeNodeArena()
+        : used(0)
+    {
+    }
+
+    TreeNodeArena(const TreeNodeArena&) = delete;
+    TreeNodeArena& operator=(const TreeNodeArena&) = delete;
+
+    ~TreeNodeArena()
+    {
+        for(size_t i = 0; i < used; ++i)
+            Slot(i)->~TreeNode();
+    }
+
+    TreeNode* Allocate(TreeNode* parent)
+    {
+        if(used == blockNodes * (blocks.size() + 1))
+            blocks.emplace_back(new Block);
+        return new(Slot(used++)) TreeNode(parent, this);
+    }
 
-    // logic B - using in-place transposes, todo
-    //void RecursiveBuildTreeLogicB();
+private:
+    TreeNode* Slot(size_t i)
+    {
+        Block& b = i < blockNodes ? first : *blocks[i / blockNodes - 1];
+        return reinterpret_cast<TreeNode*>(&b.nodes[i % blockNodes]);
+    }
 };
 
+inline TreeNode* TreeNode::CreateNode(TreeNode* parentNode)
+{
+    if(parentNode)
+        return parentNode->arena->Allocate(parentNode);
+    return (new TreeNodeArena)->Allocate(nullptr);
+}
+
+inline void TreeNode::DeleteNode(TreeNode* node)
+{
+    if(!node)
+        return;
+
+    ReleaseNode(node);
+
+    if(!node->parent)
+        delete node->arena;
+}
+
 extern "C" {
 typedef void (*DevFnCall)(const void*, void*);
 }
@@ -328,6 +559,11 @@ struct GridParam
     // items, work groups is unsigned int
     unsigned int tpb_x, tpb_y, tpb_z;
 
+    // batch members covered by one launch; a larger batch is run in several
+    // launches so that each grid stays within the hardware limits.  0 if the
+    // grid of one member is already too large for the device.
+    size_t launchBatch;
+
     GridParam()
         : b_x(1)
         , b_y(1)
@@ -335,6 +571,7 @@ struct GridParam
         , tpb_x(1)
         , tpb_y(1)
         , tpb_z(1)
+        , launchBatch(1)
     {
     }
 };
@@ -349,7 +586,16 @@ struct ExecPlan
     size_t                 tmpWorkBufSize;
     size_t                 copyWorkBufSize;
     size_t                 blueWorkBufSize;
-    size_t                 chirpWorkBufSize;
+
+    // Offsets of the OB_TEMP, OB_TEMP_CMPLX_FOR_REAL and OB_TEMP_BLUESTEIN
+    // regions in the work buffer; regions that are never live at the same
+    // time in execSeq may overlap
+    size_t tmpWorkBufOffset;
+    size_t copyWorkBufOffset;
+    size_t blueWorkBufOffset;
+
+    // Rewrites of execSeq that fired, for the plan printout
+    std::vector<std::string> rewrites;
 
     ExecPlan()
         : rootPlan(nullptr)
@@ -357,6 +603,9 @@ struct ExecPlan
         , tmpWorkBufSize(0)
         , copyWorkBufSize(0)
         , blueWorkBufSize(0)
+        , tmpWorkBufOffset(0)
+        , copyWorkBufOffset(0)
+        , blueWorkBufOffset(0)
     {
     }
 };
@@ -8,6 +8,7 @@
 
 #include "rocfft.h"
 #include <cassert>
+#include <complex>
 #include <math.h>
 #include <tuple>
 #include <vector>
@@ -179,7 +180,36 @@ public:
     }
 };
 
+// Device twiddle table, or nullptr if it cannot be allocated on the device
 void* twiddles_create(size_t N, rocfft_precision precision, bool large, bool no_radices);
 void  twiddles_delete(void* twt);
 
+// Device twiddles of a CS_KERNEL_2D_SINGLE or CS_KERNEL_3D_SINGLE kernel:
+// the tables of its first dim lengths one after the other, or nullptr if
+// they cannot be allocated on the device
+void* twiddles_create_single_kernel(const std::vector<size_t>& lengths,
+                                    const size_t               dim,
+                                    rocfft_precision           precision);
+
+// Device table of the Bluestein chirp of a length N transform padded to M,
+// followed by its FFT, both computed on the device.  Plans with the same N,
+// M, direction and precision share one table; each chirp_create is released
+// by a chirp_delete.  Returns nullptr if the table cannot be allocated or
+// computed on the device.
+void* chirp_create(size_t N, size_t M, int direction, rocfft_precision precision);
+
+// Device table of the FFT of the Rader kernel of a prime length N transform
+// with primitive root g, shared in the same way and released by chirp_delete.
+void* rader_create(size_t N, size_t g, int direction, rocfft_precision precision);
+void  chirp_delete(void* chirp);
+
+// The same tables in double precision on the host, for the host backend.
+// They are shared and released in the same way by host_chirp_delete, and
+// are nullptr if they do not fit in host memory.
+typedef std::vector<std::complex<double>> HostChirpTable;
+
+const HostChirpTable* host_chirp_create(size_t N, size_t M, int direction);
+const HostChirpTable* host_rader_create(size_t N, size_t g, int direction);
+void                  host_chirp_delete(const HostChirpTable* chirp);
+
 #endif // defined( TWIDDLES_H )
@@ -0,0 +1,70 @@
+/******************************************************************************
+* Copyright (c) 2016 - present Advanced Micro Devices, Inc. All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*******************************************************************************/
+
+#ifndef WISDOM_H
+#define WISDOM_H
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "plan.h"
+#include "plan_cost.h"
+
+// Decisions of the planner for each problem, keyed by the plan with its
+// creation mode cleared so that a measured problem is found whatever mode
+// later plans use.
+class Wisdom
+{
+    Wisdom() {}
+
+    std::map<rocfft_plan_t, std::vector<Plan1DDecision>> decisions;
+    std::mutex                                           mtx;
+
+    static rocfft_plan_t Key(const rocfft_plan_t& plan);
+
+public:
+    Wisdom(const Wisdom&) = delete;
+    Wisdom& operator=(const Wisdom&) = delete;
+
+    static Wisdom& GetWisdom()
+    {
+        static Wisdom wisdom;
+        return wisdom;
+    }
+
+    bool Find(const rocfft_plan_t& plan, std::vector<Plan1DDecision>& decided);
+    void Record(const rocfft_plan_t& plan, const std::vector<Plan1DDecision>& decided);
+
+    // Text form of all the decisions, and merging of decisions read back
+    // from it; nothing is merged if the text does not parse.
+    std::string Export();
+    bool        Import(const std::string& text);
+};
+
+// Time the candidate decompositions of a plan on the execution backend of
+// its description, within the time limit of its description, and return the
+// decisions of the fastest tree.
+void MeasurePlan(const rocfft_plan_t& plan, std::vector<Plan1DDecision>& best);
+
+#endif // WISDOM_H
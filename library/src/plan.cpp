@@ -20,10 +20,12 @@
 
 #include "plan.h"
 #include "logging.h"
+#include "plan_cost.h"
 #include "private.h"
 #include "radix_table.h"
 #include "repo.h"
 #include "rocfft.h"
+#include "transform.h"
 
 #include <algorithm>
 #include <assert.h>
@@ -35,7 +37,6 @@
 
 #define TO_STR2(x) #x
 #define TO_STR(x) TO_STR2(x)
-#define ENUMSTR(x) x, TO_STR(x)
 
 // clang-format off
 #define VERSION_STRING (TO_STR(rocfft_version_major) "." \
@@ -44,87 +45,108 @@
                         TO_STR(rocfft_version_tweak) )
 // clang-format on
 
+// Name tables are indexed by enum value, so they must list every
+// enumerator in declaration order.
+static constexpr const char* ComputeSchemetoString[] = {TO_STR(CS_NONE),
+                                                        TO_STR(CS_KERNEL_STOCKHAM),
+                                                        TO_STR(CS_KERNEL_STOCKHAM_BLOCK_CC),
+                                                        TO_STR(CS_KERNEL_STOCKHAM_BLOCK_RC),
+                                                        TO_STR(CS_KERNEL_TRANSPOSE),
+                                                        TO_STR(CS_KERNEL_TRANSPOSE_XY_Z),
+                                                        TO_STR(CS_KERNEL_TRANSPOSE_Z_XY),
+                                                        TO_STR(CS_KERNEL_TRANSPOSE_INPLACE),
+
+                                                        TO_STR(CS_REAL_TRANSFORM_USING_CMPLX),
+                                                        TO_STR(CS_KERNEL_COPY_R_TO_CMPLX),
+                                                        TO_STR(CS_KERNEL_COPY_CMPLX_TO_HERM),
+                                                        TO_STR(CS_KERNEL_COPY_HERM_TO_CMPLX),
+                                                        TO_STR(CS_KERNEL_COPY_CMPLX_TO_R),
+
+                                                        TO_STR(CS_REAL_TRANSFORM_PAIR),
+                                                        TO_STR(CS_KERNEL_PAIR_R_TO_CMPLX),
+                                                        TO_STR(CS_KERNEL_PAIR_CMPLX_TO_HERM),
+                                                        TO_STR(CS_KERNEL_PAIR_HERM_TO_CMPLX),
+                                                        TO_STR(CS_KERNEL_PAIR_CMPLX_TO_R),
+
+                                                        TO_STR(CS_REAL_TRANSFORM_EVEN),
+                                                        TO_STR(CS_KERNEL_R_TO_CMPLX),
+                                                        TO_STR(CS_KERNEL_CMPLX_TO_R),
+                                                        TO_STR(CS_KERNEL_PACK_R_TO_CMPLX),
+                                                        TO_STR(CS_KERNEL_UNPACK_CMPLX_TO_R),
+                                                        TO_STR(CS_REAL_2D_EVEN),
+                                                        TO_STR(CS_REAL_3D_EVEN),
+
+                                                        TO_STR(CS_BLUESTEIN),
+                                                        TO_STR(CS_KERNEL_PAD_MUL),
+                                                        TO_STR(CS_KERNEL_FFT_MUL),
+                                                        TO_STR(CS_KERNEL_RES_MUL),
+
+                                                        TO_STR(CS_RADER),
+                                                        TO_STR(CS_KERNEL_RADER_PERMUTE),
+                                                        TO_STR(CS_KERNEL_RADER_MUL),
+                                                        TO_STR(CS_KERNEL_RADER_UNPERMUTE),
+
+                                                        TO_STR(CS_L1D_TRTRT),
+                                                        TO_STR(CS_L1D_CC),
+                                                        TO_STR(CS_L1D_CRT),
+                                                        TO_STR(CS_L1D_PFA),
+
+                                                        TO_STR(CS_2D_STRAIGHT),
+                                                        TO_STR(CS_2D_RTRT),
+                                                        TO_STR(CS_2D_RC),
+                                                        TO_STR(CS_KERNEL_2D_STOCKHAM_BLOCK_CC),
+                                                        TO_STR(CS_KERNEL_2D_SINGLE),
+
+                                                        TO_STR(CS_3D_STRAIGHT),
+                                                        TO_STR(CS_3D_RTRT),
+                                                        TO_STR(CS_3D_RC),
+                                                        TO_STR(CS_KERNEL_3D_STOCKHAM_BLOCK_CC),
+                                                        TO_STR(CS_KERNEL_3D_SINGLE)};
+static_assert(sizeof(ComputeSchemetoString) / sizeof(ComputeSchemetoString[0])
+                  == CS_KERNEL_3D_SINGLE + 1,
+              "ComputeSchemetoString must name every ComputeScheme");
+
+static constexpr const char* BuffertoString[] = {TO_STR(OB_UNINIT),
+                                                 TO_STR(OB_USER_IN),
+                                                 TO_STR(OB_USER_OUT),
+                                                 TO_STR(OB_TEMP),
+                                                 TO_STR(OB_TEMP_CMPLX_FOR_REAL),
+                                                 TO_STR(OB_TEMP_BLUESTEIN)};
+static constexpr const char* BuffertoCode[]   = {"ERR", "A", "B", "T", "C", "S"};
+static_assert(sizeof(BuffertoString) / sizeof(BuffertoString[0]) == OB_TEMP_BLUESTEIN + 1,
+              "BuffertoString must name every OperatingBuffer");
+static_assert(sizeof(BuffertoCode) / sizeof(BuffertoCode[0]) == OB_TEMP_BLUESTEIN + 1,
+              "BuffertoCode must name every OperatingBuffer");
+
+static constexpr const char* array_type_to_string[]
+    = {TO_STR(rocfft_array_type_complex_interleaved),
+       TO_STR(rocfft_array_type_complex_planar),
+       TO_STR(rocfft_array_type_real),
+       TO_STR(rocfft_array_type_hermitian_interleaved),
+       TO_STR(rocfft_array_type_hermitian_planar),
+       TO_STR(rocfft_array_type_unset)};
+static_assert(sizeof(array_type_to_string) / sizeof(array_type_to_string[0])
+                  == rocfft_array_type_unset + 1,
+              "array_type_to_string must name every rocfft_array_type");
+
 std::string PrintScheme(ComputeScheme cs)
 {
-    const std::map<ComputeScheme, const char*> ComputeSchemetoString
-        = {{ENUMSTR(CS_NONE)},
-           {ENUMSTR(CS_KERNEL_STOCKHAM)},
-           {ENUMSTR(CS_KERNEL_STOCKHAM_BLOCK_CC)},
-           {ENUMSTR(CS_KERNEL_STOCKHAM_BLOCK_RC)},
-           {ENUMSTR(CS_KERNEL_TRANSPOSE)},
-           {ENUMSTR(CS_KERNEL_TRANSPOSE_XY_Z)},
-           {ENUMSTR(CS_KERNEL_TRANSPOSE_Z_XY)},
-
-           {ENUMSTR(CS_REAL_TRANSFORM_USING_CMPLX)},
-           {ENUMSTR(CS_KERNEL_COPY_R_TO_CMPLX)},
-           {ENUMSTR(CS_KERNEL_COPY_CMPLX_TO_HERM)},
-           {ENUMSTR(CS_KERNEL_COPY_HERM_TO_CMPLX)},
-           {ENUMSTR(CS_KERNEL_COPY_CMPLX_TO_R)},
-
-           {ENUMSTR(CS_REAL_TRANSFORM_EVEN)},
-           {ENUMSTR(CS_KERNEL_R_TO_CMPLX)},
-           {ENUMSTR(CS_KERNEL_CMPLX_TO_R)},
-           {ENUMSTR(CS_REAL_2D_EVEN)},
-           {ENUMSTR(CS_REAL_3D_EVEN)},
-
-           {ENUMSTR(CS_BLUESTEIN)},
-           {ENUMSTR(CS_KERNEL_CHIRP)},
-           {ENUMSTR(CS_KERNEL_PAD_MUL)},
-           {ENUMSTR(CS_KERNEL_FFT_MUL)},
-           {ENUMSTR(CS_KERNEL_RES_MUL)},
-
-           {ENUMSTR(CS_L1D_TRTRT)},
-           {ENUMSTR(CS_L1D_CC)},
-           {ENUMSTR(CS_L1D_CRT)},
-
-           {ENUMSTR(CS_2D_STRAIGHT)},
-           {ENUMSTR(CS_2D_RTRT)},
-           {ENUMSTR(CS_2D_RC)},
-           {ENUMSTR(CS_KERNEL_2D_STOCKHAM_BLOCK_CC)},
-           {ENUMSTR(CS_KERNEL_2D_SINGLE)},
-
-           {ENUMSTR(CS_3D_STRAIGHT)},
-           {ENUMSTR(CS_3D_RTRT)},
-           {ENUMSTR(CS_3D_RC)},
-           {ENUMSTR(CS_KERNEL_3D_STOCKHAM_BLOCK_CC)},
-           {ENUMSTR(CS_KERNEL_3D_SINGLE)}};
-
-    return ComputeSchemetoString.at(cs);
+    return ComputeSchemetoString[cs];
 }
 
 std::string PrintOperatingBuffer(const OperatingBuffer ob)
 {
-    const std::map<OperatingBuffer, const char*> BuffertoString
-        = {{ENUMSTR(OB_UNINIT)},
-           {ENUMSTR(OB_USER_IN)},
-           {ENUMSTR(OB_USER_OUT)},
-           {ENUMSTR(OB_TEMP)},
-           {ENUMSTR(OB_TEMP_CMPLX_FOR_REAL)},
-           {ENUMSTR(OB_TEMP_BLUESTEIN)}};
-    return BuffertoString.at(ob);
+    return BuffertoString[ob];
 }
 
 std::string PrintOperatingBufferCode(const OperatingBuffer ob)
 {
-    const std::map<OperatingBuffer, const char*> BuffertoString = {{OB_UNINIT, "ERR"},
-                                                                   {OB_USER_IN, "A"},
-                                                                   {OB_USER_OUT, "B"},
-                                                                   {OB_TEMP, "T"},
-                                                                   {OB_TEMP_CMPLX_FOR_REAL, "C"},
-                                                                   {OB_TEMP_BLUESTEIN, "S"}};
-    return BuffertoString.at(ob);
+    return BuffertoCode[ob];
 }
 
 std::string PrintArrayType(const rocfft_array_type x)
 {
-    const std::map<rocfft_array_type, const char*> array_type_to_string
-        = {{ENUMSTR(rocfft_array_type_complex_interleaved)},
-           {ENUMSTR(rocfft_array_type_complex_planar)},
-           {ENUMSTR(rocfft_array_type_real)},
-           {ENUMSTR(rocfft_array_type_hermitian_interleaved)},
-           {ENUMSTR(rocfft_array_type_hermitian_planar)},
-           {ENUMSTR(rocfft_array_type_unset)}};
-    return array_type_to_string.at(x);
+    return array_type_to_string[x];
 }
 
 rocfft_status rocfft_plan_description_set_scale_float(rocfft_plan_description description,
@@ -217,6 +239,25 @@ rocfft_status rocfft_plan_description_set_data_layout(rocfft_plan_description de
     return rocfft_status_success;
 }
 
+rocfft_status rocfft_plan_description_set_plan_mode(rocfft_plan_description description,
+                                                    const rocfft_plan_mode  mode,
+                                                    const double            time_limit)
+{
+    log_trace(__func__, "description", description, "mode", mode, "time_limit", time_limit);
+    description->planMode  = mode;
+    description->timeLimit = time_limit;
+    return rocfft_status_success;
+}
+
+rocfft_status
+    rocfft_plan_description_set_execution_backend(rocfft_plan_description        description,
+                                                  const rocfft_execution_backend backend)
+{
+    log_trace(__func__, "description", description, "backend", backend);
+    description->backend = backend;
+    return rocfft_status_success;
+}
+
 rocfft_status rocfft_plan_description_create(rocfft_plan_description* description)
 {
     rocfft_plan_description desc = new rocfft_plan_description_t;
@@ -293,6 +334,28 @@ rocfft_status rocfft_plan_create_internal(rocfft_plan                   plan,
                 return rocfft_status_invalid_array_type;
             break;
         }
+
+        // In-place transform reads and writes the same data, so both
+        // offsets must address the same position of the buffer: equal
+        // offsets for complex data, and a real offset twice the Hermitian
+        // one for real data
+        if(placement == rocfft_placement_inplace)
+        {
+            auto reals = [](const rocfft_array_type type, const size_t offset) {
+                return ((type == rocfft_array_type_complex_interleaved)
+                        || (type == rocfft_array_type_hermitian_interleaved))
+                           ? 2 * offset
+                           : offset;
+            };
+            const size_t components
+                = (description->inArrayType == rocfft_array_type_complex_planar) ? 2 : 1;
+            for(size_t c = 0; c < components; c++)
+            {
+                if(reals(description->inArrayType, description->inOffset[c])
+                   != reals(description->outArrayType, description->outOffset[c]))
+                    return rocfft_status_invalid_offset;
+            }
+        }
     }
 
     if(dimensions > 3)
@@ -706,6 +769,14 @@ ROCFFT_EXPORT rocfft_status rocfft_repo_get_total_plan_count(size_t* count)
     return rocfft_status_success;
 }
 
+ROCFFT_EXPORT rocfft_status rocfft_plan_set_max_launch_batch(rocfft_plan plan, size_t max_batch)
+{
+    if(plan == nullptr || max_batch == 0)
+        return rocfft_status_invalid_arg_value;
+    Repo::LimitLaunchBatch(plan, max_batch);
+    return rocfft_status_success;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// Tree node builders
 
@@ -714,12 +785,48 @@ ROCFFT_EXPORT rocfft_status rocfft_repo_get_total_plan_count(size_t* count)
 // That should be done in buffer assignment stage or
 // TraverseTreeAssignPlacementsLogicA().
 
-void TreeNode::RecursiveBuildTree()
+// Whether the output of node is unit stride along its fastest dimension.
+// Children have no strides yet while the tree is built: nested 2D and 3D
+// nodes write through the output strides of their parent, and the complex
+// transforms of real ones work on a contiguous view of the data.
+static bool UnitColumnStride(const TreeNode* node)
+{
+    for(; node->parent != nullptr; node = node->parent)
+    {
+        if(node->parent->scheme == CS_REAL_TRANSFORM_USING_CMPLX
+           || node->parent->scheme == CS_REAL_TRANSFORM_PAIR
+           || node->parent->scheme == CS_REAL_TRANSFORM_EVEN)
+            return true;
+    }
+    return node->outStride[0] == 1;
+}
+
+// Whether the real data of an even-length real transform can be viewed in
+// place as complex data of half the length: it has to be unit stride along
+// the fastest dimension, and the other strides and the distance have to be
+// whole complex elements.  The 1D real transforms of 2D and 3D ones access
+// the real data with the strides of the root.
+static bool RealAsComplex(const TreeNode* node)
 {
-    // this flag can be enabled when generator can do block column fft in
-    // multi-dimension cases and small 2d, 3d within one kernel
-    bool MultiDimFuseKernelsAvailable = false;
+    while(node->parent != nullptr)
+        node = node->parent;
 
+    const bool   forward = node->inArrayType == rocfft_array_type_real;
+    const auto&  stride  = forward ? node->inStride : node->outStride;
+    const size_t dist    = forward ? node->iDist : node->oDist;
+
+    if(stride[0] != 1 || dist % 2 != 0)
+        return false;
+    for(size_t i = 1; i < stride.size(); ++i)
+    {
+        if(stride[i] % 2 != 0)
+            return false;
+    }
+    return true;
+}
+
+void TreeNode::RecursiveBuildTree()
+{
     if((parent == nullptr)
        && ((inArrayType == rocfft_array_type_real) || (outArrayType == rocfft_array_type_real)))
     {
@@ -738,26 +845,7 @@ void TreeNode::RecursiveBuildTree()
         if(scheme == CS_KERNEL_TRANSPOSE)
             return;
 
-        if(MultiDimFuseKernelsAvailable)
-        {
-            // conditions to choose which scheme
-            if((length[0] * length[1]) <= 2048)
-            {
-                scheme = CS_KERNEL_2D_SINGLE;
-            }
-            else if(length[1] <= 256)
-            {
-                scheme = CS_2D_RC;
-            }
-            else
-            {
-                scheme = CS_2D_RTRT;
-            }
-        }
-        else
-        {
-            scheme = CS_2D_RTRT;
-        }
+        build_multi_dim();
 
         switch(scheme)
         {
@@ -798,9 +886,8 @@ void TreeNode::RecursiveBuildTree()
         }
         break;
         case CS_KERNEL_2D_SINGLE:
-        {
-        }
-        break;
+            // leaf node, the whole transform is one kernel
+            break;
 
         default:
             assert(false);
@@ -810,20 +897,7 @@ void TreeNode::RecursiveBuildTree()
 
     case 3:
     {
-        if(MultiDimFuseKernelsAvailable)
-        {
-            // conditions to choose which scheme
-            if((length[0] * length[1] * length[2]) <= 2048)
-                scheme = CS_KERNEL_3D_SINGLE;
-            else if(length[2] <= 256)
-                scheme = CS_3D_RC;
-            else
-                scheme = CS_3D_RTRT;
-        }
-        else
-        {
-            scheme = CS_3D_RTRT;
-        }
+        build_multi_dim();
 
         switch(scheme)
         {
@@ -868,9 +942,8 @@ void TreeNode::RecursiveBuildTree()
         }
         break;
         case CS_KERNEL_3D_SINGLE:
-        {
-        }
-        break;
+            // leaf node, the whole transform is one kernel
+            break;
 
         default:
             assert(false);
@@ -883,9 +956,51 @@ void TreeNode::RecursiveBuildTree()
     }
 }
 
+void TreeNode::build_multi_dim()
+{
+    // Pick the 2D or 3D scheme that the cost model of the plan's backend
+    // finds cheapest
+
+    size_t count = batch;
+    for(size_t index = dimension; index < length.size(); index++)
+        count *= length[index];
+
+    scheme = ChoosePlanMultiDim(length,
+                                dimension,
+                                std::max<size_t>(count, 1),
+                                UnitColumnStride(this),
+                                precision,
+                                GetPlanCostModel(backend));
+}
+
+// Whether the real transforms of a node are computed in pairs of batch
+// members.  The pair kernels handle up to three dimensions and interleaved
+// hermitian data; the cost model decides against the other real schemes.
+static bool RealPairs(const TreeNode* node)
+{
+    if(node->batch < 2 || node->dimension > 3)
+        return false;
+
+    const rocfft_array_type hermType
+        = (node->inArrayType == rocfft_array_type_real) ? node->outArrayType : node->inArrayType;
+    if(hermType != rocfft_array_type_hermitian_interleaved)
+        return false;
+
+    return ChooseRealPairs(node->length,
+                           node->dimension,
+                           node->batch,
+                           RealAsComplex(node),
+                           node->precision,
+                           GetPlanCostModel(node->backend));
+}
+
 void TreeNode::build_real()
 {
-    if(length[0] % 2 == 0 && inStride[0] == 1 && outStride[0] == 1)
+    if(RealPairs(this))
+    {
+        build_real_pair();
+    }
+    else if(length[0] % 2 == 0)
     {
         switch(dimension)
         {
@@ -943,6 +1058,40 @@ void TreeNode::build_real_embed()
     childNodes.push_back(copyTailPlan);
 }
 
+void TreeNode::build_real_pair()
+{
+    // Transform pairs of batch members as the real and imaginary parts of
+    // one complex transform, and separate the results of both members.
+
+    scheme = CS_REAL_TRANSFORM_PAIR;
+
+    TreeNode* headPlan = TreeNode::CreateNode(this);
+
+    headPlan->dimension = dimension;
+    headPlan->length    = length;
+    headPlan->scheme    = (inArrayType == rocfft_array_type_real) ? CS_KERNEL_PAIR_R_TO_CMPLX
+                                                               : CS_KERNEL_PAIR_HERM_TO_CMPLX;
+    childNodes.push_back(headPlan);
+
+    // complex fft over the pairs
+    TreeNode* fftPlan = TreeNode::CreateNode(this);
+
+    fftPlan->dimension = dimension;
+    fftPlan->length    = length;
+    fftPlan->batch     = (batch + 1) / 2;
+
+    fftPlan->RecursiveBuildTree();
+    childNodes.push_back(fftPlan);
+
+    TreeNode* tailPlan = TreeNode::CreateNode(this);
+
+    tailPlan->dimension = dimension;
+    tailPlan->length    = length;
+    tailPlan->scheme    = (inArrayType == rocfft_array_type_real) ? CS_KERNEL_PAIR_CMPLX_TO_HERM
+                                                               : CS_KERNEL_PAIR_CMPLX_TO_R;
+    childNodes.push_back(tailPlan);
+}
+
 void TreeNode::build_real_even_1D()
 {
     // Fastest moving dimension must be even:
@@ -950,6 +1099,10 @@ void TreeNode::build_real_even_1D()
 
     scheme = CS_REAL_TRANSFORM_EVEN;
 
+    // Strided real data is first packed into a contiguous complex buffer
+    // of half the length, or unpacked from it at the end.
+    const bool inplaceView = RealAsComplex(this);
+
     TreeNode* cfftPlan  = TreeNode::CreateNode(this);
     cfftPlan->dimension = dimension;
     cfftPlan->length    = length;
@@ -963,9 +1116,21 @@ void TreeNode::build_real_even_1D()
     {
         // real-to-complex transform: in-place complex transform then post-process
 
-        // cfftPlan works in-place on the input buffer.
-        // NB: the input buffer is real, but we treat it as complex
-        cfftPlan->obOut = obIn;
+        if(inplaceView)
+        {
+            // cfftPlan works in-place on the input buffer.
+            // NB: the input buffer is real, but we treat it as complex
+            cfftPlan->obOut = obIn;
+        }
+        else
+        {
+            TreeNode* packPlan  = TreeNode::CreateNode(this);
+            packPlan->scheme    = CS_KERNEL_PACK_R_TO_CMPLX;
+            packPlan->dimension = 1;
+            packPlan->length    = cfftPlan->length;
+
+            childNodes.push_back(packPlan);
+        }
         cfftPlan->RecursiveBuildTree();
         childNodes.push_back(cfftPlan);
 
@@ -990,11 +1155,24 @@ void TreeNode::build_real_even_1D()
 
         childNodes.push_back(prePlan);
 
-        // cfftPlan works in-place on the output buffer.
-        // NB: the output buffer is real, but we treat it as complex
-        cfftPlan->obIn = obOut;
+        if(inplaceView)
+        {
+            // cfftPlan works in-place on the output buffer.
+            // NB: the output buffer is real, but we treat it as complex
+            cfftPlan->obIn = obOut;
+        }
         cfftPlan->RecursiveBuildTree();
         childNodes.push_back(cfftPlan);
+
+        if(!inplaceView)
+        {
+            TreeNode* unpackPlan  = TreeNode::CreateNode(this);
+            unpackPlan->scheme    = CS_KERNEL_UNPACK_CMPLX_TO_R;
+            unpackPlan->dimension = 1;
+            unpackPlan->length    = cfftPlan->length;
+
+            childNodes.push_back(unpackPlan);
+        }
         break;
     }
     default:
@@ -1266,123 +1444,55 @@ void TreeNode::build_real_even_3D()
     }
 }
 
-size_t TreeNode::div1DNoPo2(const size_t length0)
-{
-    const size_t supported[]
-        = {4096, 4050, 4000, 3888, 3840, 3750, 3645, 3600, 3456, 3375, 3240, 3200, 3125, 3072,
-           3000, 2916, 2880, 2700, 2592, 2560, 2500, 2430, 2400, 2304, 2250, 2187, 2160, 2048,
-           2025, 2000, 1944, 1920, 1875, 1800, 1728, 1620, 1600, 1536, 1500, 1458, 1440, 1350,
-           1296, 1280, 1250, 1215, 1200, 1152, 1125, 1080, 1024, 1000, 972,  960,  900,  864,
-           810,  800,  768,  750,  729,  720,  675,  648,  640,  625,  600,  576,  540,  512,
-           500,  486,  480,  450,  432,  405,  400,  384,  375,  360,  324,  320,  300,  288,
-           270,  256,  250,  243,  240,  225,  216,  200,  192,  180,  162,  160,  150,  144,
-           135,  128,  125,  120,  108,  100,  96,   90,   81,   80,   75,   72,   64,   60,
-           54,   50,   48,   45,   40,   36,   32,   30,   27,   25,   24,   20,   18,   16,
-           15,   12,   10,   9,    8,    6,    5,    4,    3,    2,    1};
-
-    size_t idx;
-    if(length0 > (Large1DThreshold(precision) * Large1DThreshold(precision)))
-    {
-        idx = 0;
-        while(supported[idx] != Large1DThreshold(precision))
-        {
-            idx++;
-        }
-        while(length0 % supported[idx] != 0)
-        {
-            idx++;
-        }
-    }
-    else
-    {
-        // logic tries to break into as squarish matrix as possible
-        size_t sqr = (size_t)sqrt(length0);
-        idx        = sizeof(supported) / sizeof(supported[0]) - 1;
-        while(supported[idx] < sqr)
-        {
-            idx--;
-        }
-        while(length0 % supported[idx] != 0)
-        {
-            idx++;
-        }
-    }
-    assert(idx < sizeof(supported) / sizeof(supported[0]));
-    return length0 / supported[idx];
-}
-
 void TreeNode::build_1D()
 {
-    // Build a node for a 1D FFT
+    // Build a node for a 1D FFT, using the decomposition that the cost
+    // model of the plan's backend finds cheapest
 
-    if(!SupportedLength(length[0]))
-    {
-        build_1DBluestein();
-        return;
-    }
-
-    if(length[0] <= Large1DThreshold(precision)) // single kernel algorithm
+    size_t count = batch;
+    for(size_t index = 1; index < length.size(); index++)
+        count *= length[index];
+
+    const auto candidates = EnumeratePlan1D(length[0],
+                                            std::max<size_t>(count, 1),
+                                            precision,
+                                            GetPlanCostModel(backend));
+    assert(!candidates.empty());
+
+    const TreeNode* root = this;
+    while(root->parent != nullptr)
+        root = root->parent;
+    const Plan1DCandidate best = (root->decisions != nullptr)
+                                     ? root->decisions->Choose(length[0], candidates)
+                                     : candidates.front();
+
+    switch(best.scheme)
     {
+    case CS_KERNEL_STOCKHAM:
         scheme = CS_KERNEL_STOCKHAM;
-        return;
-    }
-
-    size_t divLength1 = 1;
-
-    if(IsPo2(length[0])) // multiple kernels involving transpose
-    {
-        if(length[0] <= 262144 / PrecisionWidth(precision))
-        {
-            // Enable block compute under these conditions
-            if(1 == PrecisionWidth(precision))
-            {
-                divLength1 = Pow2Lengths1Single.at(length[0]);
-            }
-            else
-            {
-                divLength1 = Pow2Lengths1Double.at(length[0]);
-            }
-            scheme = (length[0] <= 65536 / PrecisionWidth(precision)) ? CS_L1D_CC : CS_L1D_CRT;
-        }
-        else
-        {
-            if(length[0] > (Large1DThreshold(precision) * Large1DThreshold(precision)))
-            {
-                divLength1 = length[0] / Large1DThreshold(precision);
-            }
-            else
-            {
-                size_t in_x = 0;
-                size_t len  = length[0];
-                while(len != 1)
-                {
-                    len >>= 1;
-                    in_x++;
-                }
-                in_x /= 2;
-                divLength1 = (size_t)1 << in_x;
-            }
-            scheme = CS_L1D_TRTRT;
-        }
-    }
-    else // if not Pow2
-    {
-        divLength1 = div1DNoPo2(length[0]);
-        scheme     = CS_L1D_TRTRT;
-    }
-
-    size_t divLength0 = length[0] / divLength1;
-
-    switch(scheme)
-    {
+        break;
+    case CS_BLUESTEIN:
+        lengthBlue = best.lengthBlue;
+        build_1DBluestein();
+        break;
+    case CS_RADER:
+        build_1DRader();
+        break;
     case CS_L1D_TRTRT:
-        build_1DCS_L1D_TRTRT(divLength0, divLength1);
+        scheme = CS_L1D_TRTRT;
+        build_1DCS_L1D_TRTRT(best.divLength0, best.divLength1);
         break;
     case CS_L1D_CC:
-        build_1DCS_L1D_CC(divLength0, divLength1);
+        scheme = CS_L1D_CC;
+        build_1DCS_L1D_CC(best.divLength0, best.divLength1);
         break;
     case CS_L1D_CRT:
-        build_1DCS_L1D_CRT(divLength0, divLength1);
+        scheme = CS_L1D_CRT;
+        build_1DCS_L1D_CRT(best.divLength0, best.divLength1);
+        break;
+    case CS_L1D_PFA:
+        scheme = CS_L1D_PFA;
+        build_1DCS_L1D_PFA(best.divLength0, best.divLength1);
         break;
     default:
         assert(false);
@@ -1392,21 +1502,11 @@ void TreeNode::build_1D()
 void TreeNode::build_1DBluestein()
 {
     // Build a node for a 1D stage using the Bluestein algorithm for
-    // general transform lengths.
+    // general transform lengths; lengthBlue is chosen by build_1D.  The
+    // chirp and its FFT only depend on the length and direction, so they
+    // are computed by PlanPowX rather than on every execution.
 
-    scheme     = CS_BLUESTEIN;
-    lengthBlue = FindBlue(length[0]);
-
-    TreeNode* chirpPlan = TreeNode::CreateNode(this);
-
-    chirpPlan->scheme    = CS_KERNEL_CHIRP;
-    chirpPlan->dimension = 1;
-    chirpPlan->length.push_back(length[0]);
-    chirpPlan->lengthBlue = lengthBlue;
-    chirpPlan->direction  = direction;
-    chirpPlan->batch      = 1;
-    chirpPlan->large1D    = 2 * length[0];
-    childNodes.push_back(chirpPlan);
+    scheme = CS_BLUESTEIN;
 
     TreeNode* padmulPlan = TreeNode::CreateNode(this);
 
@@ -1425,23 +1525,10 @@ void TreeNode::build_1DBluestein()
         fftiPlan->length.push_back(length[index]);
     }
 
-    fftiPlan->iOffset = 2 * lengthBlue;
-    fftiPlan->oOffset = 2 * lengthBlue;
-    fftiPlan->scheme  = CS_KERNEL_STOCKHAM;
+    fftiPlan->scheme = CS_KERNEL_STOCKHAM;
     fftiPlan->RecursiveBuildTree();
     childNodes.push_back(fftiPlan);
 
-    TreeNode* fftcPlan = TreeNode::CreateNode(this);
-
-    fftcPlan->dimension = 1;
-    fftcPlan->length.push_back(lengthBlue);
-    fftcPlan->scheme  = CS_KERNEL_STOCKHAM;
-    fftcPlan->batch   = 1;
-    fftcPlan->iOffset = lengthBlue;
-    fftcPlan->oOffset = lengthBlue;
-    fftcPlan->RecursiveBuildTree();
-    childNodes.push_back(fftcPlan);
-
     TreeNode* fftmulPlan = TreeNode::CreateNode(this);
 
     fftmulPlan->dimension = 1;
@@ -1466,8 +1553,6 @@ void TreeNode::build_1DBluestein()
 
     fftrPlan->scheme    = CS_KERNEL_STOCKHAM;
     fftrPlan->direction = -direction;
-    fftrPlan->iOffset   = 2 * lengthBlue;
-    fftrPlan->oOffset   = 2 * lengthBlue;
     fftrPlan->RecursiveBuildTree();
     childNodes.push_back(fftrPlan);
 
@@ -1480,6 +1565,70 @@ void TreeNode::build_1DBluestein()
     childNodes.push_back(resmulPlan);
 }
 
+void TreeNode::build_1DRader()
+{
+    // Build a node for a prime length stage using Rader's algorithm.  With g
+    // a primitive root modulo N, the outputs 1..N-1 are the cyclic
+    // convolution of the inputs permuted by powers of g with a kernel of
+    // twiddles permuted by powers of its inverse; the length N-1 convolution
+    // is computed by FFTs.  The FFT of the kernel only depends on the length
+    // and direction, so it is computed by PlanPowX.
+
+    scheme    = CS_RADER;
+    raderRoot = RaderRoot(length[0]);
+
+    TreeNode* permutePlan = TreeNode::CreateNode(this);
+
+    permutePlan->dimension = 1;
+    permutePlan->length    = length;
+    permutePlan->raderRoot = raderRoot;
+    permutePlan->scheme    = CS_KERNEL_RADER_PERMUTE;
+    childNodes.push_back(permutePlan);
+
+    TreeNode* fftiPlan = TreeNode::CreateNode(this);
+
+    fftiPlan->dimension = 1;
+    fftiPlan->length.push_back(length[0] - 1);
+    for(size_t index = 1; index < length.size(); index++)
+    {
+        fftiPlan->length.push_back(length[index]);
+    }
+
+    fftiPlan->scheme = CS_KERNEL_STOCKHAM;
+    fftiPlan->RecursiveBuildTree();
+    childNodes.push_back(fftiPlan);
+
+    TreeNode* mulPlan = TreeNode::CreateNode(this);
+
+    mulPlan->dimension = 1;
+    mulPlan->length    = length;
+    mulPlan->raderRoot = raderRoot;
+    mulPlan->scheme    = CS_KERNEL_RADER_MUL;
+    childNodes.push_back(mulPlan);
+
+    TreeNode* fftrPlan = TreeNode::CreateNode(this);
+
+    fftrPlan->dimension = 1;
+    fftrPlan->length.push_back(length[0] - 1);
+    for(size_t index = 1; index < length.size(); index++)
+    {
+        fftrPlan->length.push_back(length[index]);
+    }
+
+    fftrPlan->scheme    = CS_KERNEL_STOCKHAM;
+    fftrPlan->direction = -direction;
+    fftrPlan->RecursiveBuildTree();
+    childNodes.push_back(fftrPlan);
+
+    TreeNode* unpermutePlan = TreeNode::CreateNode(this);
+
+    unpermutePlan->dimension = 1;
+    unpermutePlan->length    = length;
+    unpermutePlan->raderRoot = raderRoot;
+    unpermutePlan->scheme    = CS_KERNEL_RADER_UNPERMUTE;
+    childNodes.push_back(unpermutePlan);
+}
+
 void TreeNode::build_1DCS_L1D_TRTRT(const size_t divLength0, const size_t divLength1)
 {
     // first transpose
@@ -1669,6 +1818,34 @@ void TreeNode::build_1DCS_L1D_CRT(const size_t divLength0, const size_t divLengt
     childNodes.push_back(transPlan);
 }
 
+void TreeNode::build_1DCS_L1D_PFA(const size_t divLength0, const size_t divLength1)
+{
+    // Good-Thomas: for coprime divLength0 and divLength1 the TRTRT plan needs
+    // no large 1D twiddles if the first transpose gathers the input with the
+    // Ruritanian map n = (divLength1 * n0 + divLength0 * n1) mod N and the
+    // last one scatters the output with the CRT map, k = k0 mod divLength0
+    // and k = k1 mod divLength1
+    build_1DCS_L1D_TRTRT(divLength0, divLength1);
+
+    const size_t N = length[0];
+
+    TreeNode* trans1Plan = childNodes[0];
+    TreeNode* trans2Plan = childNodes[2];
+    TreeNode* trans3Plan = childNodes[4];
+
+    trans1Plan->pfaIn[0]  = divLength1;
+    trans1Plan->pfaIn[1]  = divLength0;
+    trans1Plan->pfaOut[0] = divLength1;
+    trans1Plan->pfaOut[1] = 1;
+
+    trans2Plan->large1D = 0;
+
+    trans3Plan->pfaIn[0]  = 1;
+    trans3Plan->pfaIn[1]  = divLength0;
+    trans3Plan->pfaOut[0] = divLength1 * InverseMod(divLength1, divLength0) % N;
+    trans3Plan->pfaOut[1] = divLength0 * InverseMod(divLength0, divLength1) % N;
+}
+
 void TreeNode::build_CS_2D_RTRT()
 {
     // first row fft
@@ -1767,6 +1944,191 @@ void TreeNode::build_CS_3D_RTRT()
     childNodes.push_back(trans2Plan);
 }
 
+void TreeNode::RecursiveBuildTreeLogicB()
+{
+    // Logic B mirrors RecursiveBuildTree for contiguous in-place complex
+    // data, replacing each out-of-place transpose with an in-place one so
+    // that the plan needs no temporary buffer.
+    switch(dimension)
+    {
+    case 1:
+    {
+        // Of the large 1D decompositions, only column-row-transpose works
+        // in place: its column and row kernels write what they read.
+        size_t count = batch;
+        for(size_t index = 1; index < length.size(); index++)
+            count *= length[index];
+
+        const auto candidates = EnumeratePlan1D(length[0],
+                                                std::max<size_t>(count, 1),
+                                                precision,
+                                                GetPlanCostModel(backend));
+        const auto best = std::find_if(
+            candidates.begin(), candidates.end(), [](const Plan1DCandidate& c) {
+                return c.scheme == CS_KERNEL_STOCKHAM || c.scheme == CS_L1D_CRT;
+            });
+
+        if(best == candidates.end())
+        {
+            // Bluestein and Rader need their own buffers anyway.
+            RecursiveBuildTree();
+        }
+        else if(best->scheme == CS_KERNEL_STOCKHAM)
+        {
+            scheme = CS_KERNEL_STOCKHAM;
+        }
+        else
+        {
+            scheme = CS_L1D_CRT;
+            build_1DCS_L1D_CRT(best->divLength0, best->divLength1);
+            childNodes[2]->scheme = CS_KERNEL_TRANSPOSE_INPLACE;
+        }
+    }
+    break;
+
+    case 2:
+    {
+        build_multi_dim();
+
+        switch(scheme)
+        {
+        case CS_2D_RTRT:
+        {
+            // row fft
+            TreeNode* row1Plan  = TreeNode::CreateNode(this);
+            row1Plan->length    = length;
+            row1Plan->dimension = 1;
+            row1Plan->RecursiveBuildTreeLogicB();
+            childNodes.push_back(row1Plan);
+
+            // transpose
+            TreeNode* trans1Plan  = TreeNode::CreateNode(this);
+            trans1Plan->length    = length;
+            trans1Plan->scheme    = CS_KERNEL_TRANSPOSE_INPLACE;
+            trans1Plan->dimension = 2;
+            childNodes.push_back(trans1Plan);
+
+            // column fft, as rows of the transposed data
+            TreeNode* row2Plan  = TreeNode::CreateNode(this);
+            row2Plan->length    = length;
+            row2Plan->length[0] = length[1];
+            row2Plan->length[1] = length[0];
+            row2Plan->dimension = 1;
+            row2Plan->RecursiveBuildTreeLogicB();
+            childNodes.push_back(row2Plan);
+
+            // transpose back
+            TreeNode* trans2Plan  = TreeNode::CreateNode(this);
+            trans2Plan->length    = row2Plan->length;
+            trans2Plan->scheme    = CS_KERNEL_TRANSPOSE_INPLACE;
+            trans2Plan->dimension = 2;
+            childNodes.push_back(trans2Plan);
+        }
+        break;
+        case CS_2D_RC:
+        {
+            // row fft
+            TreeNode* rowPlan  = TreeNode::CreateNode(this);
+            rowPlan->length    = length;
+            rowPlan->dimension = 1;
+            rowPlan->RecursiveBuildTreeLogicB();
+            childNodes.push_back(rowPlan);
+
+            // column fft
+            TreeNode* colPlan  = TreeNode::CreateNode(this);
+            colPlan->length    = length;
+            colPlan->length[0] = length[1];
+            colPlan->length[1] = length[0];
+            colPlan->dimension = 1;
+            colPlan->scheme    = CS_KERNEL_2D_STOCKHAM_BLOCK_CC;
+            childNodes.push_back(colPlan);
+        }
+        break;
+        case CS_KERNEL_2D_SINGLE:
+            // leaf node, the whole transform is one kernel
+            break;
+
+        default:
+            assert(false);
+        }
+    }
+    break;
+
+    case 3:
+    {
+        build_multi_dim();
+
+        switch(scheme)
+        {
+        case CS_3D_RTRT:
+        {
+            // 2d fft
+            TreeNode* xyPlan  = TreeNode::CreateNode(this);
+            xyPlan->length    = length;
+            xyPlan->dimension = 2;
+            xyPlan->RecursiveBuildTreeLogicB();
+            childNodes.push_back(xyPlan);
+
+            // transpose the xy planes with the z columns
+            TreeNode* trans1Plan = TreeNode::CreateNode(this);
+            trans1Plan->length.push_back(length[0] * length[1]);
+            trans1Plan->length.push_back(length[2]);
+            trans1Plan->scheme    = CS_KERNEL_TRANSPOSE_INPLACE;
+            trans1Plan->dimension = 2;
+            childNodes.push_back(trans1Plan);
+
+            // z fft
+            TreeNode* zPlan  = TreeNode::CreateNode(this);
+            zPlan->dimension = 1;
+            zPlan->length.push_back(length[2]);
+            zPlan->length.push_back(length[0]);
+            zPlan->length.push_back(length[1]);
+            zPlan->RecursiveBuildTreeLogicB();
+            childNodes.push_back(zPlan);
+
+            // transpose back
+            TreeNode* trans2Plan = TreeNode::CreateNode(this);
+            trans2Plan->length.push_back(length[2]);
+            trans2Plan->length.push_back(length[0] * length[1]);
+            trans2Plan->scheme    = CS_KERNEL_TRANSPOSE_INPLACE;
+            trans2Plan->dimension = 2;
+            childNodes.push_back(trans2Plan);
+        }
+        break;
+        case CS_3D_RC:
+        {
+            // 2d fft
+            TreeNode* xyPlan  = TreeNode::CreateNode(this);
+            xyPlan->length    = length;
+            xyPlan->dimension = 2;
+            xyPlan->RecursiveBuildTreeLogicB();
+            childNodes.push_back(xyPlan);
+
+            // z col fft
+            TreeNode* zPlan  = TreeNode::CreateNode(this);
+            zPlan->dimension = 1;
+            zPlan->length.push_back(length[2]);
+            zPlan->length.push_back(length[0]);
+            zPlan->length.push_back(length[1]);
+            zPlan->scheme = CS_KERNEL_3D_STOCKHAM_BLOCK_CC;
+            childNodes.push_back(zPlan);
+        }
+        break;
+        case CS_KERNEL_3D_SINGLE:
+            // leaf node, the whole transform is one kernel
+            break;
+
+        default:
+            assert(false);
+        }
+    }
+    break;
+
+    default:
+        assert(false);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// Buffer assignment
 
@@ -1786,6 +2148,7 @@ void TreeNode::TraverseTreeAssignBuffersLogicA(OperatingBuffer& flipIn,
         switch(scheme)
         {
         case CS_REAL_TRANSFORM_USING_CMPLX:
+        case CS_REAL_TRANSFORM_PAIR:
             flipIn   = OB_TEMP_CMPLX_FOR_REAL;
             flipOut  = OB_TEMP;
             obOutBuf = OB_TEMP_CMPLX_FOR_REAL;
@@ -1799,6 +2162,7 @@ void TreeNode::TraverseTreeAssignBuffersLogicA(OperatingBuffer& flipIn,
                                                                                   : OB_USER_OUT;
             break;
         case CS_BLUESTEIN:
+        case CS_RADER:
             flipIn   = OB_TEMP_BLUESTEIN;
             flipOut  = OB_TEMP;
             obOutBuf = OB_TEMP_BLUESTEIN;
@@ -1832,6 +2196,7 @@ void TreeNode::TraverseTreeAssignBuffersLogicA(OperatingBuffer& flipIn,
     switch(scheme)
     {
     case CS_REAL_TRANSFORM_USING_CMPLX:
+    case CS_REAL_TRANSFORM_PAIR:
         assign_buffers_CS_REAL_TRANSFORM_USING_CMPLX(flipIn, flipOut, obOutBuf);
         break;
     case CS_REAL_TRANSFORM_EVEN:
@@ -1846,7 +2211,11 @@ void TreeNode::TraverseTreeAssignBuffersLogicA(OperatingBuffer& flipIn,
     case CS_BLUESTEIN:
         assign_buffers_CS_BLUESTEIN(flipIn, flipOut, obOutBuf);
         break;
+    case CS_RADER:
+        assign_buffers_CS_RADER(flipIn, flipOut, obOutBuf);
+        break;
     case CS_L1D_TRTRT:
+    case CS_L1D_PFA:
         assign_buffers_CS_L1D_TRTRT(flipIn, flipOut, obOutBuf);
         break;
     case CS_L1D_CC:
@@ -1892,13 +2261,6 @@ void TreeNode::TraverseTreeAssignBuffersLogicA(OperatingBuffer& flipIn,
     // Assert that the kernel chain is connected
     for(int i = 1; i < childNodes.size(); ++i)
     {
-        if(childNodes[i - 1]->scheme == CS_KERNEL_CHIRP)
-        {
-            // The Bluestein algorithm uses a separate buffer which is
-            // convoluted with the input; the chain assumption isn't true here.
-            // NB: we assume that the CS_KERNEL_CHIRP is first in the chain.
-            continue;
-        }
         assert(childNodes[i - 1]->obOut == childNodes[i]->obIn);
     }
 }
@@ -1910,14 +2272,15 @@ void TreeNode::assign_buffers_CS_REAL_TRANSFORM_USING_CMPLX(OperatingBuffer& fli
     assert(parent == nullptr);
     assert(childNodes.size() == 3);
 
-    assert((direction == -1 && childNodes[0]->scheme == CS_KERNEL_COPY_R_TO_CMPLX)
-           || (direction == 1 && childNodes[0]->scheme == CS_KERNEL_COPY_HERM_TO_CMPLX));
-
     obIn  = OB_USER_IN;
     obOut = placement == rocfft_placement_inplace ? OB_USER_IN : OB_USER_OUT;
 
-    assert((direction == -1 && childNodes[0]->scheme == CS_KERNEL_COPY_R_TO_CMPLX)
-           || (direction == 1 && childNodes[0]->scheme == CS_KERNEL_COPY_HERM_TO_CMPLX));
+    assert((direction == -1
+            && (childNodes[0]->scheme == CS_KERNEL_COPY_R_TO_CMPLX
+                || childNodes[0]->scheme == CS_KERNEL_PAIR_R_TO_CMPLX))
+           || (direction == 1
+               && (childNodes[0]->scheme == CS_KERNEL_COPY_HERM_TO_CMPLX
+                   || childNodes[0]->scheme == CS_KERNEL_PAIR_HERM_TO_CMPLX)));
 
     childNodes[0]->obIn         = obIn;
     childNodes[0]->obOut        = OB_TEMP_CMPLX_FOR_REAL;
@@ -1932,20 +2295,16 @@ void TreeNode::assign_buffers_CS_REAL_TRANSFORM_USING_CMPLX(OperatingBuffer& fli
     size_t cs = childNodes[1]->childNodes.size();
     if(cs)
     {
-        if(childNodes[1]->scheme == CS_BLUESTEIN)
-        {
-            assert(childNodes[1]->childNodes[0]->obIn == OB_TEMP_BLUESTEIN);
-            assert(childNodes[1]->childNodes[1]->obIn == OB_TEMP_CMPLX_FOR_REAL);
-        }
-        else
-        {
-            assert(childNodes[1]->childNodes[0]->obIn == OB_TEMP_CMPLX_FOR_REAL);
-        }
+        assert(childNodes[1]->childNodes[0]->obIn == OB_TEMP_CMPLX_FOR_REAL);
         assert(childNodes[1]->childNodes[cs - 1]->obOut == OB_TEMP_CMPLX_FOR_REAL);
     }
 
-    assert((direction == -1 && childNodes[2]->scheme == CS_KERNEL_COPY_CMPLX_TO_HERM)
-           || (direction == 1 && childNodes[2]->scheme == CS_KERNEL_COPY_CMPLX_TO_R));
+    assert((direction == -1
+            && (childNodes[2]->scheme == CS_KERNEL_COPY_CMPLX_TO_HERM
+                || childNodes[2]->scheme == CS_KERNEL_PAIR_CMPLX_TO_HERM))
+           || (direction == 1
+               && (childNodes[2]->scheme == CS_KERNEL_COPY_CMPLX_TO_R
+                   || childNodes[2]->scheme == CS_KERNEL_PAIR_CMPLX_TO_R)));
     childNodes[2]->obIn         = OB_TEMP_CMPLX_FOR_REAL;
     childNodes[2]->obOut        = obOut;
     childNodes[2]->inArrayType  = rocfft_array_type_complex_interleaved;
@@ -1962,6 +2321,43 @@ void TreeNode::assign_buffers_CS_REAL_TRANSFORM_EVEN(OperatingBuffer& flipIn,
         obOut = placement == rocfft_placement_inplace ? OB_USER_IN : OB_USER_OUT;
     }
 
+    if(childNodes.size() == 3)
+    {
+        // The real data is strided: the complex FFT works in-place on a
+        // packed copy of it.
+        OperatingBuffer cmplxFlipIn   = OB_TEMP_CMPLX_FOR_REAL;
+        OperatingBuffer cmplxFlipOut  = OB_TEMP;
+        OperatingBuffer cmplxObOutBuf = OB_TEMP_CMPLX_FOR_REAL;
+
+        childNodes[0]->obIn         = obIn;
+        childNodes[0]->obOut        = OB_TEMP_CMPLX_FOR_REAL;
+        childNodes[0]->inArrayType  = inArrayType;
+        childNodes[0]->outArrayType = rocfft_array_type_complex_interleaved;
+        if(direction == 1 && inArrayType == rocfft_array_type_complex_interleaved)
+        {
+            childNodes[0]->inArrayType = rocfft_array_type_hermitian_interleaved;
+        }
+
+        childNodes[1]->obIn         = OB_TEMP_CMPLX_FOR_REAL;
+        childNodes[1]->obOut        = OB_TEMP_CMPLX_FOR_REAL;
+        childNodes[1]->inArrayType  = rocfft_array_type_complex_interleaved;
+        childNodes[1]->outArrayType = rocfft_array_type_complex_interleaved;
+        childNodes[1]->TraverseTreeAssignBuffersLogicA(cmplxFlipIn, cmplxFlipOut, cmplxObOutBuf);
+
+        size_t cs = childNodes[1]->childNodes.size();
+        if(cs)
+        {
+            assert(childNodes[1]->childNodes[0]->obIn == OB_TEMP_CMPLX_FOR_REAL);
+            assert(childNodes[1]->childNodes[cs - 1]->obOut == OB_TEMP_CMPLX_FOR_REAL);
+        }
+
+        childNodes[2]->obIn         = OB_TEMP_CMPLX_FOR_REAL;
+        childNodes[2]->obOut        = obOut;
+        childNodes[2]->inArrayType  = rocfft_array_type_complex_interleaved;
+        childNodes[2]->outArrayType = outArrayType;
+        return;
+    }
+
     if(direction == -1)
     {
         // real-to-complex
@@ -2228,7 +2624,7 @@ void TreeNode::assign_buffers_CS_BLUESTEIN(OperatingBuffer& flipIn,
                                            OperatingBuffer& flipOut,
                                            OperatingBuffer& obOutBuf)
 {
-    assert(childNodes.size() == 7);
+    assert(childNodes.size() == 5);
 
     OperatingBuffer savFlipIn  = flipIn;
     OperatingBuffer savFlipOut = flipOut;
@@ -2238,44 +2634,86 @@ void TreeNode::assign_buffers_CS_BLUESTEIN(OperatingBuffer& flipIn,
     flipOut  = OB_TEMP;
     obOutBuf = OB_TEMP_BLUESTEIN;
 
-    assert(childNodes[0]->scheme == CS_KERNEL_CHIRP);
-    childNodes[0]->obIn  = OB_TEMP_BLUESTEIN;
-    childNodes[0]->obOut = OB_TEMP_BLUESTEIN;
-
-    assert(childNodes[1]->scheme == CS_KERNEL_PAD_MUL);
+    assert(childNodes[0]->scheme == CS_KERNEL_PAD_MUL);
     if(parent == nullptr)
     {
-        childNodes[1]->obIn = (placement == rocfft_placement_inplace) ? OB_USER_OUT : OB_USER_IN;
+        childNodes[0]->obIn = (placement == rocfft_placement_inplace) ? OB_USER_OUT : OB_USER_IN;
     }
     else
     {
-        childNodes[1]->obIn = obIn;
+        childNodes[0]->obIn = obIn;
     }
 
+    childNodes[0]->obOut = OB_TEMP_BLUESTEIN;
+
+    childNodes[1]->obIn  = OB_TEMP_BLUESTEIN;
     childNodes[1]->obOut = OB_TEMP_BLUESTEIN;
+    childNodes[1]->TraverseTreeAssignBuffersLogicA(flipIn, flipOut, obOutBuf);
 
+    assert(childNodes[2]->scheme == CS_KERNEL_FFT_MUL);
     childNodes[2]->obIn  = OB_TEMP_BLUESTEIN;
     childNodes[2]->obOut = OB_TEMP_BLUESTEIN;
-    childNodes[2]->TraverseTreeAssignBuffersLogicA(flipIn, flipOut, obOutBuf);
 
     childNodes[3]->obIn  = OB_TEMP_BLUESTEIN;
     childNodes[3]->obOut = OB_TEMP_BLUESTEIN;
     childNodes[3]->TraverseTreeAssignBuffersLogicA(flipIn, flipOut, obOutBuf);
 
-    assert(childNodes[4]->scheme == CS_KERNEL_FFT_MUL);
+    assert(childNodes[4]->scheme == CS_KERNEL_RES_MUL);
     childNodes[4]->obIn  = OB_TEMP_BLUESTEIN;
-    childNodes[4]->obOut = OB_TEMP_BLUESTEIN;
+    childNodes[4]->obOut = (parent == nullptr) ? OB_USER_OUT : obOut;
+
+    obIn  = childNodes[0]->obIn;
+    obOut = childNodes[4]->obOut;
+
+    flipIn   = savFlipIn;
+    flipOut  = savFlipOut;
+    obOutBuf = savOutBuf;
+}
+
+void TreeNode::assign_buffers_CS_RADER(OperatingBuffer& flipIn,
+                                       OperatingBuffer& flipOut,
+                                       OperatingBuffer& obOutBuf)
+{
+    assert(childNodes.size() == 5);
+
+    OperatingBuffer savFlipIn  = flipIn;
+    OperatingBuffer savFlipOut = flipOut;
+    OperatingBuffer savOutBuf  = obOutBuf;
+
+    flipIn   = OB_TEMP_BLUESTEIN;
+    flipOut  = OB_TEMP;
+    obOutBuf = OB_TEMP_BLUESTEIN;
+
+    assert(childNodes[0]->scheme == CS_KERNEL_RADER_PERMUTE);
+    if(parent == nullptr)
+    {
+        childNodes[0]->obIn = (placement == rocfft_placement_inplace) ? OB_USER_OUT : OB_USER_IN;
+    }
+    else
+    {
+        childNodes[0]->obIn = obIn;
+    }
+
+    childNodes[0]->obOut = OB_TEMP_BLUESTEIN;
+
+    childNodes[1]->obIn  = OB_TEMP_BLUESTEIN;
+    childNodes[1]->obOut = OB_TEMP_BLUESTEIN;
+    childNodes[1]->TraverseTreeAssignBuffersLogicA(flipIn, flipOut, obOutBuf);
+
+    assert(childNodes[2]->scheme == CS_KERNEL_RADER_MUL);
+    childNodes[2]->obIn  = OB_TEMP_BLUESTEIN;
+    childNodes[2]->obOut = OB_TEMP_BLUESTEIN;
 
-    childNodes[5]->obIn  = OB_TEMP_BLUESTEIN;
-    childNodes[5]->obOut = OB_TEMP_BLUESTEIN;
-    childNodes[5]->TraverseTreeAssignBuffersLogicA(flipIn, flipOut, obOutBuf);
+    childNodes[3]->obIn  = OB_TEMP_BLUESTEIN;
+    childNodes[3]->obOut = OB_TEMP_BLUESTEIN;
+    childNodes[3]->TraverseTreeAssignBuffersLogicA(flipIn, flipOut, obOutBuf);
 
-    assert(childNodes[6]->scheme == CS_KERNEL_RES_MUL);
-    childNodes[6]->obIn  = OB_TEMP_BLUESTEIN;
-    childNodes[6]->obOut = (parent == nullptr) ? OB_USER_OUT : obOut;
+    assert(childNodes[4]->scheme == CS_KERNEL_RADER_UNPERMUTE);
+    childNodes[4]->obIn  = OB_TEMP_BLUESTEIN;
+    childNodes[4]->obOut = (parent == nullptr) ? OB_USER_OUT : obOut;
 
-    obIn  = childNodes[1]->obIn;
-    obOut = childNodes[6]->obOut;
+    obIn  = childNodes[0]->obIn;
+    obOut = childNodes[4]->obOut;
 
     flipIn   = savFlipIn;
     flipOut  = savFlipOut;
@@ -2293,7 +2731,20 @@ void TreeNode::assign_buffers_CS_L1D_TRTRT(OperatingBuffer& flipIn,
 
     std::swap(flipIn, flipOut);
 
-    if(childNodes[1]->childNodes.size())
+    if((childNodes[1]->scheme == CS_BLUESTEIN) || (childNodes[1]->scheme == CS_RADER))
+    {
+        // the row transform of a length with a large prime factor works in
+        // its own temp buffer, so it reads and writes like a leaf
+        childNodes[1]->obIn  = flipIn;
+        childNodes[1]->obOut = obOutBuf;
+        childNodes[1]->TraverseTreeAssignBuffersLogicA(flipIn, flipOut, obOutBuf);
+
+        if(flipIn != obOutBuf)
+        {
+            std::swap(flipIn, flipOut);
+        }
+    }
+    else if(childNodes[1]->childNodes.size())
     {
         childNodes[1]->TraverseTreeAssignBuffersLogicA(flipIn, flipOut, obOutBuf);
 
@@ -2438,6 +2889,23 @@ void TreeNode::assign_buffers_CS_L1D_CRT(OperatingBuffer& flipIn,
                                          OperatingBuffer& flipOut,
                                          OperatingBuffer& obOutBuf)
 {
+    if(childNodes[2]->scheme == CS_KERNEL_TRANSPOSE_INPLACE)
+    {
+        // Logic B: every step works in place in the output buffer.
+        if(parent == nullptr)
+        {
+            obIn  = obOutBuf;
+            obOut = obOutBuf;
+        }
+        assert(obIn == obOut);
+        for(auto child : childNodes)
+        {
+            child->obIn  = obOut;
+            child->obOut = obOut;
+        }
+        return;
+    }
+
     if((obIn == OB_UNINIT) && (obOut == OB_UNINIT))
     {
         if(parent == nullptr)
@@ -2493,6 +2961,20 @@ void TreeNode::assign_buffers_CS_RTRT(OperatingBuffer& flipIn,
     auto flipIn0  = flipIn;
     auto flipOut0 = flipOut;
 
+    if(childNodes[1]->scheme == CS_KERNEL_TRANSPOSE_INPLACE)
+    {
+        // Logic B: every step works in place in the output buffer.
+        assert(obIn == obOut);
+        for(auto child : childNodes)
+        {
+            child->obIn  = obOut;
+            child->obOut = obOut;
+        }
+        childNodes[0]->TraverseTreeAssignBuffersLogicA(flipIn, flipOut, obOutBuf);
+        childNodes[2]->TraverseTreeAssignBuffersLogicA(flipIn0, flipOut0, obOutBuf);
+        return;
+    }
+
     // Transform:
     childNodes[0]->obIn  = obIn;
     childNodes[0]->obOut = flipIn;
@@ -2521,21 +3003,20 @@ void TreeNode::assign_buffers_CS_RC(OperatingBuffer& flipIn,
                                     OperatingBuffer& obOutBuf)
 {
     if(parent == nullptr)
-        childNodes[0]->obIn = (placement == rocfft_placement_inplace) ? obOutBuf : OB_USER_IN;
-    else
-        childNodes[0]->obIn = obOutBuf;
-
-    childNodes[0]->obOut = obOutBuf;
+    {
+        obIn  = (placement == rocfft_placement_inplace) ? obOutBuf : OB_USER_IN;
+        obOut = obOutBuf;
+    }
 
-    flipIn  = obOutBuf;
-    flipOut = OB_TEMP;
+    // Row transforms into the output buffer, where the block column kernel
+    // finishes the transform in place.  A nested RC node (the 2D part of a
+    // 3D one) reads and writes the buffers its parent gave it.
+    childNodes[0]->obIn  = obIn;
+    childNodes[0]->obOut = obOut;
     childNodes[0]->TraverseTreeAssignBuffersLogicA(flipIn, flipOut, obOutBuf);
 
-    childNodes[1]->obIn  = obOutBuf;
-    childNodes[1]->obOut = obOutBuf;
-
-    obIn  = childNodes[0]->obIn;
-    obOut = childNodes[1]->obOut;
+    childNodes[1]->obIn  = obOut;
+    childNodes[1]->obOut = obOut;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2669,6 +3150,7 @@ void TreeNode::TraverseTreeAssignParamsLogicA()
     switch(scheme)
     {
     case CS_REAL_TRANSFORM_USING_CMPLX:
+    case CS_REAL_TRANSFORM_PAIR:
         assign_params_CS_REAL_TRANSFORM_USING_CMPLX();
         break;
     case CS_REAL_TRANSFORM_EVEN:
@@ -2683,7 +3165,11 @@ void TreeNode::TraverseTreeAssignParamsLogicA()
     case CS_BLUESTEIN:
         assign_params_CS_BLUESTEIN();
         break;
+    case CS_RADER:
+        assign_params_CS_RADER();
+        break;
     case CS_L1D_TRTRT:
+    case CS_L1D_PFA:
         assign_params_CS_L1D_TRTRT();
         break;
     case CS_L1D_CC:
@@ -2745,7 +3231,43 @@ void TreeNode::assign_params_CS_REAL_TRANSFORM_USING_CMPLX()
 
 void TreeNode::assign_params_CS_REAL_TRANSFORM_EVEN()
 {
-    assert(childNodes.size() == 2);
+    assert(childNodes.size() == 2 || childNodes.size() == 3);
+
+    if(childNodes.size() == 3)
+    {
+        // strided real data, packed into a contiguous complex buffer
+
+        TreeNode* headPlan = childNodes[0];
+        TreeNode* fftPlan  = childNodes[1];
+        TreeNode* tailPlan = childNodes[2];
+        assert((direction == -1 && headPlan->scheme == CS_KERNEL_PACK_R_TO_CMPLX)
+               || (direction == 1 && headPlan->scheme == CS_KERNEL_CMPLX_TO_R));
+        assert((direction == -1 && tailPlan->scheme == CS_KERNEL_R_TO_CMPLX)
+               || (direction == 1 && tailPlan->scheme == CS_KERNEL_UNPACK_CMPLX_TO_R));
+
+        headPlan->inStride = inStride;
+        headPlan->iDist    = iDist;
+
+        headPlan->outStride.push_back(1);
+        headPlan->oDist = headPlan->length[0];
+        for(size_t index = 1; index < length.size(); index++)
+        {
+            headPlan->outStride.push_back(headPlan->oDist);
+            headPlan->oDist *= length[index];
+        }
+
+        fftPlan->inStride  = headPlan->outStride;
+        fftPlan->iDist     = headPlan->oDist;
+        fftPlan->outStride = fftPlan->inStride;
+        fftPlan->oDist     = fftPlan->iDist;
+        fftPlan->TraverseTreeAssignParamsLogicA();
+
+        tailPlan->inStride  = fftPlan->outStride;
+        tailPlan->iDist     = fftPlan->oDist;
+        tailPlan->outStride = outStride;
+        tailPlan->oDist     = oDist;
+        return;
+    }
 
     if(direction == -1)
     {
@@ -2886,7 +3408,7 @@ void TreeNode::assign_params_CS_L1D_CC()
         for(size_t index = 1; index < length.size(); index++)
             col2colPlan->inStride.push_back(inStride[index]);
 
-        if(parent->scheme == CS_L1D_TRTRT)
+        if(parent->scheme == CS_L1D_TRTRT || parent->scheme == CS_L1D_PFA)
         {
             col2colPlan->outStride.push_back(parent->outStride[0] * col2colPlan->length[1]);
             col2colPlan->outStride.push_back(parent->outStride[0]);
@@ -2915,7 +3437,7 @@ void TreeNode::assign_params_CS_L1D_CC()
         }
 
         // B -> T
-        if(parent->scheme == CS_L1D_TRTRT)
+        if(parent->scheme == CS_L1D_TRTRT || parent->scheme == CS_L1D_PFA)
         {
             row2colPlan->inStride.push_back(parent->outStride[0]);
             row2colPlan->inStride.push_back(parent->outStride[0] * row2colPlan->length[0]);
@@ -2956,6 +3478,41 @@ void TreeNode::assign_params_CS_L1D_CRT()
     TreeNode* row2rowPlan = childNodes[1];
     TreeNode* transPlan   = childNodes[2];
 
+    if(transPlan->scheme == CS_KERNEL_TRANSPOSE_INPLACE)
+    {
+        // Logic B: the data is contiguous and stays in place; the transpose
+        // turns the rows of the row kernel into the output order.
+        assert(inStride[0] == 1 && outStride[0] == 1);
+
+        col2colPlan->inStride.push_back(col2colPlan->length[1]);
+        col2colPlan->inStride.push_back(1);
+
+        row2rowPlan->inStride.push_back(1);
+        row2rowPlan->inStride.push_back(row2rowPlan->length[0]);
+
+        transPlan->inStride.push_back(1);
+        transPlan->inStride.push_back(transPlan->length[0]);
+        transPlan->outStride.push_back(1);
+        transPlan->outStride.push_back(transPlan->length[1]);
+
+        for(size_t index = 1; index < length.size(); index++)
+        {
+            col2colPlan->inStride.push_back(inStride[index]);
+            row2rowPlan->inStride.push_back(inStride[index]);
+            transPlan->inStride.push_back(inStride[index]);
+            transPlan->outStride.push_back(outStride[index]);
+        }
+
+        col2colPlan->outStride = col2colPlan->inStride;
+        row2rowPlan->outStride = row2rowPlan->inStride;
+        for(auto child : childNodes)
+        {
+            child->iDist = iDist;
+            child->oDist = oDist;
+        }
+        return;
+    }
+
     if(parent != NULL)
         assert(obIn == obOut);
 
@@ -3012,7 +3569,7 @@ void TreeNode::assign_params_CS_L1D_CRT()
         for(size_t index = 1; index < length.size(); index++)
             col2colPlan->inStride.push_back(inStride[index]);
 
-        if(parent->scheme == CS_L1D_TRTRT)
+        if(parent->scheme == CS_L1D_TRTRT || parent->scheme == CS_L1D_PFA)
         {
             col2colPlan->outStride.push_back(parent->outStride[0] * col2colPlan->length[1]);
             col2colPlan->outStride.push_back(parent->outStride[0]);
@@ -3044,7 +3601,7 @@ void TreeNode::assign_params_CS_L1D_CRT()
         }
 
         // B -> B
-        if(parent->scheme == CS_L1D_TRTRT)
+        if(parent->scheme == CS_L1D_TRTRT || parent->scheme == CS_L1D_PFA)
         {
             row2rowPlan->inStride.push_back(parent->outStride[0]);
             row2rowPlan->inStride.push_back(parent->outStride[0] * row2rowPlan->length[0]);
@@ -3088,18 +3645,11 @@ void TreeNode::assign_params_CS_L1D_CRT()
 
 void TreeNode::assign_params_CS_BLUESTEIN()
 {
-    TreeNode* chirpPlan  = childNodes[0];
-    TreeNode* padmulPlan = childNodes[1];
-    TreeNode* fftiPlan   = childNodes[2];
-    TreeNode* fftcPlan   = childNodes[3];
-    TreeNode* fftmulPlan = childNodes[4];
-    TreeNode* fftrPlan   = childNodes[5];
-    TreeNode* resmulPlan = childNodes[6];
-
-    chirpPlan->inStride.push_back(1);
-    chirpPlan->iDist = chirpPlan->lengthBlue;
-    chirpPlan->outStride.push_back(1);
-    chirpPlan->oDist = chirpPlan->lengthBlue;
+    TreeNode* padmulPlan = childNodes[0];
+    TreeNode* fftiPlan   = childNodes[1];
+    TreeNode* fftmulPlan = childNodes[2];
+    TreeNode* fftrPlan   = childNodes[3];
+    TreeNode* resmulPlan = childNodes[4];
 
     padmulPlan->inStride = inStride;
     padmulPlan->iDist    = iDist;
@@ -3119,13 +3669,6 @@ void TreeNode::assign_params_CS_BLUESTEIN()
 
     fftiPlan->TraverseTreeAssignParamsLogicA();
 
-    fftcPlan->inStride  = chirpPlan->outStride;
-    fftcPlan->iDist     = chirpPlan->oDist;
-    fftcPlan->outStride = fftcPlan->inStride;
-    fftcPlan->oDist     = fftcPlan->iDist;
-
-    fftcPlan->TraverseTreeAssignParamsLogicA();
-
     fftmulPlan->inStride  = fftiPlan->outStride;
     fftmulPlan->iDist     = fftiPlan->oDist;
     fftmulPlan->outStride = fftmulPlan->inStride;
@@ -3144,6 +3687,52 @@ void TreeNode::assign_params_CS_BLUESTEIN()
     resmulPlan->oDist     = oDist;
 }
 
+void TreeNode::assign_params_CS_RADER()
+{
+    TreeNode* permutePlan   = childNodes[0];
+    TreeNode* fftiPlan      = childNodes[1];
+    TreeNode* mulPlan       = childNodes[2];
+    TreeNode* fftrPlan      = childNodes[3];
+    TreeNode* unpermutePlan = childNodes[4];
+
+    // the convolution takes the first N-1 elements of each length N row of
+    // the temp buffer; the last one holds the zero frequency input and output
+    permutePlan->inStride = inStride;
+    permutePlan->iDist    = iDist;
+
+    permutePlan->outStride.push_back(1);
+    permutePlan->oDist = length[0];
+    for(size_t index = 1; index < length.size(); index++)
+    {
+        permutePlan->outStride.push_back(permutePlan->oDist);
+        permutePlan->oDist *= length[index];
+    }
+
+    fftiPlan->inStride  = permutePlan->outStride;
+    fftiPlan->iDist     = permutePlan->oDist;
+    fftiPlan->outStride = fftiPlan->inStride;
+    fftiPlan->oDist     = fftiPlan->iDist;
+
+    fftiPlan->TraverseTreeAssignParamsLogicA();
+
+    mulPlan->inStride  = fftiPlan->outStride;
+    mulPlan->iDist     = fftiPlan->oDist;
+    mulPlan->outStride = mulPlan->inStride;
+    mulPlan->oDist     = mulPlan->iDist;
+
+    fftrPlan->inStride  = mulPlan->outStride;
+    fftrPlan->iDist     = mulPlan->oDist;
+    fftrPlan->outStride = fftrPlan->inStride;
+    fftrPlan->oDist     = fftrPlan->iDist;
+
+    fftrPlan->TraverseTreeAssignParamsLogicA();
+
+    unpermutePlan->inStride  = fftrPlan->outStride;
+    unpermutePlan->iDist     = fftrPlan->oDist;
+    unpermutePlan->outStride = outStride;
+    unpermutePlan->oDist     = oDist;
+}
+
 void TreeNode::assign_params_CS_L1D_TRTRT()
 {
     const size_t biggerDim  = std::max(childNodes[0]->length[0], childNodes[0]->length[1]);
@@ -3179,7 +3768,7 @@ void TreeNode::assign_params_CS_L1D_TRTRT()
     {
         trans1Plan->transTileDir = TTD_IP_VER;
 
-        if(parent->scheme == CS_L1D_TRTRT)
+        if(parent->scheme == CS_L1D_TRTRT || parent->scheme == CS_L1D_PFA)
         {
             trans1Plan->outStride.push_back(outStride[0]);
             trans1Plan->outStride.push_back(outStride[0] * (trans1Plan->length[1]));
@@ -3255,7 +3844,9 @@ void TreeNode::assign_params_CS_L1D_TRTRT()
     {
         trans2Plan->transTileDir = TTD_IP_VER;
 
-        if((parent == NULL) || (parent && (parent->scheme == CS_L1D_TRTRT)))
+        if((parent == NULL)
+           || (parent
+               && (parent->scheme == CS_L1D_TRTRT || parent->scheme == CS_L1D_PFA)))
         {
             trans2Plan->outStride.push_back(outStride[0]);
             trans2Plan->outStride.push_back(outStride[0] * (trans2Plan->length[1]));
@@ -3302,7 +3893,9 @@ void TreeNode::assign_params_CS_L1D_TRTRT()
     }
     else
     {
-        if((parent == NULL) || (parent && (parent->scheme == CS_L1D_TRTRT)))
+        if((parent == NULL)
+           || (parent
+               && (parent->scheme == CS_L1D_TRTRT || parent->scheme == CS_L1D_PFA)))
         {
             row2Plan->outStride.push_back(outStride[0]);
             row2Plan->outStride.push_back(outStride[0] * (row2Plan->length[0]));
@@ -3343,6 +3936,12 @@ void TreeNode::assign_params_CS_L1D_TRTRT()
 
 void TreeNode::assign_params_CS_2D_RTRT()
 {
+    if(childNodes[1]->scheme == CS_KERNEL_TRANSPOSE_INPLACE)
+    {
+        assign_params_CS_RTRT_INPLACE();
+        return;
+    }
+
     const size_t biggerDim  = std::max(length[0], length[1]);
     const size_t smallerDim = std::min(length[0], length[1]);
     const size_t padding
@@ -3627,10 +4226,10 @@ void TreeNode::assign_params_CS_2D_RC_STRAIGHT()
     // B -> B
     assert((colPlan->obOut == OB_USER_OUT) || (colPlan->obOut == OB_TEMP_CMPLX_FOR_REAL)
            || (colPlan->obOut == OB_TEMP_BLUESTEIN));
-    colPlan->inStride.push_back(inStride[1]);
-    colPlan->inStride.push_back(inStride[0]);
+    colPlan->inStride.push_back(outStride[1]);
+    colPlan->inStride.push_back(outStride[0]);
     for(size_t index = 2; index < length.size(); index++)
-        colPlan->inStride.push_back(inStride[index]);
+        colPlan->inStride.push_back(outStride[index]);
 
     colPlan->iDist = rowPlan->oDist;
 
@@ -3642,6 +4241,12 @@ void TreeNode::assign_params_CS_3D_RTRT()
 {
     assert(childNodes.size() == 4);
 
+    if(childNodes[1]->scheme == CS_KERNEL_TRANSPOSE_INPLACE)
+    {
+        assign_params_CS_RTRT_INPLACE();
+        return;
+    }
+
     const size_t biggerDim  = std::max(length[0] * length[1], length[2]);
     const size_t smallerDim = std::min(length[0] * length[1], length[2]);
     const size_t padding
@@ -3698,6 +4303,45 @@ void TreeNode::assign_params_CS_3D_RTRT()
     trans2Plan->oDist     = oDist;
 }
 
+void TreeNode::assign_params_CS_RTRT_INPLACE()
+{
+    // The data is contiguous, and each step sees it contiguous in the order
+    // of its own lengths.  A transpose writes its matrices contiguous in the
+    // order of the next step.
+    auto contiguous = [](const std::vector<size_t>& len) {
+        std::vector<size_t> stride;
+        size_t              dist = 1;
+        for(auto l : len)
+        {
+            stride.push_back(dist);
+            dist *= l;
+        }
+        return stride;
+    };
+
+    assert(std::vector<size_t>(inStride) == contiguous(length));
+    assert(std::vector<size_t>(outStride) == contiguous(length));
+
+    for(auto child : childNodes)
+    {
+        child->inStride = contiguous(child->length);
+        child->iDist    = iDist;
+        if(child->scheme == CS_KERNEL_TRANSPOSE_INPLACE)
+        {
+            auto outLength = child->length;
+            std::swap(outLength[0], outLength[1]);
+            child->outStride = contiguous(outLength);
+        }
+        else
+        {
+            child->outStride = child->inStride;
+        }
+        child->oDist = oDist;
+
+        child->TraverseTreeAssignParamsLogicA();
+    }
+}
+
 void TreeNode::assign_params_CS_3D_RC_STRAIGHT()
 {
     TreeNode* xyPlan = childNodes[0];
@@ -3717,11 +4361,11 @@ void TreeNode::assign_params_CS_3D_RC_STRAIGHT()
     // B -> B
     assert((zPlan->obOut == OB_USER_OUT) || (zPlan->obOut == OB_TEMP_CMPLX_FOR_REAL)
            || (zPlan->obOut == OB_TEMP_BLUESTEIN));
-    zPlan->inStride.push_back(inStride[2]);
-    zPlan->inStride.push_back(inStride[0]);
-    zPlan->inStride.push_back(inStride[1]);
+    zPlan->inStride.push_back(outStride[2]);
+    zPlan->inStride.push_back(outStride[0]);
+    zPlan->inStride.push_back(outStride[1]);
     for(size_t index = 3; index < length.size(); index++)
-        zPlan->inStride.push_back(inStride[index]);
+        zPlan->inStride.push_back(outStride[index]);
 
     zPlan->iDist = xyPlan->oDist;
 
@@ -3732,30 +4376,40 @@ void TreeNode::assign_params_CS_3D_RC_STRAIGHT()
 ///////////////////////////////////////////////////////////////////////////////
 /// Colletct leaf node and calculate work memory requirements
 
+// Grow the work buffer sizes to hold what a leaf node writes.
+static void LeafWorkBufferSizes(const TreeNode* leaf,
+                                size_t&         tmpBufSize,
+                                size_t&         cmplxForRealSize,
+                                size_t&         blueSize)
+{
+    if(leaf->obOut == OB_TEMP_BLUESTEIN)
+    {
+        blueSize = std::max(leaf->oDist * leaf->batch, blueSize);
+    }
+    if(leaf->obOut == OB_TEMP_CMPLX_FOR_REAL)
+    {
+        // the head of a paired real transform writes one complex
+        // transform per pair of batch members
+        const size_t count = (leaf->scheme == CS_KERNEL_PAIR_R_TO_CMPLX
+                              || leaf->scheme == CS_KERNEL_PAIR_HERM_TO_CMPLX)
+                                 ? (leaf->batch + 1) / 2
+                                 : leaf->batch;
+        cmplxForRealSize = std::max(leaf->oDist * count, cmplxForRealSize);
+    }
+    if(leaf->obOut == OB_TEMP)
+    {
+        tmpBufSize = std::max(leaf->oDist * leaf->batch, tmpBufSize);
+    }
+}
+
 void TreeNode::TraverseTreeCollectLeafsLogicA(std::vector<TreeNode*>& seq,
                                               size_t&                 tmpBufSize,
                                               size_t&                 cmplxForRealSize,
-                                              size_t&                 blueSize,
-                                              size_t&                 chirpSize)
+                                              size_t&                 blueSize)
 {
     if(childNodes.size() == 0)
     {
-        if(scheme == CS_KERNEL_CHIRP)
-        {
-            chirpSize = std::max(2 * lengthBlue, chirpSize);
-        }
-        if(obOut == OB_TEMP_BLUESTEIN)
-        {
-            blueSize = std::max(oDist * batch, blueSize);
-        }
-        if(obOut == OB_TEMP_CMPLX_FOR_REAL)
-        {
-            cmplxForRealSize = std::max(oDist * batch, cmplxForRealSize);
-        }
-        if(obOut == OB_TEMP)
-        {
-            tmpBufSize = std::max(oDist * batch, tmpBufSize);
-        }
+        LeafWorkBufferSizes(this, tmpBufSize, cmplxForRealSize, blueSize);
         seq.push_back(this);
     }
     else
@@ -3763,8 +4417,7 @@ void TreeNode::TraverseTreeCollectLeafsLogicA(std::vector<TreeNode*>& seq,
         for(auto children_p = childNodes.begin(); children_p != childNodes.end(); children_p++)
         {
             (*children_p)
-                ->TraverseTreeCollectLeafsLogicA(
-                    seq, tmpBufSize, cmplxForRealSize, blueSize, chirpSize);
+                ->TraverseTreeCollectLeafsLogicA(seq, tmpBufSize, cmplxForRealSize, blueSize);
         }
     }
 }
@@ -3809,6 +4462,9 @@ void TreeNode::Print(std::ostream& os, const int indent) const
     os << std::endl << indentStr.c_str();
     os << "direction: " << direction;
 
+    os << std::endl << indentStr.c_str();
+    os << "scale: " << scale;
+
     os << std::endl << indentStr.c_str();
     os << ((placement == rocfft_placement_inplace) ? "inplace" : "not inplace");
 
@@ -3859,7 +4515,14 @@ void TreeNode::Print(std::ostream& os, const int indent) const
     }
     os << std::endl << indentStr.c_str() << "TTD: " << transTileDir;
     os << std::endl << indentStr.c_str() << "large1D: " << large1D;
-    os << std::endl << indentStr.c_str() << "lengthBlue: " << lengthBlue << std::endl;
+    os << std::endl << indentStr.c_str() << "lengthBlue: " << lengthBlue;
+    os << std::endl << indentStr.c_str() << "raderRoot: " << raderRoot;
+    os << std::endl
+       << indentStr.c_str() << "pfaIn: " << pfaIn[0] << " " << pfaIn[1] << ", pfaOut: " << pfaOut[0]
+       << " " << pfaOut[1];
+    os << std::endl
+       << indentStr.c_str() << "inOffset: " << inOffset[0] << " " << inOffset[1]
+       << ", outOffset: " << outOffset[0] << " " << outOffset[1] << std::endl;
 
     os << indentStr << PrintOperatingBuffer(obIn) << " -> " << PrintOperatingBuffer(obOut)
        << std::endl;
@@ -3868,19 +4531,279 @@ void TreeNode::Print(std::ostream& os, const int indent) const
 
     if(childNodes.size())
     {
-        std::vector<TreeNode*>::const_iterator children_p;
-        for(children_p = childNodes.begin(); children_p != childNodes.end(); children_p++)
+        for(auto children_p = childNodes.begin(); children_p != childNodes.end(); children_p++)
         {
             (*children_p)->Print(os, indent + 1);
         }
     }
 }
 
+void CreateExecPlan(const rocfft_plan_t& plan, ExecPlan& execPlan, PlanDecisions* decisions)
+{
+    TreeNode* rootPlan = TreeNode::CreateNode();
+
+    rootPlan->dimension = plan.rank;
+    rootPlan->batch     = plan.batch;
+    for(size_t i = 0; i < plan.rank; i++)
+    {
+        rootPlan->length.push_back(plan.lengths[i]);
+
+        rootPlan->inStride.push_back(plan.desc.inStrides[i]);
+        rootPlan->outStride.push_back(plan.desc.outStrides[i]);
+    }
+    rootPlan->iDist = plan.desc.inDist;
+    rootPlan->oDist = plan.desc.outDist;
+
+    rootPlan->placement = plan.placement;
+    rootPlan->precision = plan.precision;
+    rootPlan->backend   = plan.desc.backend;
+    if((plan.transformType == rocfft_transform_type_complex_forward)
+       || (plan.transformType == rocfft_transform_type_real_forward))
+        rootPlan->direction = -1;
+    else
+        rootPlan->direction = 1;
+
+    rootPlan->inArrayType  = plan.desc.inArrayType;
+    rootPlan->outArrayType = plan.desc.outArrayType;
+
+    rootPlan->scale = plan.desc.scale;
+
+    for(size_t i = 0; i < 2; i++)
+    {
+        rootPlan->inOffset[i]  = plan.desc.inOffset[i];
+        rootPlan->outOffset[i] = plan.desc.outOffset[i];
+    }
+
+    rootPlan->decisions = decisions;
+
+    execPlan.rootPlan = rootPlan;
+    ProcessNode(execPlan); // TODO: more descriptions are needed
+
+    rootPlan->decisions = nullptr;
+}
+
+// Place the temporary buffer regions in the work buffer.  A region is live
+// from the first to the last kernel of execSeq that reads or writes it;
+// regions whose live ranges are disjoint share memory.  Larger regions are
+// placed first, each at the lowest offset not used by a region live at the
+// same time.
+static void AssignWorkBufferOffsets(ExecPlan& execPlan)
+{
+    struct Region
+    {
+        OperatingBuffer buf;
+        size_t          size;
+        size_t          first;
+        size_t          last;
+        size_t*         offset;
+    };
+    std::vector<Region> regions
+        = {{OB_TEMP, execPlan.tmpWorkBufSize, 0, 0, &execPlan.tmpWorkBufOffset},
+           {OB_TEMP_CMPLX_FOR_REAL, execPlan.copyWorkBufSize, 0, 0, &execPlan.copyWorkBufOffset},
+           {OB_TEMP_BLUESTEIN, execPlan.blueWorkBufSize, 0, 0, &execPlan.blueWorkBufOffset}};
+
+    for(auto& r : regions)
+    {
+        r.first = execPlan.execSeq.size();
+        for(size_t i = 0; i < execPlan.execSeq.size(); ++i)
+        {
+            const TreeNode* node = execPlan.execSeq[i];
+            if(node->obIn == r.buf || node->obOut == r.buf)
+            {
+                r.first = std::min(r.first, i);
+                r.last  = i;
+            }
+        }
+    }
+
+    std::stable_sort(regions.begin(), regions.end(), [](const Region& a, const Region& b) {
+        return a.size > b.size;
+    });
+
+    execPlan.workBufSize = 0;
+    for(size_t i = 0; i < regions.size(); ++i)
+    {
+        Region& r = regions[i];
+        *r.offset = 0;
+        if(r.size == 0)
+            continue;
+
+        for(bool moved = true; moved;)
+        {
+            moved = false;
+            for(size_t j = 0; j < i; ++j)
+            {
+                const Region& p = regions[j];
+                if(p.size == 0 || p.last < r.first || r.last < p.first)
+                    continue;
+                if(*r.offset < *p.offset + p.size && *p.offset < *r.offset + r.size)
+                {
+                    *r.offset = *p.offset + p.size;
+                    moved     = true;
+                }
+            }
+        }
+        execPlan.workBufSize = std::max(execPlan.workBufSize, *r.offset + r.size);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// Rewrites of the execution sequence
+
+// Whether the contents of buffer ob after execSeq[pos] are never read again.
+static bool DeadAfter(const ExecPlan& execPlan, const size_t pos, const OperatingBuffer ob)
+{
+    for(size_t i = pos + 1; i < execPlan.execSeq.size(); i++)
+    {
+        if(execPlan.execSeq[i]->obIn == ob)
+            return false;
+        if(execPlan.execSeq[i]->obOut == ob)
+            return true;
+    }
+    return ob != OB_USER_OUT;
+}
+
+// A length 1 FFT that works in place is the identity.
+static bool RewriteUnitLengthFFT(ExecPlan& execPlan, const size_t pos)
+{
+    const TreeNode* node = execPlan.execSeq[pos];
+    if(node->scheme != CS_KERNEL_STOCKHAM || node->length[0] != 1 || node->large1D != 0)
+        return false;
+    if(node->obIn != node->obOut || node->inArrayType != node->outArrayType
+       || std::vector<size_t>(node->inStride) != std::vector<size_t>(node->outStride)
+       || node->iDist != node->oDist)
+        return false;
+
+    execPlan.execSeq.erase(execPlan.execSeq.begin() + pos);
+    return true;
+}
+
+// So is an in-place transpose of a single row or column.
+static bool RewriteUnitTranspose(ExecPlan& execPlan, const size_t pos)
+{
+    const TreeNode* node = execPlan.execSeq[pos];
+    if(node->scheme != CS_KERNEL_TRANSPOSE_INPLACE
+       || (node->length[0] != 1 && node->length[1] != 1))
+        return false;
+
+    execPlan.execSeq.erase(execPlan.execSeq.begin() + pos);
+    return true;
+}
+
+// A transpose followed by its inverse, back into the same buffer with the
+// same layout, moves nothing.
+static bool RewriteInverseTransposes(ExecPlan& execPlan, const size_t pos)
+{
+    if(pos + 1 >= execPlan.execSeq.size())
+        return false;
+
+    const TreeNode* t1 = execPlan.execSeq[pos];
+    const TreeNode* t2 = execPlan.execSeq[pos + 1];
+
+    // t2 must put the dimensions that t1 transposed back in their order
+    std::vector<size_t> length = t2->length;
+    if(t1->scheme == CS_KERNEL_TRANSPOSE && t2->scheme == CS_KERNEL_TRANSPOSE)
+        std::swap(length[0], length[1]);
+    else if(t1->scheme == CS_KERNEL_TRANSPOSE_XY_Z && t2->scheme == CS_KERNEL_TRANSPOSE_Z_XY)
+        std::rotate(length.begin(), length.begin() + 1, length.begin() + 3);
+    else if(t1->scheme == CS_KERNEL_TRANSPOSE_Z_XY && t2->scheme == CS_KERNEL_TRANSPOSE_XY_Z)
+        std::rotate(length.begin(), length.begin() + 2, length.begin() + 3);
+    else
+        return false;
+    if(length != std::vector<size_t>(t1->length) || t1->batch != t2->batch)
+        return false;
+
+    // plain transposes, without large 1D twiddles or Good-Thomas maps
+    for(auto t : {t1, t2})
+        if(t->large1D != 0 || t->pfaIn[0] != 0 || t->pfaOut[0] != 0)
+            return false;
+
+    if(t1->obOut != t2->obIn || t1->obIn != t2->obOut
+       || t1->inArrayType != t2->outArrayType
+       || std::vector<size_t>(t1->outStride) != std::vector<size_t>(t2->inStride)
+       || std::vector<size_t>(t1->inStride) != std::vector<size_t>(t2->outStride)
+       || t1->iDist != t2->oDist)
+        return false;
+
+    // the intermediate result must not be needed later
+    if(t1->obOut != t1->obIn && !DeadAfter(execPlan, pos + 1, t1->obOut))
+        return false;
+
+    execPlan.execSeq.erase(execPlan.execSeq.begin() + pos, execPlan.execSeq.begin() + pos + 2);
+    return true;
+}
+
+struct ExecSeqRewrite
+{
+    const char* name;
+    // Number of kernels the rule removes from execSeq
+    size_t removes;
+    // Rewrite execSeq at pos, returning whether the rule applied.
+    bool (*apply)(ExecPlan& execPlan, size_t pos);
+};
+
+static const ExecSeqRewrite execSeqRewrites[] = {
+    {"unit length FFT", 1, RewriteUnitLengthFFT},
+    {"unit in-place transpose", 1, RewriteUnitTranspose},
+    {"inverse transposes", 2, RewriteInverseTransposes},
+};
+
+// Apply the rewrites to execSeq until none of them fires.  Every kernel
+// removed saves a full read and write of the data.
+static void RewriteExecSeq(ExecPlan& execPlan)
+{
+    bool changed = true;
+    while(changed)
+    {
+        changed = false;
+        for(size_t pos = 0; pos < execPlan.execSeq.size() && !changed; pos++)
+        {
+            for(const auto& rule : execSeqRewrites)
+            {
+                // always leave one kernel to run
+                if(execPlan.execSeq.size() <= rule.removes)
+                    continue;
+                if(rule.apply(execPlan, pos))
+                {
+                    execPlan.rewrites.push_back(std::string(rule.name) + " at "
+                                                + std::to_string(pos));
+                    changed = true;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+// Whether a transform can be built with in-place transposes, which needs
+// in-place complex data that is contiguous in every dimension.
+static bool UseLogicB(const TreeNode* node)
+{
+    if(node->placement != rocfft_placement_inplace
+       || node->inArrayType != rocfft_array_type_complex_interleaved
+       || node->outArrayType != rocfft_array_type_complex_interleaved)
+        return false;
+    if(node->dimension > 3)
+        return false;
+
+    size_t dist = 1;
+    for(size_t i = 0; i < node->length.size(); i++)
+    {
+        if(node->inStride[i] != dist || node->outStride[i] != dist)
+            return false;
+        dist *= node->length[i];
+    }
+    return node->batch == 1 || (node->iDist == dist && node->oDist == dist);
+}
+
 void ProcessNode(ExecPlan& execPlan)
 {
     assert(execPlan.rootPlan->length.size() == execPlan.rootPlan->dimension);
 
-    execPlan.rootPlan->RecursiveBuildTree();
+    if(UseLogicB(execPlan.rootPlan))
+        execPlan.rootPlan->RecursiveBuildTreeLogicB();
+    else
+        execPlan.rootPlan->RecursiveBuildTree();
 
     assert(execPlan.rootPlan->length.size() == execPlan.rootPlan->inStride.size());
     assert(execPlan.rootPlan->length.size() == execPlan.rootPlan->outStride.size());
@@ -3895,15 +4818,28 @@ void ProcessNode(ExecPlan& execPlan)
     size_t tmpBufSize       = 0;
     size_t cmplxForRealSize = 0;
     size_t blueSize         = 0;
-    size_t chirpSize        = 0;
     execPlan.rootPlan->TraverseTreeCollectLeafsLogicA(
-        execPlan.execSeq, tmpBufSize, cmplxForRealSize, blueSize, chirpSize);
+        execPlan.execSeq, tmpBufSize, cmplxForRealSize, blueSize);
+
+    RewriteExecSeq(execPlan);
+    if(!execPlan.rewrites.empty())
+    {
+        // the removed kernels may have been the only users of a buffer
+        tmpBufSize       = 0;
+        cmplxForRealSize = 0;
+        blueSize         = 0;
+        for(auto leaf : execPlan.execSeq)
+            LeafWorkBufferSizes(leaf, tmpBufSize, cmplxForRealSize, blueSize);
+    }
+
+    // the last kernel multiplies the output by the scale as it stores it
+    assert(!execPlan.execSeq.empty());
+    execPlan.execSeq.back()->scale = execPlan.rootPlan->scale;
 
-    execPlan.workBufSize      = tmpBufSize + cmplxForRealSize + blueSize + chirpSize;
-    execPlan.tmpWorkBufSize   = tmpBufSize;
-    execPlan.copyWorkBufSize  = cmplxForRealSize;
-    execPlan.blueWorkBufSize  = blueSize;
-    execPlan.chirpWorkBufSize = chirpSize;
+    execPlan.tmpWorkBufSize  = tmpBufSize;
+    execPlan.copyWorkBufSize = cmplxForRealSize;
+    execPlan.blueWorkBufSize = blueSize;
+    AssignWorkBufferOffsets(execPlan);
 }
 
 void PrintNode(std::ostream& os, const ExecPlan& execPlan)
@@ -3917,7 +4853,11 @@ void PrintNode(std::ostream& os, const ExecPlan& execPlan)
                                      execPlan.rootPlan->batch,
                                      std::multiplies<size_t>());
     os << "Work buffer size: " << execPlan.workBufSize << std::endl;
+    os << "Work buffer offsets: temp " << execPlan.tmpWorkBufOffset << ", cmplx for real "
+       << execPlan.copyWorkBufOffset << ", bluestein " << execPlan.blueWorkBufOffset << std::endl;
     os << "Work buffer ratio: " << (double)execPlan.workBufSize / (double)N << std::endl;
+    for(const auto& r : execPlan.rewrites)
+        os << "Rewrite: " << r << std::endl;
 
     if(execPlan.execSeq.size() > 1)
     {
@@ -3942,12 +4882,9 @@ void PrintNode(std::ostream& os, const ExecPlan& execPlan)
                 }
             }
 
-            if((*prev_p)->scheme != CS_KERNEL_CHIRP && (*curr_p)->scheme != CS_KERNEL_CHIRP)
+            if((*prev_p)->obOut != (*curr_p)->obIn)
             {
-                if((*prev_p)->obOut != (*curr_p)->obIn)
-                {
-                    os << "error in buffer assignments" << std::endl;
-                }
+                os << "error in buffer assignments" << std::endl;
             }
 
             prev_p = curr_p;
@@ -0,0 +1,511 @@
+/******************************************************************************
+* Copyright (c) 2016 - present Advanced Micro Devices, Inc. All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*******************************************************************************/
+
+#include <algorithm>
+#include <assert.h>
+#include <map>
+
+#include "plan.h"
+#include "plan_cost.h"
+#include "radix_table.h"
+
+const PlanCostModel& GetPlanCostModel(rocfft_execution_backend backend)
+{
+    // On the device a launch costs about as much as moving a few MB and
+    // the radix passes run from LDS; on the host launches are a barrier of
+    // the thread pool, the passes are paid in arithmetic and transposes
+    // work on cache lines rather than 32x32 tiles.  The index mapped side
+    // of a Good-Thomas transpose touches scattered elements of each tile.
+    static const PlanCostModel deviceModel = {2.0, 1.0, 2.0e6, 1.25, 1.5, 32, 1.75};
+    static const PlanCostModel hostModel   = {16.0, 1.0, 1.0e5, 1.5, 1.5, 8, 1.75};
+
+    return (backend == rocfft_execution_backend_host) ? hostModel : deviceModel;
+}
+
+// Lengths of the CS_KERNEL_STOCKHAM_BLOCK_CC kernels; the 256-point kernel
+// is only used in single precision
+static bool BlockCCLength(const size_t len, const rocfft_precision precision)
+{
+    return (len == 64) || (len == 128) || ((len == 256) && (PrecisionWidth(precision) == 1));
+}
+
+// Lengths of the CS_KERNEL_STOCKHAM_BLOCK_RC kernels
+static bool BlockRCLength(const size_t len)
+{
+    return (len == 64) || (len == 128) || (len == 256);
+}
+
+// A block compute kernel of length len transforms columns bwd at a time,
+// so the other dimension has to be a multiple of bwd; lengths without a
+// block compute kernel never fit
+static bool BlockColumnsFit(const size_t len, const size_t columns)
+{
+    size_t bwd = 0, wgs = 0, lds = 0;
+    GetBlockComputeTable(len, bwd, wgs, lds);
+    return (bwd != 0) && ((columns % bwd) == 0);
+}
+
+static size_t Gcd(size_t a, size_t b)
+{
+    while(b != 0)
+    {
+        const size_t r = a % b;
+        a              = b;
+        b              = r;
+    }
+    return a;
+}
+
+class PlanCoster
+{
+public:
+    PlanCoster(const rocfft_precision precision, const PlanCostModel& model)
+        : precision(precision)
+        , model(model)
+        , elemBytes(2 * sizeof(float) * PrecisionWidth(precision))
+    {
+    }
+
+    // number of radix passes of the kernel of length len
+    size_t Passes(const size_t len)
+    {
+        auto& passes = numPasses[len];
+        if(passes == 0)
+            passes = GetRadices(len).size();
+        return passes;
+    }
+
+    // count single kernel transforms of length len
+    double Stockham(const size_t len, const size_t count)
+    {
+        const double elems = double(len) * count;
+        return model.launchCost
+               + elems * (Passes(len) * model.passCost + 2 * elemBytes * model.byteCost);
+    }
+
+    // block compute kernel over count columns of length len, optionally
+    // reading the large 1D twiddles
+    double Block(const size_t len, const size_t count, const bool twiddles)
+    {
+        const double elems = double(len) * count;
+        return model.launchCost
+               + elems * (Passes(len) * model.passCost
+                          + (2 * model.blockFactor + (twiddles ? 1 : 0)) * elemBytes
+                                * model.byteCost);
+    }
+
+    // count transposes of len0 x len1 matrices, which move whole tiles
+    double Transpose(const size_t len0, const size_t len1, const size_t count, const bool twiddles)
+    {
+        const size_t tile  = model.transposeTile;
+        const double elems = double(DivRoundingUp<size_t>(len0, tile) * tile)
+                             * (DivRoundingUp<size_t>(len1, tile) * tile) * count;
+        return model.launchCost
+               + elems * (2 * model.transposeFactor + (twiddles ? 1 : 0)) * elemBytes
+                     * model.byteCost;
+    }
+
+    // count Good-Thomas transposes of len0 x len1 matrices, which gather
+    // the input or scatter the output through the PFA index map
+    double PFATranspose(const size_t len0, const size_t len1, const size_t count)
+    {
+        const size_t tile  = model.transposeTile;
+        const double elems = double(DivRoundingUp<size_t>(len0, tile) * tile)
+                             * (DivRoundingUp<size_t>(len1, tile) * tile) * count;
+        return model.launchCost
+               + elems * (model.transposeFactor + model.gatherFactor) * elemBytes
+                     * model.byteCost;
+    }
+
+    // TRTRT of count transforms of length div0 * div1 without the large 1D
+    // twiddles, for coprime div0 and div1; rows is the cost of the div1
+    // point row transforms
+    void AddPFA(const size_t                  div0,
+                const size_t                  div1,
+                const size_t                  count,
+                const double                  rows,
+                std::vector<Plan1DCandidate>& out)
+    {
+        if(Gcd(div0, div1) != 1)
+            return;
+        const double cost = PFATranspose(div0, div1, count) + rows
+                            + Transpose(div1, div0, count, false)
+                            + Stockham(div0, count * div1) + PFATranspose(div0, div1, count);
+        out.push_back({CS_L1D_PFA, div0, div1, 0, cost});
+    }
+
+    // element-wise kernel touching elems elements in total
+    double Elementwise(const double elems) const
+    {
+        return model.launchCost + elems * elemBytes * model.byteCost;
+    }
+
+    // Add the large 1D decompositions of a smooth length
+    void EnumerateLarge(const size_t len, const size_t count, std::vector<Plan1DCandidate>& out)
+    {
+        const size_t threshold = Large1DThreshold(precision);
+
+        // TRTRT: the second row transform is a single kernel, the first one
+        // may be split further
+        for(size_t div0 = std::min(threshold, len / 2); div0 >= 2; div0--)
+        {
+            if(len % div0)
+                continue;
+            const size_t div1 = len / div0;
+            const double rows = Smooth(div1, count * div0);
+            const double cost = Transpose(div0, div1, count, false) + rows
+                                + Transpose(div1, div0, count, true)
+                                + Stockham(div0, count * div1)
+                                + Transpose(div0, div1, count, false);
+            out.push_back({CS_L1D_TRTRT, div0, div1, 0, cost});
+            AddPFA(div0, div1, count, rows, out);
+        }
+
+        for(size_t div1 = 64; div1 <= 256; div1 *= 2)
+        {
+            if((len % div1) || !BlockCCLength(div1, precision))
+                continue;
+            const size_t div0 = len / div1;
+            if(!BlockColumnsFit(div1, div0))
+                continue;
+
+            // CC: column kernel followed by the row-to-column kernel
+            if(BlockRCLength(div0) && BlockColumnsFit(div0, div1))
+            {
+                const double cost
+                    = Block(div1, count * div0, true) + Block(div0, count * div1, false);
+                out.push_back({CS_L1D_CC, div0, div1, 0, cost});
+            }
+
+            // CRT: column kernel, row kernel and a transpose
+            if(div0 <= threshold)
+            {
+                const double cost = Block(div1, count * div0, true) + Stockham(div0, count * div1)
+                                    + Transpose(div0, div1, count, false);
+                out.push_back({CS_L1D_CRT, div0, div1, 0, cost});
+            }
+        }
+    }
+
+    // Cheapest cost of count transforms of a smooth length
+    double Smooth(const size_t len, const size_t count)
+    {
+        if(len <= Large1DThreshold(precision))
+            return Stockham(len, count);
+
+        const auto key = std::make_pair(len, count);
+        const auto it  = smoothCost.find(key);
+        if(it != smoothCost.end())
+            return it->second;
+
+        std::vector<Plan1DCandidate> candidates;
+        EnumerateLarge(len, count, candidates);
+        assert(!candidates.empty());
+
+        double cost = candidates[0].cost;
+        for(const auto& c : candidates)
+            cost = std::min(cost, c.cost);
+        smoothCost[key] = cost;
+        return cost;
+    }
+
+    // Bluestein: pad and multiply, forward FFT, multiply by the FFT of the
+    // chirp, inverse FFT, multiply and copy back.  The chirp itself is
+    // computed with the plan.
+    double Bluestein(const size_t len, const size_t lenBlue, const size_t count)
+    {
+        const double elems = double(len) * count;
+        const double blue  = double(lenBlue) * count;
+        return Elementwise(elems + 2 * blue) + 2 * Smooth(lenBlue, count)
+               + Elementwise(3 * blue) + Elementwise(2 * elems + blue);
+    }
+
+    // Rader: permute into a length len - 1 cyclic convolution, forward FFT,
+    // multiply by the FFT of the kernel, inverse FFT, unpermute.  The kernel
+    // is computed with the plan.
+    double Rader(const size_t len, const size_t count)
+    {
+        const double elems = double(len) * count;
+        return Elementwise(2 * elems) + 2 * Smooth(len - 1, count) + Elementwise(2 * elems + len)
+               + Elementwise(2 * elems);
+    }
+
+    // Add the TRTRT decompositions of a length that is not smooth into a
+    // smooth single kernel length div0 and the rest, so that Bluestein or
+    // Rader only runs on the div1 point transforms
+    void EnumerateHybrid(const size_t len, const size_t count, std::vector<Plan1DCandidate>& out)
+    {
+        const size_t threshold = Large1DThreshold(precision);
+
+        for(size_t div0 = std::min(threshold, len / 2); div0 >= 2; div0--)
+        {
+            if((len % div0) || !SupportedLength(div0))
+                continue;
+            const size_t div1 = len / div0;
+            const double rows = Any(div1, count * div0);
+            const double cost = Transpose(div0, div1, count, false) + rows
+                                + Transpose(div1, div0, count, true)
+                                + Stockham(div0, count * div1)
+                                + Transpose(div0, div1, count, false);
+            out.push_back({CS_L1D_TRTRT, div0, div1, 0, cost});
+            AddPFA(div0, div1, count, rows, out);
+        }
+    }
+
+    // Cheapest cost of count transforms of any length
+    double Any(const size_t len, const size_t count)
+    {
+        if(SupportedLength(len))
+            return std::min(Smooth(len, count), Bluestein(len, FindBlue(len), count));
+
+        const auto key = std::make_pair(len, count);
+        const auto it  = anyCost.find(key);
+        if(it != anyCost.end())
+            return it->second;
+
+        double cost = Bluestein(len, FindBlue(len), count);
+        if(RaderLength(len))
+            cost = std::min(cost, Rader(len, count));
+
+        std::vector<Plan1DCandidate> candidates;
+        EnumerateHybrid(len, count, candidates);
+        for(const auto& c : candidates)
+            cost = std::min(cost, c.cost);
+        anyCost[key] = cost;
+        return cost;
+    }
+
+    // fused kernel over count transforms of elems elements, making passes
+    // radix passes over each of them
+    double Single(const size_t elems, const size_t passes, const size_t count)
+    {
+        const double total = double(elems) * count;
+        return model.launchCost
+               + total * (passes * model.passCost + 2 * elemBytes * model.byteCost);
+    }
+
+private:
+    const rocfft_precision precision;
+    const PlanCostModel&   model;
+    const size_t           elemBytes;
+
+    std::map<size_t, size_t>                    numPasses;
+    std::map<std::pair<size_t, size_t>, double> smoothCost;
+    std::map<std::pair<size_t, size_t>, double> anyCost;
+};
+
+std::vector<Plan1DCandidate> EnumeratePlan1D(const size_t           length,
+                                             const size_t           count,
+                                             const rocfft_precision precision,
+                                             const PlanCostModel&   model)
+{
+    PlanCoster                   coster(precision, model);
+    std::vector<Plan1DCandidate> candidates;
+
+    if(SupportedLength(length))
+    {
+        if(length <= Large1DThreshold(precision))
+            candidates.push_back({CS_KERNEL_STOCKHAM, 0, 0, 0, coster.Stockham(length, count)});
+        else
+            coster.EnumerateLarge(length, count, candidates);
+    }
+    else
+    {
+        // Bluestein or Rader on the large prime factors only
+        coster.EnumerateHybrid(length, count, candidates);
+    }
+
+    const size_t lengthBlue = FindBlue(length);
+    candidates.push_back(
+        {CS_BLUESTEIN, 0, 0, lengthBlue, coster.Bluestein(length, lengthBlue, count)});
+    if(RaderLength(length))
+        candidates.push_back({CS_RADER, 0, 0, 0, coster.Rader(length, count)});
+
+    std::stable_sort(candidates.begin(),
+                     candidates.end(),
+                     [](const Plan1DCandidate& a, const Plan1DCandidate& b) {
+                         return a.cost < b.cost;
+                     });
+    return candidates;
+}
+
+// Cheapest scheme for count transforms of the first dim lengths, and its cost
+static double CostMultiDim(PlanCoster&                coster,
+                           const std::vector<size_t>& length,
+                           const size_t               dim,
+                           const size_t               count,
+                           const bool                 unitColumns,
+                           const rocfft_precision     precision,
+                           ComputeScheme&             scheme)
+{
+    const bool   is3D  = (dim == 3);
+    const size_t outer = length[dim - 1];
+    const size_t inner = is3D ? length[0] * length[1] : length[0];
+
+    // the inner dimensions are transformed the same way by RTRT and RC
+    ComputeScheme innerScheme;
+    const double  innerCost
+        = is3D ? CostMultiDim(coster, length, 2, count * outer, unitColumns, precision, innerScheme)
+               : coster.Any(length[0], count * outer);
+
+    scheme      = is3D ? CS_3D_RTRT : CS_2D_RTRT;
+    double cost = innerCost + coster.Transpose(inner, outer, count, false)
+                  + coster.Any(outer, count * inner) + coster.Transpose(outer, inner, count, false);
+
+    if(unitColumns && BlockCCLength(outer, precision) && BlockColumnsFit(outer, length[0]))
+    {
+        const double rc = innerCost + coster.Block(outer, count * inner, false);
+        if(rc < cost)
+        {
+            scheme = is3D ? CS_3D_RC : CS_2D_RC;
+            cost   = rc;
+        }
+    }
+
+    if(SingleKernelShape(length, dim))
+    {
+        // the generated kernel runs the passes of the small kernel of each
+        // length, with the data in LDS in between
+        size_t elems  = 1;
+        size_t passes = 0;
+        for(size_t d = 0; d < dim; d++)
+        {
+            elems *= length[d];
+            passes += coster.Passes(length[d]);
+        }
+
+        const double single = coster.Single(elems, passes, count);
+        if(single < cost)
+        {
+            scheme = is3D ? CS_KERNEL_3D_SINGLE : CS_KERNEL_2D_SINGLE;
+            cost   = single;
+        }
+    }
+
+    return cost;
+}
+
+ComputeScheme ChoosePlanMultiDim(const std::vector<size_t>& length,
+                                 const size_t               dim,
+                                 const size_t               count,
+                                 const bool                 unitColumns,
+                                 const rocfft_precision     precision,
+                                 const PlanCostModel&       model)
+{
+    assert((dim == 2) || (dim == 3));
+    assert(length.size() >= dim);
+
+    PlanCoster    coster(precision, model);
+    ComputeScheme scheme;
+    CostMultiDim(coster, length, dim, count, unitColumns, precision, scheme);
+    return scheme;
+}
+
+// Cheapest cost of count complex transforms of the first dim lengths, on
+// contiguous data
+static double CostComplex(PlanCoster&                coster,
+                          const std::vector<size_t>& length,
+                          const size_t               dim,
+                          const size_t               count,
+                          const rocfft_precision     precision)
+{
+    if(dim == 1)
+        return coster.Any(length[0], count);
+
+    ComputeScheme scheme;
+    return CostMultiDim(coster, length, dim, count, true, precision, scheme);
+}
+
+bool ChooseRealPairs(const std::vector<size_t>& length,
+                     const size_t               dim,
+                     const size_t               count,
+                     const bool                 realAsComplex,
+                     const rocfft_precision     precision,
+                     const PlanCostModel&       model)
+{
+    assert((dim >= 1) && (dim <= 3));
+    assert(length.size() >= dim);
+
+    PlanCoster coster(precision, model);
+
+    size_t total = 1;
+    for(size_t d = 0; d < dim; d++)
+        total *= length[d];
+    const size_t outer = total / length[0];
+    const size_t herm  = (length[0] / 2 + 1) * outer;
+    const size_t pairs = (count + 1) / 2;
+
+    // Element counts are in complex elements, a real one counts as half.
+    // Pack the pairs, transform them, and separate the hermitian outputs.
+    const double paired = coster.Elementwise(0.5 * total * count + double(total) * pairs)
+                          + CostComplex(coster, length, dim, pairs, precision)
+                          + coster.Elementwise(double(total) * pairs + double(herm) * count);
+
+    double other;
+    if(length[0] % 2 == 0)
+    {
+        // Half-length row transforms and their post-processing, after
+        // packing the real data if it is strided, then transposes and
+        // column transforms of the hermitian data for each higher dimension.
+        const size_t half = length[0] / 2;
+        other = (realAsComplex ? 0 : coster.Elementwise(double(total) * count))
+                + coster.Any(half, count * outer)
+                + coster.Elementwise(double(half * outer + herm) * count);
+        for(size_t d = 1; d < dim; d++)
+        {
+            const size_t rest = herm / length[d];
+            other += coster.Transpose(rest, length[d], count, false)
+                     + coster.Any(length[d], count * rest)
+                     + coster.Transpose(length[d], rest, count, false);
+        }
+    }
+    else
+    {
+        // Embed into full-length complex data, transform and extract.
+        other = coster.Elementwise(1.5 * total * count)
+                + CostComplex(coster, length, dim, count, precision)
+                + coster.Elementwise(double(total + herm) * count);
+    }
+
+    return paired < other;
+}
+
+Plan1DCandidate PlanDecisions::Choose(const size_t                        length,
+                                      const std::vector<Plan1DCandidate>& candidates)
+{
+    assert(!candidates.empty());
+    Plan1DCandidate choice = candidates.front();
+
+    const size_t index = made.size();
+    if((index < forced.size()) && (forced[index].length == length))
+    {
+        for(const auto& c : candidates)
+        {
+            if(forced[index].Is(c))
+                choice = c;
+        }
+    }
+
+    made.push_back(Plan1DDecision(length, choice));
+    alternatives.push_back(candidates);
+    return choice;
+}
@@ -18,16 +18,19 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <cstddef>
 #include <iostream>
+#include <limits>
 #include <unordered_map>
 #include <vector>
 
 #include "rocfft.h"
 
 #include "plan.h"
+#include "private.h"
 #include "repo.h"
 #include "transform.h"
 
@@ -36,6 +39,7 @@
 #include "kernel_launch.h"
 
 #include "function_pool.h"
+#include "host_kernels.h"
 #include "ref_cpu.h"
 
 #include "real2complex.h"
@@ -49,42 +53,329 @@
 
 std::atomic<bool> fn_checked(false);
 
-// This function is called during creation of plan : enqueue the HIP kernels by function
-// pointers
-void PlanPowX(ExecPlan& execPlan)
+// Workgroup size of the generated CS_KERNEL_2D_SINGLE or CS_KERNEL_3D_SINGLE
+// kernel of shape: each dimension runs the small kernel of its length with
+// the same threads per transform, on every line of the shape at once
+static size_t SingleKernelWGS(const std::vector<size_t>& shape)
+{
+    size_t elems = 1;
+    for(auto len : shape)
+        elems *= len;
+
+    size_t wgs = 0;
+    for(auto len : shape)
+    {
+        size_t workGroupSize, numTransforms;
+        GetWGSAndNT(len, workGroupSize, numTransforms);
+        wgs = std::max(wgs, elems / len * (workGroupSize / numTransforms));
+    }
+    return wgs;
+}
+
+// Workgroups along x of a kernel whose grid PlanPowX sizes from the batch,
+// for batch members of node; 0 for the other kernels
+static size_t GridBlocksX(const TreeNode* node, size_t batch)
 {
+    size_t bwd = 0, wgs = 0, lds = 0;
+    switch(node->scheme)
+    {
+    case CS_KERNEL_STOCKHAM:
+    {
+        // get working group size and number of transforms
+        size_t workGroupSize;
+        size_t numTransforms;
+        GetWGSAndNT(node->length[0], workGroupSize, numTransforms);
+        for(size_t j = 1; j < node->length.size(); j++)
+            batch *= node->length[j];
+        return (batch % numTransforms) ? 1 + (batch / numTransforms) : (batch / numTransforms);
+    }
+    case CS_KERNEL_STOCKHAM_BLOCK_CC:
+    case CS_KERNEL_STOCKHAM_BLOCK_RC:
+    case CS_KERNEL_2D_STOCKHAM_BLOCK_CC:
+    case CS_KERNEL_3D_STOCKHAM_BLOCK_CC:
+    {
+        // one block of columns per workgroup over all of the remaining
+        // dimensions; lengths without a block compute kernel keep their grid
+        GetBlockComputeTable(node->length[0], bwd, wgs, lds);
+        if(bwd == 0)
+            return 0;
+        size_t blocks = node->length[1] / bwd * batch;
+        for(size_t j = 2; j < node->length.size(); j++)
+            blocks *= node->length[j];
+        return blocks;
+    }
+    case CS_KERNEL_2D_SINGLE:
+    case CS_KERNEL_3D_SINGLE:
+    {
+        // one workgroup per transform
+        const size_t dim = (node->scheme == CS_KERNEL_3D_SINGLE) ? 3 : 2;
+        for(size_t j = dim; j < node->length.size(); j++)
+            batch *= node->length[j];
+        return batch;
+    }
+    case CS_KERNEL_PAD_MUL:
+    case CS_KERNEL_FFT_MUL:
+    case CS_KERNEL_RES_MUL:
+    case CS_KERNEL_RADER_PERMUTE:
+    case CS_KERNEL_RADER_MUL:
+    case CS_KERNEL_RADER_UNPERMUTE:
+    {
+        // one work-item per element, 64 to a workgroup; the Bluestein
+        // multiplies run over the padded length except for the result
+        size_t count = ((node->scheme == CS_KERNEL_PAD_MUL) || (node->scheme == CS_KERNEL_FFT_MUL))
+                           ? node->lengthBlue
+                           : node->length[0];
+        count *= batch;
+        for(size_t j = 1; j < node->length.size(); j++)
+            count *= node->length[j];
+        return DivRoundingUp<size_t>(count, 64);
+    }
+    default:
+        return 0;
+    }
+}
+
+// Largest number of batch members of node that one launch covers, or 0 if
+// even one member does not fit in a grid.  HIP counts the work-items of a
+// grid dimension in 32 bits, and the kernels that put the higher dimensions
+// along y or the batch along z are limited to 65535 workgroups there.
+static size_t LaunchBatch(const TreeNode* node, unsigned int tpb_x)
+{
+    const size_t maxGridZ = 65535;
+    size_t       higher   = 1;
+    switch(node->scheme)
+    {
+    case CS_KERNEL_COPY_R_TO_CMPLX:
+    case CS_KERNEL_COPY_CMPLX_TO_R:
+    case CS_KERNEL_COPY_HERM_TO_CMPLX:
+    case CS_KERNEL_COPY_CMPLX_TO_HERM:
+    case CS_KERNEL_R_TO_CMPLX:
+    case CS_KERNEL_CMPLX_TO_R:
+    case CS_KERNEL_PACK_R_TO_CMPLX:
+    case CS_KERNEL_UNPACK_CMPLX_TO_R:
+        for(size_t j = 1; j < node->length.size(); j++)
+            higher *= node->length[j];
+        return (higher > maxGridZ) ? 0 : std::min(node->batch, maxGridZ);
+    case CS_KERNEL_PAIR_R_TO_CMPLX:
+    case CS_KERNEL_PAIR_CMPLX_TO_HERM:
+    case CS_KERNEL_PAIR_HERM_TO_CMPLX:
+    case CS_KERNEL_PAIR_CMPLX_TO_R:
+        // pairs of members along z, launches start on even members
+        for(size_t j = 1; j < node->length.size(); j++)
+            higher *= node->length[j];
+        return (higher > maxGridZ) ? 0 : std::min(node->batch, 2 * maxGridZ);
+    case CS_KERNEL_TRANSPOSE:
+    case CS_KERNEL_TRANSPOSE_INPLACE:
+    case CS_KERNEL_TRANSPOSE_XY_Z:
+    case CS_KERNEL_TRANSPOSE_Z_XY:
+    {
+        // the higher dimensions of the matrices go along z too
+        const size_t first = (node->scheme == CS_KERNEL_TRANSPOSE_XY_Z
+                              || node->scheme == CS_KERNEL_TRANSPOSE_Z_XY)
+                                 ? 3
+                                 : 2;
+        for(size_t j = first; j < node->length.size(); j++)
+            higher *= node->length[j];
+        return std::min(node->batch, maxGridZ / higher);
+    }
+    default:
+        break;
+    }
+
+    if(GridBlocksX(node, 1) == 0)
+        return node->batch;
+
+    // bisect for the largest batch whose grid fits along x
+    const size_t maxBlocks = std::numeric_limits<unsigned int>::max() / tpb_x;
+    size_t       lo        = 1;
+    size_t       hi        = node->batch;
+    while(lo < hi)
+    {
+        const size_t mid = hi - (hi - lo) / 2;
+        if(GridBlocksX(node, mid) <= maxBlocks)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    return (GridBlocksX(node, lo) <= maxBlocks) ? lo : 0;
+}
+
+// Whether one side of a node holds one transform per pair of batch members,
+// as the complex side of the pair kernels does
+static bool PairedSide(const TreeNode* node, const bool input)
+{
+    switch(node->scheme)
+    {
+    case CS_KERNEL_PAIR_R_TO_CMPLX:
+    case CS_KERNEL_PAIR_HERM_TO_CMPLX:
+        return !input;
+    case CS_KERNEL_PAIR_CMPLX_TO_HERM:
+    case CS_KERNEL_PAIR_CMPLX_TO_R:
+        return input;
+    default:
+        return false;
+    }
+}
+
+// Create the device tables that the device kernels of the plan read and
+// that are not created yet: twiddles, Bluestein chirps, Rader kernels and
+// the kernel arguments.  The host kernels compute their own tables.
+bool CreateDeviceTables(ExecPlan& execPlan)
+{
+    bool ok = true;
     for(size_t i = 0; i < execPlan.execSeq.size(); i++)
     {
-        if((execPlan.execSeq[i]->scheme == CS_KERNEL_STOCKHAM)
-           || (execPlan.execSeq[i]->scheme == CS_KERNEL_STOCKHAM_BLOCK_CC)
-           || (execPlan.execSeq[i]->scheme == CS_KERNEL_STOCKHAM_BLOCK_RC))
+        TreeNode* node = execPlan.execSeq[i];
+        if((node->scheme == CS_KERNEL_STOCKHAM) || (node->scheme == CS_KERNEL_STOCKHAM_BLOCK_CC)
+           || (node->scheme == CS_KERNEL_STOCKHAM_BLOCK_RC)
+           || (node->scheme == CS_KERNEL_2D_STOCKHAM_BLOCK_CC)
+           || (node->scheme == CS_KERNEL_3D_STOCKHAM_BLOCK_CC))
+        {
+            if(!node->twiddles)
+                node->twiddles = twiddles_create(node->length[0], node->precision, false, false);
+            ok = ok && node->twiddles;
+        }
+        else if((node->scheme == CS_KERNEL_2D_SINGLE) || (node->scheme == CS_KERNEL_3D_SINGLE))
+        {
+            const size_t dim = (node->scheme == CS_KERNEL_3D_SINGLE) ? 3 : 2;
+            if(!node->twiddles)
+                node->twiddles
+                    = twiddles_create_single_kernel(node->length, dim, node->precision);
+            ok = ok && node->twiddles;
+        }
+        else if((node->scheme == CS_KERNEL_R_TO_CMPLX) || (node->scheme == CS_KERNEL_CMPLX_TO_R))
+        {
+            if(!node->twiddles)
+                node->twiddles
+                    = twiddles_create(2 * node->length[0], node->precision, false, true);
+            ok = ok && node->twiddles;
+        }
+        else if((node->scheme == CS_KERNEL_PAD_MUL) || (node->scheme == CS_KERNEL_FFT_MUL)
+                || (node->scheme == CS_KERNEL_RES_MUL))
         {
-            execPlan.execSeq[i]->twiddles = twiddles_create(
-                execPlan.execSeq[i]->length[0], execPlan.execSeq[i]->precision, false, false);
+            // the FFT multiply runs over lengthBlue, so take N from the
+            // Bluestein node
+            if(!node->chirp)
+                node->chirp = chirp_create(
+                    node->parent->length[0], node->lengthBlue, node->direction, node->precision);
+            ok = ok && node->chirp;
         }
-        else if((execPlan.execSeq[i]->scheme == CS_KERNEL_R_TO_CMPLX)
-                || (execPlan.execSeq[i]->scheme == CS_KERNEL_CMPLX_TO_R))
+        else if(node->scheme == CS_KERNEL_RADER_MUL)
         {
-            execPlan.execSeq[i]->twiddles = twiddles_create(
-                2 * execPlan.execSeq[i]->length[0], execPlan.execSeq[i]->precision, false, true);
+            if(!node->chirp)
+                node->chirp = rader_create(
+                    node->length[0], node->raderRoot, node->direction, node->precision);
+            ok = ok && node->chirp;
         }
 
-        if(execPlan.execSeq[i]->large1D != 0)
+        if(node->large1D != 0)
         {
-            execPlan.execSeq[i]->twiddles_large = twiddles_create(
-                execPlan.execSeq[i]->large1D, execPlan.execSeq[i]->precision, true, false);
+            if(!node->twiddles_large)
+                node->twiddles_large
+                    = twiddles_create(node->large1D, node->precision, true, false);
+            ok = ok && node->twiddles_large;
         }
+
+        // copy host buffer to device buffer
+        if(!node->devKernArg)
+            node->devKernArg = kargs_create(
+                node->length, node->inStride, node->outStride, node->iDist, node->oDist);
+        ok = ok && node->devKernArg;
     }
-    // copy host buffer to device buffer
+    return ok;
+}
+
+// Create the host tables that the host kernels of the plan read and that
+// are not created yet: Bluestein chirps and Rader kernels
+bool CreateHostTables(ExecPlan& execPlan)
+{
+    bool ok = true;
     for(size_t i = 0; i < execPlan.execSeq.size(); i++)
     {
-        execPlan.execSeq[i]->devKernArg = kargs_create(execPlan.execSeq[i]->length,
-                                                       execPlan.execSeq[i]->inStride,
-                                                       execPlan.execSeq[i]->outStride,
-                                                       execPlan.execSeq[i]->iDist,
-                                                       execPlan.execSeq[i]->oDist);
+        TreeNode* node = execPlan.execSeq[i];
+        if((node->scheme == CS_KERNEL_PAD_MUL) || (node->scheme == CS_KERNEL_FFT_MUL)
+           || (node->scheme == CS_KERNEL_RES_MUL))
+        {
+            if(!node->hostChirp)
+                node->hostChirp
+                    = host_chirp_create(node->parent->length[0], node->lengthBlue, node->direction);
+            ok = ok && node->hostChirp;
+        }
+        else if(node->scheme == CS_KERNEL_RADER_MUL)
+        {
+            if(!node->hostChirp)
+                node->hostChirp
+                    = host_rader_create(node->length[0], node->raderRoot, node->direction);
+            ok = ok && node->hostChirp;
+        }
+    }
+    return ok;
+}
+
+bool TransformTable(
+    void* in, void* out, const size_t len, const int direction, const rocfft_precision precision)
+{
+    rocfft_plan_t plan;
+    rocfft_plan_create_internal(&plan,
+                                rocfft_placement_notinplace,
+                                (direction == -1) ? rocfft_transform_type_complex_forward
+                                                  : rocfft_transform_type_complex_inverse,
+                                precision,
+                                1,
+                                &len,
+                                1,
+                                nullptr,
+                                true);
+    plan.desc.backend = rocfft_execution_backend_device;
+
+    rocfft_execution_info_t info;
+    info.backend = rocfft_execution_backend_device;
+
+    ExecPlan execPlan;
+    bool     ok = false;
+    try
+    {
+        CreateExecPlan(plan, execPlan);
+        PlanPowX(execPlan);
+
+        ok = CreateDeviceTables(execPlan);
+        for(const auto& gp : execPlan.gridParam)
+            ok = ok && (gp.launchBatch > 0);
+
+        info.workBufferSize = execPlan.workBufSize * 2 * plan.base_type_size;
+        if(ok && (info.workBufferSize > 0))
+            ok = (hipMalloc(&info.workBuffer, info.workBufferSize) == hipSuccess);
+        if(ok)
+        {
+            void* in_buffer[2]  = {in, nullptr};
+            void* out_buffer[2] = {out, nullptr};
+            TransformPowX(execPlan, in_buffer, out_buffer, &info);
+            ok = (hipDeviceSynchronize() == hipSuccess);
+        }
+    }
+    catch(const std::bad_alloc&)
+    {
+        ok = false;
     }
 
+    if(info.workBuffer)
+        hipFree(info.workBuffer);
+    if(execPlan.rootPlan)
+        TreeNode::DeleteNode(execPlan.rootPlan);
+    return ok;
+}
+
+// This function is called during creation of plan : enqueue the HIP kernels by function
+// pointers
+void PlanPowX(ExecPlan& execPlan)
+{
+    // plans only get the tables of the other backend if they are executed
+    // there; a failure here is reported by rocfft_execute, which tries again
+    if(execPlan.rootPlan->backend == rocfft_execution_backend_device)
+        CreateDeviceTables(execPlan);
+    else
+        CreateHostTables(execPlan);
+
     if(!fn_checked)
     {
         fn_checked = true;
@@ -95,13 +386,12 @@ void PlanPowX(ExecPlan& execPlan)
     {
         DevFnCall ptr = nullptr;
         GridParam gp;
-        size_t    bwd, wgs, lds;
+        size_t    bwd = 0, wgs = 0, lds = 0;
 
         switch(execPlan.execSeq[i]->scheme)
         {
         case CS_KERNEL_STOCKHAM:
         {
-            // get working group size and number of transforms
             size_t workGroupSize;
             size_t numTransforms;
             GetWGSAndNT(execPlan.execSeq[i]->length[0], workGroupSize, numTransforms);
@@ -110,11 +400,6 @@ void PlanPowX(ExecPlan& execPlan)
                           std::make_pair(execPlan.execSeq[i]->length[0], CS_KERNEL_STOCKHAM))
                       : function_pool::get_function_double(
                           std::make_pair(execPlan.execSeq[i]->length[0], CS_KERNEL_STOCKHAM));
-            size_t batch = execPlan.execSeq[i]->batch;
-            for(size_t j = 1; j < execPlan.execSeq[i]->length.size(); j++)
-                batch *= execPlan.execSeq[i]->length[j];
-            gp.b_x
-                = (batch % numTransforms) ? 1 + (batch / numTransforms) : (batch / numTransforms);
             gp.tpb_x = workGroupSize;
         }
         break;
@@ -125,11 +410,6 @@ void PlanPowX(ExecPlan& execPlan)
                       : function_pool::get_function_double(std::make_pair(
                           execPlan.execSeq[i]->length[0], CS_KERNEL_STOCKHAM_BLOCK_CC));
             GetBlockComputeTable(execPlan.execSeq[i]->length[0], bwd, wgs, lds);
-            gp.b_x = (execPlan.execSeq[i]->length[1]) / bwd * execPlan.execSeq[i]->batch;
-            if(execPlan.execSeq[i]->length.size() == 3)
-            {
-                gp.b_x *= execPlan.execSeq[i]->length[2];
-            }
             gp.tpb_x = wgs;
             break;
         case CS_KERNEL_STOCKHAM_BLOCK_RC:
@@ -139,13 +419,31 @@ void PlanPowX(ExecPlan& execPlan)
                       : function_pool::get_function_double(std::make_pair(
                           execPlan.execSeq[i]->length[0], CS_KERNEL_STOCKHAM_BLOCK_RC));
             GetBlockComputeTable(execPlan.execSeq[i]->length[0], bwd, wgs, lds);
-            gp.b_x = (execPlan.execSeq[i]->length[1]) / bwd * execPlan.execSeq[i]->batch;
-            if(execPlan.execSeq[i]->length.size() == 3)
-            {
-                gp.b_x *= execPlan.execSeq[i]->length[2];
-            }
             gp.tpb_x = wgs;
             break;
+        case CS_KERNEL_2D_STOCKHAM_BLOCK_CC:
+        case CS_KERNEL_3D_STOCKHAM_BLOCK_CC:
+            // column pass of the RC schemes
+            ptr = (execPlan.execSeq[0]->precision == rocfft_precision_single)
+                      ? function_pool::get_function_single(std::make_pair(
+                          execPlan.execSeq[i]->length[0], execPlan.execSeq[i]->scheme))
+                      : function_pool::get_function_double(std::make_pair(
+                          execPlan.execSeq[i]->length[0], execPlan.execSeq[i]->scheme));
+            GetBlockComputeTable(execPlan.execSeq[i]->length[0], bwd, wgs, lds);
+            gp.tpb_x = wgs;
+            break;
+        case CS_KERNEL_2D_SINGLE:
+        case CS_KERNEL_3D_SINGLE:
+        {
+            const size_t dim = (execPlan.execSeq[i]->scheme == CS_KERNEL_3D_SINGLE) ? 3 : 2;
+            const std::vector<size_t> shape(execPlan.execSeq[i]->length.begin(),
+                                            execPlan.execSeq[i]->length.begin() + dim);
+            ptr = (execPlan.execSeq[0]->precision == rocfft_precision_single)
+                      ? function_pool::get_shape_function_single(shape)
+                      : function_pool::get_shape_function_double(shape);
+            gp.tpb_x = SingleKernelWGS(shape);
+            break;
+        }
         case CS_KERNEL_TRANSPOSE:
         case CS_KERNEL_TRANSPOSE_XY_Z:
         case CS_KERNEL_TRANSPOSE_Z_XY:
@@ -153,6 +451,9 @@ void PlanPowX(ExecPlan& execPlan)
             gp.tpb_x = (execPlan.execSeq[0]->precision == rocfft_precision_single) ? 32 : 64;
             gp.tpb_y = (execPlan.execSeq[0]->precision == rocfft_precision_single) ? 32 : 16;
             break;
+        case CS_KERNEL_TRANSPOSE_INPLACE:
+            ptr = &FN_PRFX(transpose_inplace);
+            break;
         case CS_KERNEL_COPY_R_TO_CMPLX:
             ptr      = &real2complex;
             gp.b_x   = (execPlan.execSeq[i]->length[0] - 1) / 512 + 1;
@@ -181,6 +482,18 @@ void PlanPowX(ExecPlan& execPlan)
             gp.tpb_x = 512;
             gp.tpb_y = 1;
             break;
+        case CS_KERNEL_PAIR_R_TO_CMPLX:
+            ptr = &pair_real2complex;
+            break;
+        case CS_KERNEL_PAIR_CMPLX_TO_HERM:
+            ptr = &pair_complex2hermitian;
+            break;
+        case CS_KERNEL_PAIR_HERM_TO_CMPLX:
+            ptr = &pair_hermitian2complex;
+            break;
+        case CS_KERNEL_PAIR_CMPLX_TO_R:
+            ptr = &pair_complex2real;
+            break;
         case CS_KERNEL_R_TO_CMPLX:
             ptr = &r2c_1d_post;
             // specify grid params only if the kernel from code generator
@@ -189,9 +502,11 @@ void PlanPowX(ExecPlan& execPlan)
             ptr = &c2r_1d_pre;
             // specify grid params only if the kernel from code generator
             break;
-        case CS_KERNEL_CHIRP:
-            ptr      = &FN_PRFX(chirp);
-            gp.tpb_x = 64;
+        case CS_KERNEL_PACK_R_TO_CMPLX:
+            ptr = &r2c_1d_pack;
+            break;
+        case CS_KERNEL_UNPACK_CMPLX_TO_R:
+            ptr = &c2r_1d_unpack;
             break;
         case CS_KERNEL_PAD_MUL:
         case CS_KERNEL_FFT_MUL:
@@ -199,16 +514,103 @@ void PlanPowX(ExecPlan& execPlan)
             ptr      = &FN_PRFX(mul);
             gp.tpb_x = 64;
             break;
+        case CS_KERNEL_RADER_PERMUTE:
+        case CS_KERNEL_RADER_MUL:
+        case CS_KERNEL_RADER_UNPERMUTE:
+            ptr      = &FN_PRFX(rader);
+            gp.tpb_x = 64;
+            break;
         default:
             std::cout << "should not be in this case" << std::endl;
             std::cout << "scheme: " << PrintScheme(execPlan.execSeq[i]->scheme) << std::endl;
         }
 
+        // the grid along x of the kernels sized by GridBlocksX is sized for
+        // one launch
+        gp.launchBatch = LaunchBatch(execPlan.execSeq[i], gp.tpb_x);
+        if(size_t blocks = GridBlocksX(execPlan.execSeq[i], gp.launchBatch))
+            gp.b_x = blocks;
+
         execPlan.devFnCall.push_back(ptr);
         execPlan.gridParam.push_back(gp);
     }
 }
 
+void LimitLaunchBatch(ExecPlan& execPlan, const size_t maxBatch)
+{
+    for(size_t i = 0; i < execPlan.execSeq.size(); i++)
+    {
+        const TreeNode* node = execPlan.execSeq[i];
+        GridParam&      gp   = execPlan.gridParam[i];
+        if(gp.launchBatch <= maxBatch)
+            continue;
+
+        gp.launchBatch = std::max<size_t>(maxBatch, 1);
+        // launches of the pair kernels start on even members
+        if(PairedSide(node, true) || PairedSide(node, false))
+            gp.launchBatch = std::max<size_t>(gp.launchBatch & ~size_t(1), 2);
+        if(size_t blocks = GridBlocksX(node, gp.launchBatch))
+            gp.b_x = blocks;
+    }
+}
+
+static bool IsPlanarArray(const rocfft_array_type type)
+{
+    return (type == rocfft_array_type_complex_planar)
+           || (type == rocfft_array_type_hermitian_planar);
+}
+
+// Address of the element at offset of a buffer, counted in elements of its
+// array type: complex for interleaved data, real for real and planar data
+static void* BufferAt(void*                   buf,
+                      const size_t            offset,
+                      const rocfft_array_type type,
+                      const rocfft_precision  precision)
+{
+    size_t elemBytes = (precision == rocfft_precision_single) ? sizeof(float) : sizeof(double);
+    if(type == rocfft_array_type_complex_interleaved
+       || type == rocfft_array_type_hermitian_interleaved)
+        elemBytes *= 2;
+    return (void*)((char*)buf + offset * elemBytes);
+}
+
+// Run a kernel over the batch of its node, for at most gridParam.launchBatch
+// members at a time, with the buffers moved to the first member of each
+// launch.  A kernel whose grid does not fit for one member runs unsplit on
+// the host; rocfft_execute rejects such plans on the device.
+static void RunKernel(DevFnCall fn, const DeviceCallIn& data, DeviceCallOut& back, bool device)
+{
+    const TreeNode* node        = data.node;
+    size_t          launchBatch = data.gridParam.launchBatch;
+    assert(launchBatch != 0 || !device);
+    if(launchBatch == 0)
+        launchBatch = node->batch;
+
+    for(size_t first = 0; first < node->batch; first += launchBatch)
+    {
+        DeviceCallIn part = data;
+        part.batch        = std::min(launchBatch, node->batch - first);
+        if(first > 0)
+        {
+            // launches of the pair kernels start on even members
+            const size_t inFirst  = PairedSide(node, true) ? first / 2 : first;
+            const size_t outFirst = PairedSide(node, false) ? first / 2 : first;
+            for(size_t c = 0; c < (IsPlanarArray(node->inArrayType) ? 2 : 1); c++)
+                part.bufIn[c] = BufferAt(
+                    data.bufIn[c], inFirst * node->iDist, node->inArrayType, node->precision);
+            for(size_t c = 0; c < (IsPlanarArray(node->outArrayType) ? 2 : 1); c++)
+                part.bufOut[c] = BufferAt(
+                    data.bufOut[c], outFirst * node->oDist, node->outArrayType, node->precision);
+        }
+        if(part.batch != launchBatch)
+        {
+            if(size_t blocks = GridBlocksX(node, part.batch))
+                part.gridParam.b_x = blocks;
+        }
+        fn(&part, &back);
+    }
+}
+
 void TransformPowX(const ExecPlan&       execPlan,
                    void*                 in_buffer[],
                    void*                 out_buffer[],
@@ -217,6 +619,27 @@ void TransformPowX(const ExecPlan&       execPlan,
     assert(execPlan.execSeq.size() == execPlan.devFnCall.size());
     assert(execPlan.execSeq.size() == execPlan.gridParam.size());
 
+    const rocfft_execution_backend backend
+        = (info == nullptr) ? DefaultExecutionBackend() : info->backend;
+
+    // Bind the user buffers at the offsets of the plan description.  An
+    // in-place plan reaches both sides through the input buffer, whose
+    // offsets plan creation checks address the same data as the output
+    // offsets.
+    const TreeNode* root       = execPlan.rootPlan;
+    void*           userIn[2]  = {nullptr, nullptr};
+    void*           userOut[2] = {nullptr, nullptr};
+    for(size_t c = 0; c < (IsPlanarArray(root->inArrayType) ? 2 : 1); c++)
+        userIn[c] = BufferAt(in_buffer[c], root->inOffset[c], root->inArrayType, root->precision);
+    for(size_t c = 0; c < (IsPlanarArray(root->outArrayType) ? 2 : 1); c++)
+    {
+        if(root->placement == rocfft_placement_inplace)
+            userOut[c] = userIn[c];
+        else
+            userOut[c] = BufferAt(
+                out_buffer[c], root->outOffset[c], root->outArrayType, root->precision);
+    }
+
     for(size_t i = 0; i < execPlan.execSeq.size(); i++)
     {
         DeviceCallIn  data;
@@ -224,29 +647,31 @@ void TransformPowX(const ExecPlan&       execPlan,
 
         data.node          = execPlan.execSeq[i];
         data.rocfft_stream = (info == nullptr) ? 0 : info->rocfft_stream;
+        data.hostThreads   = (info == nullptr) ? 0 : info->hostThreads;
+        data.batch         = data.node->batch;
         size_t inBytes     = (data.node->precision == rocfft_precision_single) ? sizeof(float) * 2
                                                                            : sizeof(double) * 2;
 
         switch(data.node->obIn)
         {
         case OB_USER_IN:
-            data.bufIn[0] = in_buffer[0];
+            data.bufIn[0] = userIn[0];
             if(data.node->inArrayType == rocfft_array_type_complex_planar
                || data.node->inArrayType == rocfft_array_type_hermitian_planar)
             {
-                data.bufIn[1] = in_buffer[1];
+                data.bufIn[1] = userIn[1];
             }
             break;
         case OB_USER_OUT:
-            data.bufIn[0] = out_buffer[0];
+            data.bufIn[0] = userOut[0];
             if(data.node->inArrayType == rocfft_array_type_complex_planar
                || data.node->inArrayType == rocfft_array_type_hermitian_planar)
             {
-                data.bufIn[1] = out_buffer[1];
+                data.bufIn[1] = userOut[1];
             }
             break;
         case OB_TEMP:
-            data.bufIn[0] = info->workBuffer;
+            data.bufIn[0] = (void*)((char*)info->workBuffer + execPlan.tmpWorkBufOffset * inBytes);
             if(data.node->inArrayType == rocfft_array_type_complex_planar
                || data.node->inArrayType == rocfft_array_type_hermitian_planar)
             {
@@ -254,17 +679,16 @@ void TransformPowX(const ExecPlan&       execPlan,
                 // interleaved format, and we just need to split it for
                 // planar.
                 data.bufIn[1]
-                    = (void*)((char*)info->workBuffer + execPlan.workBufSize * inBytes / 2);
+                    = (void*)((char*)data.bufIn[0] + execPlan.tmpWorkBufSize * inBytes / 2);
             }
             break;
         case OB_TEMP_CMPLX_FOR_REAL:
-            data.bufIn[0] = (void*)((char*)info->workBuffer + execPlan.tmpWorkBufSize * inBytes);
+            data.bufIn[0]
+                = (void*)((char*)info->workBuffer + execPlan.copyWorkBufOffset * inBytes);
             break;
         case OB_TEMP_BLUESTEIN:
             data.bufIn[0] = (void*)((char*)info->workBuffer
-                                    + (execPlan.tmpWorkBufSize + execPlan.copyWorkBufSize
-                                       + data.node->iOffset)
-                                          * inBytes);
+                                    + (execPlan.blueWorkBufOffset + data.node->iOffset) * inBytes);
             break;
         case OB_UNINIT:
             std::cerr << "Error: operating buffer not initialized for kernel!\n";
@@ -277,23 +701,23 @@ void TransformPowX(const ExecPlan&       execPlan,
         switch(data.node->obOut)
         {
         case OB_USER_IN:
-            data.bufOut[0] = in_buffer[0];
+            data.bufOut[0] = userIn[0];
             if(data.node->outArrayType == rocfft_array_type_complex_planar
                || data.node->outArrayType == rocfft_array_type_hermitian_planar)
             {
-                data.bufOut[1] = in_buffer[1];
+                data.bufOut[1] = userIn[1];
             }
             break;
         case OB_USER_OUT:
-            data.bufOut[0] = out_buffer[0];
+            data.bufOut[0] = userOut[0];
             if(data.node->outArrayType == rocfft_array_type_complex_planar
                || data.node->outArrayType == rocfft_array_type_hermitian_planar)
             {
-                data.bufOut[1] = out_buffer[1];
+                data.bufOut[1] = userOut[1];
             }
             break;
         case OB_TEMP:
-            data.bufOut[0] = info->workBuffer;
+            data.bufOut[0] = (void*)((char*)info->workBuffer + execPlan.tmpWorkBufOffset * inBytes);
             if(data.node->outArrayType == rocfft_array_type_complex_planar
                || data.node->outArrayType == rocfft_array_type_hermitian_planar)
             {
@@ -301,17 +725,16 @@ void TransformPowX(const ExecPlan&       execPlan,
                 // interleaved format, and we just need to split it for
                 // planar.
                 data.bufOut[1]
-                    = (void*)((char*)info->workBuffer + execPlan.workBufSize * inBytes / 2);
+                    = (void*)((char*)data.bufOut[0] + execPlan.tmpWorkBufSize * inBytes / 2);
             }
             break;
         case OB_TEMP_CMPLX_FOR_REAL:
-            data.bufOut[0] = (void*)((char*)info->workBuffer + execPlan.tmpWorkBufSize * inBytes);
+            data.bufOut[0]
+                = (void*)((char*)info->workBuffer + execPlan.copyWorkBufOffset * inBytes);
             break;
         case OB_TEMP_BLUESTEIN:
             data.bufOut[0] = (void*)((char*)info->workBuffer
-                                     + (execPlan.tmpWorkBufSize + execPlan.copyWorkBufSize
-                                        + data.node->oOffset)
-                                           * inBytes);
+                                     + (execPlan.blueWorkBufOffset + data.node->oOffset) * inBytes);
             break;
         default:
             assert(false);
@@ -385,7 +808,9 @@ void TransformPowX(const ExecPlan&       execPlan,
         std::cout << "attempting kernel: " << i << std::endl;
 #endif
 
-        DevFnCall fn = execPlan.devFnCall[i];
+        DevFnCall fn = (backend == rocfft_execution_backend_host)
+                           ? host_function(data.node->scheme)
+                           : execPlan.devFnCall[i];
         if(fn)
         {
 #ifdef REF_DEBUG
@@ -422,7 +847,7 @@ void TransformPowX(const ExecPlan&       execPlan,
 #endif
 
             // execution kernel:
-            fn(&data, &back);
+            RunKernel(fn, data, back, backend == rocfft_execution_backend_device);
 
 #ifdef REF_DEBUG
             refLibOp.VerifyResult(&data);
@@ -28,6 +28,7 @@
 #include "plan.h"
 #include "repo.h"
 #include "rocfft.h"
+#include "wisdom.h"
 
 // Implementation of Class Repo
 
@@ -42,34 +43,22 @@ void Repo::CreatePlan(rocfft_plan plan)
     auto it = repo.planUnique.find(*plan);
     if(it == repo.planUnique.end()) // if not found
     {
-        TreeNode* rootPlan = TreeNode::CreateNode();
-
-        rootPlan->dimension = plan->rank;
-        rootPlan->batch     = plan->batch;
-        for(size_t i = 0; i < plan->rank; i++)
+        // follow the decisions measured or imported for this problem, or
+        // measure them now in measure mode
+        std::vector<Plan1DDecision> decided;
+        bool                        wise = Wisdom::GetWisdom().Find(*plan, decided);
+        if(!wise && (plan->desc.planMode == rocfft_plan_mode_measure))
         {
-            rootPlan->length.push_back(plan->lengths[i]);
-
-            rootPlan->inStride.push_back(plan->desc.inStrides[i]);
-            rootPlan->outStride.push_back(plan->desc.outStrides[i]);
+            MeasurePlan(*plan, decided);
+            Wisdom::GetWisdom().Record(*plan, decided);
+            wise = true;
         }
-        rootPlan->iDist = plan->desc.inDist;
-        rootPlan->oDist = plan->desc.outDist;
-
-        rootPlan->placement = plan->placement;
-        rootPlan->precision = plan->precision;
-        if((plan->transformType == rocfft_transform_type_complex_forward)
-           || (plan->transformType == rocfft_transform_type_real_forward))
-            rootPlan->direction = -1;
-        else
-            rootPlan->direction = 1;
 
-        rootPlan->inArrayType  = plan->desc.inArrayType;
-        rootPlan->outArrayType = plan->desc.outArrayType;
+        PlanDecisions decisions;
+        decisions.forced = decided;
 
         ExecPlan execPlan;
-        execPlan.rootPlan = rootPlan;
-        ProcessNode(execPlan); // TODO: more descriptions are needed
+        CreateExecPlan(*plan, execPlan, wise ? &decisions : nullptr);
         if(LOG_TRACE_ENABLED())
             PrintNode(*LogSingleton::GetInstance().GetTraceOS(), execPlan);
 
@@ -119,6 +108,40 @@ void Repo::DeletePlan(rocfft_plan plan)
     }
 }
 
+// Cap the launches of this plan only; the plans sharing its ExecPlan keep
+// their own copy of the grid parameters
+void Repo::LimitLaunchBatch(rocfft_plan plan, size_t maxBatch)
+{
+    Repo&                       repo = Repo::GetRepo();
+    std::lock_guard<std::mutex> lck(mtx);
+    auto                        it = repo.execLookup.find(plan);
+    if(it != repo.execLookup.end())
+        ::LimitLaunchBatch(it->second, maxBatch);
+}
+
+// Device tables are shared by every plan using the same tree, so they are
+// created under the lock the first time any of them runs on the device
+bool Repo::CreateDeviceTables(rocfft_plan plan)
+{
+    Repo&                       repo = Repo::GetRepo();
+    std::lock_guard<std::mutex> lck(mtx);
+    auto                        it = repo.execLookup.find(plan);
+    if(it == repo.execLookup.end())
+        return false;
+    return ::CreateDeviceTables(it->second);
+}
+
+// Likewise for the host tables of plans built for the device
+bool Repo::CreateHostTables(rocfft_plan plan)
+{
+    Repo&                       repo = Repo::GetRepo();
+    std::lock_guard<std::mutex> lck(mtx);
+    auto                        it = repo.execLookup.find(plan);
+    if(it == repo.execLookup.end())
+        return false;
+    return ::CreateHostTables(it->second);
+}
+
 size_t Repo::GetUniquePlanCount()
 {
     Repo&                       repo = Repo::GetRepo();
@@ -22,6 +22,7 @@
 
 #include <cassert>
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <vector>
 
@@ -31,6 +32,17 @@
 #include "rocfft.h"
 #include "transform.h"
 
+rocfft_execution_backend DefaultExecutionBackend()
+{
+    static const rocfft_execution_backend backend = []() {
+        const char* str_backend = getenv("ROCFFT_EXECUTION_BACKEND");
+        if(str_backend && strcmp(str_backend, "host") == 0)
+            return rocfft_execution_backend_host;
+        return rocfft_execution_backend_device;
+    }();
+    return backend;
+}
+
 rocfft_status rocfft_execution_info_create(rocfft_execution_info* info)
 {
     rocfft_execution_info einfo = new rocfft_execution_info_t;
@@ -68,6 +80,22 @@ rocfft_status rocfft_execution_info_set_stream(rocfft_execution_info info, void*
     return rocfft_status_success;
 }
 
+rocfft_status rocfft_execution_info_set_backend(rocfft_execution_info    info,
+                                                rocfft_execution_backend backend)
+{
+    log_trace(__func__, "info", info, "backend", backend);
+    info->backend = backend;
+    return rocfft_status_success;
+}
+
+rocfft_status rocfft_execution_info_set_thread_count(rocfft_execution_info info,
+                                                     size_t                thread_count)
+{
+    log_trace(__func__, "info", info, "thread_count", thread_count);
+    info->hostThreads = thread_count;
+    return rocfft_status_success;
+}
+
 rocfft_status rocfft_execute(const rocfft_plan     plan,
                              void*                 in_buffer[],
                              void*                 out_buffer[],
@@ -92,6 +120,27 @@ rocfft_status rocfft_execute(const rocfft_plan     plan,
         assert(info->workBufferSize >= (execPlan.workBufSize * 2 * plan->base_type_size));
     }
 
+    // on the device, every kernel has to fit in a grid for one batch member
+    const rocfft_execution_backend backend
+        = (info == nullptr) ? DefaultExecutionBackend() : info->backend;
+    if(backend == rocfft_execution_backend_device)
+    {
+        for(const auto& gp : execPlan.gridParam)
+        {
+            if(gp.launchBatch == 0)
+                return rocfft_status_invalid_dimensions;
+        }
+
+        // plans built for the host backend get their device tables here
+        if(!repo.CreateDeviceTables(plan))
+            return rocfft_status_failure;
+    }
+    else if(!repo.CreateHostTables(plan))
+    {
+        // and plans built for the device get their host tables here
+        return rocfft_status_failure;
+    }
+
     if(plan->placement == rocfft_placement_inplace)
         TransformPowX(execPlan, in_buffer, in_buffer, info);
     else
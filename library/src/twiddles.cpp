@@ -21,13 +21,34 @@
 *******************************************************************************/
 
 #include "twiddles.h"
+#include "host_kernels.h"
+#include "kernel_launch.h"
+#include "plan.h"
 #include "radix_table.h"
 #include "rocfft_hip.h"
+#include <map>
+#include <memory>
+#include <mutex>
+
+// Copy a host table of count entries to a new device buffer, or return
+// nullptr if the device cannot hold it
+template <typename T>
+static void* twiddles_to_device(const void* twtc, const size_t count)
+{
+    void* twts = nullptr;
+    if(hipMalloc(&twts, count * sizeof(T)) != hipSuccess)
+        return nullptr;
+    if(hipMemcpy(twts, twtc, count * sizeof(T), hipMemcpyHostToDevice) != hipSuccess)
+    {
+        hipFree(twts);
+        return nullptr;
+    }
+    return twts;
+}
 
 template <typename T>
 void* twiddles_create_pr(size_t N, size_t threshold, bool large, bool no_radices)
 {
-    void*  twts; // device side
     void*  twtc; // host side
     size_t ns = 0; // table size
 
@@ -45,8 +66,7 @@ void* twiddles_create_pr(size_t N, size_t threshold, bool large, bool no_radices
             twtc    = twTable.GenerateTwiddleTable(radices); // calculate twiddles on host side
         }
 
-        hipMalloc(&twts, N * sizeof(T));
-        hipMemcpy(twts, twtc, N * sizeof(T), hipMemcpyHostToDevice);
+        return twiddles_to_device<T>(twtc, N);
     }
     else
     {
@@ -54,20 +74,16 @@ void* twiddles_create_pr(size_t N, size_t threshold, bool large, bool no_radices
         {
             TwiddleTable<T> twTable(N);
             twtc = twTable.GenerateTwiddleTable();
-            hipMalloc(&twts, N * sizeof(T));
-            hipMemcpy(twts, twtc, N * sizeof(T), hipMemcpyHostToDevice);
+            return twiddles_to_device<T>(twtc, N);
         }
         else
         {
             TwiddleTableLarge<T> twTable(N); // does not generate radices
             std::tie(ns, twtc) = twTable.GenerateTwiddleTable(); // calculate twiddles on host side
 
-            hipMalloc(&twts, ns * sizeof(T));
-            hipMemcpy(twts, twtc, ns * sizeof(T), hipMemcpyHostToDevice);
+            return twiddles_to_device<T>(twtc, ns);
         }
     }
-
-    return twts;
 }
 
 void* twiddles_create(size_t N, rocfft_precision precision, bool large, bool no_radices)
@@ -83,8 +99,198 @@ void* twiddles_create(size_t N, rocfft_precision precision, bool large, bool no_
     }
 }
 
+template <typename T>
+void* twiddles_create_single_kernel_pr(const std::vector<size_t>& lengths, const size_t dim)
+{
+    // the table of each length as its small kernel reads it, one after
+    // the other
+    std::vector<T> twtc;
+    for(size_t d = 0; d < dim; d++)
+    {
+        TwiddleTable<T> twTable(lengths[d]);
+        T*              table = twTable.GenerateTwiddleTable(GetRadices(lengths[d]));
+        twtc.insert(twtc.end(), table, table + lengths[d]);
+    }
+
+    return twiddles_to_device<T>(twtc.data(), twtc.size());
+}
+
+void* twiddles_create_single_kernel(const std::vector<size_t>& lengths,
+                                    const size_t               dim,
+                                    rocfft_precision           precision)
+{
+    if(precision == rocfft_precision_single)
+        return twiddles_create_single_kernel_pr<float2>(lengths, dim);
+    else if(precision == rocfft_precision_double)
+        return twiddles_create_single_kernel_pr<double2>(lengths, dim);
+    else
+    {
+        assert(false);
+        return nullptr;
+    }
+}
+
 void twiddles_delete(void* twt)
 {
     if(twt)
         hipFree(twt);
 }
+
+// Compute a chirp or Rader kernel table on the device: a plan-time kernel
+// writes the sequence and a batch-1 plan transforms it.  The chirp table
+// holds the chirp followed by its FFT, the Rader table only the FFT of the
+// kernel.  Returns nullptr if the device cannot hold or compute it.
+static void* chirp_table_compute(const bool             rader,
+                                 const size_t           N,
+                                 const size_t           M,
+                                 const int              direction,
+                                 const rocfft_precision precision)
+{
+    const size_t elemBytes
+        = (precision == rocfft_precision_single) ? sizeof(float2) : sizeof(double2);
+    const size_t len = rader ? N - 1 : M;
+
+    void* table = nullptr;
+    if(hipMalloc(&table, (rader ? 1 : 2) * len * elemBytes) != hipSuccess)
+        return nullptr;
+
+    bool ok = false;
+    if(rader)
+    {
+        void* kernel = nullptr;
+        if(hipMalloc(&kernel, len * elemBytes) == hipSuccess)
+        {
+            rocfft_internal_rader_kernel(N, M, direction, precision, kernel, 0);
+            ok = TransformTable(kernel, table, len, direction, precision);
+            hipFree(kernel);
+        }
+    }
+    else
+    {
+        void* twiddles_large = twiddles_create(2 * N, precision, true, false);
+        if(twiddles_large)
+        {
+            rocfft_internal_chirp(N, M, direction, precision, table, twiddles_large, 0);
+            ok = TransformTable(table, (char*)table + len * elemBytes, len, direction, precision);
+            twiddles_delete(twiddles_large);
+        }
+    }
+
+    if(!ok)
+    {
+        hipFree(table);
+        return nullptr;
+    }
+    return table;
+}
+
+// Chirp and Rader kernel tables in use, keyed by (Rader, N, M or g,
+// direction, precision), with the number of create calls that hold each of
+// them.  The host tables of the host backend are kept the same way, under
+// rocfft_precision_double.
+typedef std::tuple<bool, size_t, size_t, int, rocfft_precision> ChirpKey;
+static std::map<ChirpKey, std::pair<void*, size_t>>             chirpTables;
+static std::map<ChirpKey, std::pair<HostChirpTable*, size_t>>   hostChirpTables;
+static std::mutex                                               chirpMtx;
+
+static void* chirp_table_create(const bool             rader,
+                                const size_t           N,
+                                const size_t           M,
+                                const int              direction,
+                                const rocfft_precision precision)
+{
+    std::lock_guard<std::mutex> lck(chirpMtx);
+
+    const ChirpKey key   = std::make_tuple(rader, N, M, direction, precision);
+    auto           found = chirpTables.find(key);
+    if(found == chirpTables.end())
+    {
+        void* table = chirp_table_compute(rader, N, M, direction, precision);
+        if(!table)
+            return nullptr;
+        found = chirpTables.emplace(key, std::make_pair(table, size_t(0))).first;
+    }
+    found->second.second++;
+    return found->second.first;
+}
+
+void* chirp_create(size_t N, size_t M, int direction, rocfft_precision precision)
+{
+    return chirp_table_create(false, N, M, direction, precision);
+}
+
+void* rader_create(size_t N, size_t g, int direction, rocfft_precision precision)
+{
+    return chirp_table_create(true, N, g, direction, precision);
+}
+
+void chirp_delete(void* chirp)
+{
+    std::lock_guard<std::mutex> lck(chirpMtx);
+
+    for(auto it = chirpTables.begin(); it != chirpTables.end(); ++it)
+    {
+        if(it->second.first != chirp)
+            continue;
+        if(--it->second.second == 0)
+        {
+            hipFree(chirp);
+            chirpTables.erase(it);
+        }
+        return;
+    }
+}
+
+static const HostChirpTable*
+    host_chirp_table_create(const bool rader, const size_t N, const size_t M, const int direction)
+{
+    std::lock_guard<std::mutex> lck(chirpMtx);
+
+    const ChirpKey key   = std::make_tuple(rader, N, M, direction, rocfft_precision_double);
+    auto           found = hostChirpTables.find(key);
+    if(found == hostChirpTables.end())
+    {
+        // the tables of long Bluestein lengths may not fit in host memory
+        try
+        {
+            std::unique_ptr<HostChirpTable> table(
+                new HostChirpTable(rader ? host_rader_kernel(N, M, direction)
+                                         : host_bluestein_chirp(N, M, direction)));
+            found = hostChirpTables.emplace(key, std::make_pair(table.get(), size_t(0))).first;
+            table.release();
+        }
+        catch(const std::bad_alloc&)
+        {
+            return nullptr;
+        }
+    }
+    found->second.second++;
+    return found->second.first;
+}
+
+const HostChirpTable* host_chirp_create(size_t N, size_t M, int direction)
+{
+    return host_chirp_table_create(false, N, M, direction);
+}
+
+const HostChirpTable* host_rader_create(size_t N, size_t g, int direction)
+{
+    return host_chirp_table_create(true, N, g, direction);
+}
+
+void host_chirp_delete(const HostChirpTable* chirp)
+{
+    std::lock_guard<std::mutex> lck(chirpMtx);
+
+    for(auto it = hostChirpTables.begin(); it != hostChirpTables.end(); ++it)
+    {
+        if(it->second.first != chirp)
+            continue;
+        if(--it->second.second == 0)
+        {
+            delete it->second.first;
+            hostChirpTables.erase(it);
+        }
+        return;
+    }
+}
@@ -0,0 +1,429 @@
+/******************************************************************************
+* Copyright (c) 2016 - present Advanced Micro Devices, Inc. All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*******************************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+#include "logging.h"
+#include "plan.h"
+#include "rocfft_hip.h"
+#include "transform.h"
+#include "wisdom.h"
+
+rocfft_plan_t Wisdom::Key(const rocfft_plan_t& plan)
+{
+    rocfft_plan_t key  = plan;
+    key.desc.planMode  = rocfft_plan_mode_estimate;
+    key.desc.timeLimit = 0.0;
+    return key;
+}
+
+bool Wisdom::Find(const rocfft_plan_t& plan, std::vector<Plan1DDecision>& decided)
+{
+    std::lock_guard<std::mutex> lck(mtx);
+    auto                        it = decisions.find(Key(plan));
+    if(it == decisions.end())
+        return false;
+    decided = it->second;
+    return true;
+}
+
+void Wisdom::Record(const rocfft_plan_t& plan, const std::vector<Plan1DDecision>& decided)
+{
+    std::lock_guard<std::mutex> lck(mtx);
+    decisions[Key(plan)] = decided;
+}
+
+// Schemes build_1D can choose, written by name so that wisdom does not
+// depend on the order of ComputeScheme
+static const std::vector<ComputeScheme> wisdomSchemes
+    = {CS_KERNEL_STOCKHAM, CS_L1D_TRTRT, CS_L1D_CC, CS_L1D_CRT, CS_L1D_PFA, CS_BLUESTEIN, CS_RADER};
+
+static const char* wisdomHeader  = "rocfft_wisdom";
+static const int   wisdomVersion = 2;
+
+std::string Wisdom::Export()
+{
+    std::lock_guard<std::mutex> lck(mtx);
+
+    std::ostringstream os;
+    os << std::setprecision(17);
+    os << wisdomHeader << " " << wisdomVersion << "\n";
+    for(const auto& entry : decisions)
+    {
+        const rocfft_plan_t& p = entry.first;
+        os << "plan " << p.rank;
+        for(auto len : p.lengths)
+            os << " " << len;
+        os << " " << p.batch << " " << p.placement << " " << p.transformType << " "
+           << p.precision << " " << p.desc.inArrayType << " " << p.desc.outArrayType;
+        for(auto stride : p.desc.inStrides)
+            os << " " << stride;
+        for(auto stride : p.desc.outStrides)
+            os << " " << stride;
+        os << " " << p.desc.inDist << " " << p.desc.outDist;
+        for(auto offset : p.desc.inOffset)
+            os << " " << offset;
+        for(auto offset : p.desc.outOffset)
+            os << " " << offset;
+        os << " " << p.desc.scale << " " << p.desc.backend << "\n";
+
+        os << "decisions " << entry.second.size() << "\n";
+        for(const auto& d : entry.second)
+            os << d.length << " " << PrintScheme(d.scheme) << " " << d.divLength0 << " "
+               << d.divLength1 << " " << d.lengthBlue << "\n";
+    }
+    return os.str();
+}
+
+// Read an enumeration written as an integer, which has to lie between the
+// first and last enumerators
+template <typename T>
+static bool ReadEnum(std::istream& is, T& value, const T first, const T last)
+{
+    int i;
+    if(!(is >> i) || (i < static_cast<int>(first)) || (i > static_cast<int>(last)))
+        return false;
+    value = static_cast<T>(i);
+    return true;
+}
+
+static bool ReadScheme(std::istream& is, ComputeScheme& scheme)
+{
+    std::string name;
+    if(!(is >> name))
+        return false;
+    for(auto cs : wisdomSchemes)
+    {
+        if(PrintScheme(cs) == name)
+        {
+            scheme = cs;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Wisdom::Import(const std::string& text)
+{
+    std::istringstream is(text);
+
+    std::string header;
+    int         version = 0;
+    if(!(is >> header >> version) || (header != wisdomHeader) || (version != wisdomVersion))
+        return false;
+
+    std::map<rocfft_plan_t, std::vector<Plan1DDecision>> imported;
+
+    std::string tag;
+    while(is >> tag)
+    {
+        rocfft_plan_t p;
+        if(tag != "plan" || !(is >> p.rank) || (p.rank < 1) || (p.rank > 3))
+            return false;
+        for(auto& len : p.lengths)
+            is >> len;
+        is >> p.batch;
+        if(!ReadEnum(is, p.placement, rocfft_placement_inplace, rocfft_placement_notinplace)
+           || !ReadEnum(is,
+                        p.transformType,
+                        rocfft_transform_type_complex_forward,
+                        rocfft_transform_type_real_inverse)
+           || !ReadEnum(is, p.precision, rocfft_precision_single, rocfft_precision_double)
+           || !ReadEnum(is,
+                        p.desc.inArrayType,
+                        rocfft_array_type_complex_interleaved,
+                        rocfft_array_type_unset)
+           || !ReadEnum(is,
+                        p.desc.outArrayType,
+                        rocfft_array_type_complex_interleaved,
+                        rocfft_array_type_unset))
+            return false;
+        for(auto& stride : p.desc.inStrides)
+            is >> stride;
+        for(auto& stride : p.desc.outStrides)
+            is >> stride;
+        is >> p.desc.inDist >> p.desc.outDist;
+        for(auto& offset : p.desc.inOffset)
+            is >> offset;
+        for(auto& offset : p.desc.outOffset)
+            is >> offset;
+        is >> p.desc.scale;
+        if(!ReadEnum(is,
+                     p.desc.backend,
+                     rocfft_execution_backend_device,
+                     rocfft_execution_backend_host))
+            return false;
+        p.base_type_size
+            = (p.precision == rocfft_precision_double) ? sizeof(double) : sizeof(float);
+
+        size_t count = 0;
+        if(!is || !(is >> tag >> count) || (tag != "decisions"))
+            return false;
+
+        // the count is not trusted to size anything; the text runs out first
+        std::vector<Plan1DDecision> decided;
+        for(size_t i = 0; i < count; i++)
+        {
+            Plan1DDecision d;
+            if(!(is >> d.length) || !ReadScheme(is, d.scheme)
+               || !(is >> d.divLength0 >> d.divLength1 >> d.lengthBlue))
+                return false;
+            decided.push_back(d);
+        }
+        imported[Key(p)] = decided;
+    }
+
+    std::lock_guard<std::mutex> lck(mtx);
+    for(const auto& entry : imported)
+        decisions[entry.first] = entry.second;
+    return true;
+}
+
+// Bytes spanned by one side of a plan, counted in complex elements so that
+// real and hermitian data fit as well
+static size_t BufferBytes(const rocfft_plan_t&         plan,
+                          const std::array<size_t, 3>& strides,
+                          const size_t                 dist,
+                          const std::array<size_t, 2>& offsets)
+{
+    size_t span = std::max(offsets[0], offsets[1]) + (plan.batch - 1) * dist + 1;
+    for(size_t i = 0; i < plan.rank; i++)
+        span += (plan.lengths[i] - 1) * strides[i];
+    return span * 2 * plan.base_type_size;
+}
+
+static bool IsPlanar(const rocfft_array_type type)
+{
+    return (type == rocfft_array_type_complex_planar)
+           || (type == rocfft_array_type_hermitian_planar);
+}
+
+// Best time of a few executions of the plan built with the given decisions,
+// or infinity if the buffers of a device run cannot be allocated.  Timing on
+// the host backend never calls HIP.
+static double TimePlan(const rocfft_plan_t&           plan,
+                       const rocfft_execution_backend backend,
+                       PlanDecisions&                 decisions)
+{
+    ExecPlan execPlan;
+    CreateExecPlan(plan, execPlan, &decisions);
+    PlanPowX(execPlan);
+
+    const bool host     = (backend == rocfft_execution_backend_host);
+    auto       allocate = [host](const size_t bytes) {
+        void* ptr = nullptr;
+        if(host)
+            ptr = new char[std::max<size_t>(bytes, 1)];
+        else if(hipMalloc(&ptr, std::max<size_t>(bytes, 1)) != hipSuccess)
+            ptr = nullptr;
+        return ptr;
+    };
+    auto release = [host](void* ptr) {
+        if(host)
+            delete[] static_cast<char*>(ptr);
+        else if(ptr)
+            hipFree(ptr);
+    };
+
+    const size_t inBytes
+        = BufferBytes(plan, plan.desc.inStrides, plan.desc.inDist, plan.desc.inOffset);
+    const size_t outBytes
+        = BufferBytes(plan, plan.desc.outStrides, plan.desc.outDist, plan.desc.outOffset);
+    const bool inplace = (plan.placement == rocfft_placement_inplace);
+
+    void* in_buffer[2]  = {nullptr, nullptr};
+    void* out_buffer[2] = {nullptr, nullptr};
+    for(size_t i = 0; i < (IsPlanar(plan.desc.inArrayType) ? 2 : 1); i++)
+        in_buffer[i] = allocate(inplace ? std::max(inBytes, outBytes) : inBytes);
+    for(size_t i = 0; i < (IsPlanar(plan.desc.outArrayType) ? 2 : 1); i++)
+        out_buffer[i] = inplace ? in_buffer[i] : allocate(outBytes);
+
+    rocfft_execution_info_t info;
+    info.backend        = backend;
+    info.workBufferSize = execPlan.workBufSize * 2 * plan.base_type_size;
+    info.workBuffer     = allocate(info.workBufferSize);
+
+    bool ready = (info.workBuffer != nullptr);
+    for(size_t i = 0; i < (IsPlanar(plan.desc.inArrayType) ? 2 : 1); i++)
+        ready = ready && in_buffer[i];
+    for(size_t i = 0; i < (IsPlanar(plan.desc.outArrayType) ? 2 : 1); i++)
+        ready = ready && out_buffer[i];
+    // PlanPowX only creates the tables of the backend the plan is built
+    // for; make sure they all exist before timing it
+    ready = ready && (host ? CreateHostTables(execPlan) : CreateDeviceTables(execPlan));
+
+    // one run to warm up, then at least three and 10 ms of runs
+    using clock = std::chrono::steady_clock;
+    double best  = ready ? -1.0 : std::numeric_limits<double>::infinity();
+    double total = 0.0;
+    for(size_t run = 0; ready && ((run < 4) || (total < 0.01)); run++)
+    {
+        const auto start = clock::now();
+        TransformPowX(execPlan, in_buffer, out_buffer, &info);
+        if(!host)
+            hipDeviceSynchronize();
+        const double seconds = std::chrono::duration<double>(clock::now() - start).count();
+        if(run == 0)
+            continue;
+        best = (best < 0.0) ? seconds : std::min(best, seconds);
+        total += seconds;
+    }
+
+    release(info.workBuffer);
+    for(size_t i = 0; i < 2; i++)
+    {
+        if(out_buffer[i] && !inplace)
+            release(out_buffer[i]);
+        if(in_buffer[i])
+            release(in_buffer[i]);
+    }
+    TreeNode::DeleteNode(execPlan.rootPlan);
+
+    return best;
+}
+
+void MeasurePlan(const rocfft_plan_t& plan, std::vector<Plan1DDecision>& best)
+{
+    using clock = std::chrono::steady_clock;
+
+    const auto                     start   = clock::now();
+    const rocfft_execution_backend backend = plan.desc.backend;
+    auto                           expired = [&]() {
+        return (plan.desc.timeLimit > 0.0)
+               && (std::chrono::duration<double>(clock::now() - start).count()
+                   > plan.desc.timeLimit);
+    };
+
+    // start from the tree the cost model picks
+    PlanDecisions decisions;
+    double        bestTime     = TimePlan(plan, backend, decisions);
+    auto          alternatives = decisions.alternatives;
+    best                       = decisions.made;
+
+    // then try the other candidates of each decision in turn, in the order
+    // of the cost model, skipping those it rates far worse
+    for(size_t i = 0; i < best.size(); i++)
+    {
+        const std::vector<Plan1DCandidate> candidates = alternatives[i];
+        for(const auto& c : candidates)
+        {
+            if(expired())
+                return;
+            if(c.cost > 4 * candidates.front().cost)
+                break;
+            if(best[i].Is(c))
+                continue;
+
+            PlanDecisions trial;
+            trial.forced    = best;
+            trial.forced[i] = Plan1DDecision(best[i].length, c);
+
+            const double time = TimePlan(plan, backend, trial);
+            if(time < bestTime)
+            {
+                bestTime     = time;
+                best         = trial.made;
+                alternatives = trial.alternatives;
+            }
+        }
+    }
+}
+
+rocfft_status rocfft_wisdom_export_to_file(const char* path)
+{
+    log_trace(__func__, "path", path);
+    if(path == nullptr)
+        return rocfft_status_invalid_arg_value;
+
+    std::ofstream file(path);
+    if(!file)
+        return rocfft_status_failure;
+    file << Wisdom::GetWisdom().Export();
+    return file ? rocfft_status_success : rocfft_status_failure;
+}
+
+rocfft_status rocfft_wisdom_export_to_buffer(char* buffer, size_t* buffer_size)
+{
+    log_trace(__func__, "buffer", buffer, "buffer_size", buffer_size);
+    if(buffer_size == nullptr)
+        return rocfft_status_invalid_arg_value;
+
+    const std::string text = Wisdom::GetWisdom().Export();
+    if(buffer == nullptr)
+    {
+        *buffer_size = text.size() + 1;
+        return rocfft_status_success;
+    }
+    if(*buffer_size < text.size() + 1)
+        return rocfft_status_invalid_arg_value;
+
+    memcpy(buffer, text.c_str(), text.size() + 1);
+    *buffer_size = text.size() + 1;
+    return rocfft_status_success;
+}
+
+rocfft_status rocfft_wisdom_import_from_file(const char* path)
+{
+    log_trace(__func__, "path", path);
+    if(path == nullptr)
+        return rocfft_status_invalid_arg_value;
+
+    try
+    {
+        std::ifstream file(path);
+        if(!file)
+            return rocfft_status_failure;
+        std::stringstream text;
+        text << file.rdbuf();
+        return Wisdom::GetWisdom().Import(text.str()) ? rocfft_status_success
+                                                      : rocfft_status_failure;
+    }
+    catch(const std::exception&)
+    {
+        return rocfft_status_failure;
+    }
+}
+
+rocfft_status rocfft_wisdom_import_from_buffer(const char* buffer, size_t buffer_size)
+{
+    log_trace(__func__, "buffer", buffer, "buffer_size", buffer_size);
+    if(buffer == nullptr)
+        return rocfft_status_invalid_arg_value;
+
+    try
+    {
+        const std::string text(buffer, strnlen(buffer, buffer_size));
+        return Wisdom::GetWisdom().Import(text) ? rocfft_status_success : rocfft_status_failure;
+    }
+    catch(const std::exception&)
+    {
+        return rocfft_status_failure;
+    }
+}